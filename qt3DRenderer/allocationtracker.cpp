@@ -0,0 +1,101 @@
+#include "allocationtracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+
+static std::atomic<uint64_t> g_allocations(0);
+static std::atomic<uint64_t> g_bytes(0);
+
+
+#ifdef TRACK_ALLOCATIONS
+
+// trackedAlloc: malloc() + the counters. operator new must return a unique pointer even for 0 bytes
+static void* trackedAlloc(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    g_bytes.fetch_add(size, std::memory_order_relaxed);
+
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new(std::size_t size)
+{
+    void* ptr = trackedAlloc(size);
+    if (!ptr)
+        throw std::bad_alloc();
+
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    void* ptr = trackedAlloc(size);
+    if (!ptr)
+        throw std::bad_alloc();
+
+    return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return trackedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return trackedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+#endif
+
+
+bool AllocationTracker::enabled()
+{
+#ifdef TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint64_t AllocationTracker::allocations()
+{
+    return g_allocations.load(std::memory_order_relaxed);
+}
+
+uint64_t AllocationTracker::bytes()
+{
+    return g_bytes.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstdint>
+
+
+/* AllocationTracker: counts the heap allocations that go through operator new (std::vector, std::string, shared_ptr,
+ * the containers of Qt...) when the program is built with TRACK_ALLOCATIONS: the debug builds, or CONFIG+=bench with
+ * qmake. The replacements of the global operators only add 2 relaxed atomic increments to each allocation, but they
+ * are left out of the regular release builds.
+ *
+ * The counters are global and never reset: the Profiler takes their difference around each stage of a frame, and
+ * the --check harness around whole frames to make sure the steady state of the frame loop doesn't allocate.
+ * Memory taken straight from malloc() (the aligned buffers of Display) is not counted.
+ */
+class AllocationTracker
+{
+public:
+    // enabled: the program was built with TRACK_ALLOCATIONS (the counters stay at 0 otherwise)
+    static bool enabled();
+
+    // allocations: the number of allocations made since the start of the program
+    static uint64_t allocations();
+
+    // bytes: the number of bytes requested by those allocations
+    static uint64_t bytes();
+};
@@ -0,0 +1,216 @@
+#include "assetmanager.h"
+#include "meshoptimizer.h"
+#include "objloader.h"
+
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QImage>
+#include <QRunnable>
+
+#include <cstring>
+#include <functional>
+
+#define FNV_OFFSET 14695981039346656037ull
+#define FNV_PRIME 1099511628211ull
+
+
+// AssetJob: runs a function on the thread pool
+class AssetJob : public QRunnable
+{
+public:
+    AssetJob(const std::function<void()>& func) : _func(func) {}
+    void run() override { _func(); }
+
+private:
+    std::function<void()> _func;
+};
+
+// hashPixels: FNV-1a of the size and the pixels of an image
+static uint64_t hashPixels(const uint32_t* pixels, const int& width, const int& height)
+{
+    uint64_t hash = FNV_OFFSET;
+    auto add = [&hash](const uint8_t* bytes, const size_t& count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            hash = (hash ^ bytes[i]) * FNV_PRIME;
+    };
+
+    add(reinterpret_cast<const uint8_t*>(&width), sizeof(width));
+    add(reinterpret_cast<const uint8_t*>(&height), sizeof(height));
+    add(reinterpret_cast<const uint8_t*>(pixels), (size_t)width * height * sizeof(uint32_t));
+    return hash;
+}
+
+
+AssetManager::AssetManager()
+{
+    _pool.setMaxThreadCount(ASSET_THREADS);
+    _pending = 0;
+    _requests = _cacheHits = _sharedTextures = 0;
+}
+
+AssetManager::~AssetManager()
+{
+    // the jobs still running write to the assets (and to this object)
+    _pool.waitForDone();
+}
+
+MeshAsset AssetManager::loadMesh(const std::string& path, const int& lodLevels)
+{
+    // the same file with a different number of LODs is a different asset
+    std::string key = _key(path) + "#" + std::to_string(lodLevels);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _requests++;
+
+    std::map<std::string, std::shared_ptr<Asset<Mesh>>>::iterator it = _meshes.find(key);
+    if (it != _meshes.end())
+    {
+        _cacheHits++;
+        return it->second;
+    }
+
+    std::shared_ptr<Asset<Mesh>> asset = std::make_shared<Asset<Mesh>>(path);
+    _meshes[key] = asset;
+
+    _pending++;
+    _pool.start(new AssetJob([this, asset, lodLevels]() { _loadMesh(asset, lodLevels); }));
+    return asset;
+}
+
+TextureAsset AssetManager::loadTexture(const std::string& path)
+{
+    std::string key = _key(path);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _requests++;
+
+    std::map<std::string, std::shared_ptr<Asset<Texture>>>::iterator it = _textures.find(key);
+    if (it != _textures.end())
+    {
+        _cacheHits++;
+        return it->second;
+    }
+
+    std::shared_ptr<Asset<Texture>> asset = std::make_shared<Asset<Texture>>(path);
+    _textures[key] = asset;
+
+    _pending++;
+    _pool.start(new AssetJob([this, asset]() { _loadTexture(asset); }));
+    return asset;
+}
+
+int AssetManager::pendingLoads()
+{
+    return _pending.load();
+}
+
+void AssetManager::waitForAll()
+{
+    _pool.waitForDone();
+}
+
+uint64_t AssetManager::requests()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _requests;
+}
+
+uint64_t AssetManager::cacheHits()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _cacheHits;
+}
+
+uint64_t AssetManager::sharedTextures()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _sharedTextures;
+}
+
+/* _loadMesh: runs on the pool. Everything the renderer would compute the first time the mesh is drawn is done here,
+ * since the mesh is immutable once it's READY.
+ */
+void AssetManager::_loadMesh(std::shared_ptr<Asset<Mesh>> asset, const int& lodLevels)
+{
+    // OBJLoader exits when the file is missing: a missing asset must only leave its placeholder on the screen
+    if (!QFile::exists(QString::fromStdString(asset->_path)))
+    {
+        qDebug() << "AssetManager::_loadMesh !!! file not found:" << QString::fromStdString(asset->_path);
+        asset->_state.store(ASSET_STATE::FAILED, std::memory_order_release);
+        _pending--;
+        return;
+    }
+
+    std::shared_ptr<Mesh> mesh = std::make_shared<Mesh>(OBJLoader(asset->_path).mesh());
+
+    float hitRate = MeshOptimizer::cacheHitRate(*mesh);
+    MeshOptimizer::optimize(*mesh);
+    mesh->generateLods(lodLevels);
+
+    mesh->computeFacePlanes();
+    for (unsigned int l = 0; l < mesh->lods.size(); ++l)
+        mesh->lods[l].computeFacePlanes();
+
+    qDebug() << "AssetManager::_loadMesh:" << QString::fromStdString(asset->_path) << "faces=" << mesh->faces.size()
+             << "vertex cache hit rate=" << hitRate << "->" << MeshOptimizer::cacheHitRate(*mesh) << "LODs=" << mesh->lods.size();
+
+    asset->_data = mesh;
+    asset->_state.store(ASSET_STATE::READY, std::memory_order_release);
+    _pending--;
+}
+
+void AssetManager::_loadTexture(std::shared_ptr<Asset<Texture>> asset)
+{
+    QImage image = QImage(QString::fromStdString(asset->_path)).convertToFormat(QImage::Format_ARGB32);
+    if (image.isNull())
+    {
+        qDebug() << "AssetManager::_loadTexture !!! unable to load" << QString::fromStdString(asset->_path);
+        asset->_state.store(ASSET_STATE::FAILED, std::memory_order_release);
+        _pending--;
+        return;
+    }
+
+    // the rows of a QImage may be padded: copy them into a tight buffer the rasterizer can index with width * y + x
+    std::shared_ptr<Texture> texture = std::make_shared<Texture>();
+    texture->width = image.width();
+    texture->height = image.height();
+    texture->pixels = std::shared_ptr<uint32_t[]>(new uint32_t[texture->width * texture->height]);
+
+    for (int y = 0; y < texture->height; ++y)
+        std::memcpy(&texture->pixels[y * texture->width], image.constScanLine(y), texture->width * sizeof(uint32_t));
+
+    uint64_t hash = hashPixels(texture->pixels.get(), texture->width, texture->height);
+
+    {
+        // another file with the same pixels: share its buffer and let this copy go
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::multimap<uint64_t, std::shared_ptr<const Texture>>::iterator it = _texturesByHash.lower_bound(hash);
+        for (; it != _texturesByHash.end() && it->first == hash; ++it)
+        {
+            const Texture& other = *it->second;
+            if (other.width == texture->width && other.height == texture->height &&
+                std::memcmp(other.pixels.get(), texture->pixels.get(), texture->width * texture->height * sizeof(uint32_t)) == 0)
+            {
+                texture->pixels = other.pixels;
+                _sharedTextures++;
+                break;
+            }
+        }
+
+        if (it == _texturesByHash.end() || it->first != hash)
+            _texturesByHash.insert(std::make_pair(hash, texture));
+    }
+
+    asset->_data = texture;
+    asset->_state.store(ASSET_STATE::READY, std::memory_order_release);
+    _pending--;
+}
+
+// _key: the same file reached through different paths (relative, with "..", ...) is the same asset
+std::string AssetManager::_key(const std::string& path)
+{
+    return QDir::cleanPath(QFileInfo(QString::fromStdString(path)).absoluteFilePath()).toStdString();
+}
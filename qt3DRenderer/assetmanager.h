@@ -0,0 +1,107 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <QThreadPool>
+
+#include "mesh.h"
+
+#define ASSET_THREADS 2             // threads of the pool that decodes the assets (they mostly wait for the disk)
+
+
+enum ASSET_STATE
+{
+    LOADING,
+    READY,
+    FAILED
+};
+
+// Texture: the ARGB32 pixels of an image
+struct Texture
+{
+    std::shared_ptr<uint32_t[]> pixels;
+    int width;
+    int height;
+};
+
+/* Asset: a file requested to the AssetManager. Every request for the same file gets the same Asset.
+ * The data is written once by the thread that loads it, before the state becomes READY, and never changes after that.
+ */
+template <typename T>
+class Asset
+{
+public:
+    Asset(const std::string& path) : _path(path), _state(ASSET_STATE::LOADING) {}
+
+    ASSET_STATE state() const { return (ASSET_STATE)_state.load(std::memory_order_acquire); }
+    bool ready() const { return state() == ASSET_STATE::READY; }
+
+    // data: valid when ready()
+    const std::shared_ptr<const T>& data() const { return _data; }
+
+    const std::string& path() const { return _path; }
+
+private:
+    friend class AssetManager;
+
+    std::string _path;
+    std::shared_ptr<const T> _data;
+    std::atomic<int> _state;
+};
+
+typedef std::shared_ptr<const Asset<Mesh>> MeshAsset;
+typedef std::shared_ptr<const Asset<Texture>> TextureAsset;
+
+
+/* AssetManager: loads meshes (.obj) and textures (any image format of QImage) on a pool of background threads.
+ *
+ * The requests return right away: the caller keeps drawing something else (a placeholder) until the asset is ready.
+ * Assets are deduplicated by path, so every mesh that asks for the same file shares the same data, and textures are
+ * also deduplicated by the hash of their pixels (the same image saved under two names is kept only once).
+ * Meshes are prepared for the renderer on the pool as well: vertex cache optimization, LODs and face planes.
+ */
+class AssetManager
+{
+public:
+    AssetManager();
+    ~AssetManager();
+
+    // loadMesh: the mesh of an .obj file, with lodLevels LODs
+    MeshAsset loadMesh(const std::string& path, const int& lodLevels = 0);
+
+    // loadTexture: an image converted to ARGB32
+    TextureAsset loadTexture(const std::string& path);
+
+    // pendingLoads: assets not finished yet
+    int pendingLoads();
+
+    // waitForAll: block until every asset requested so far is loaded (or failed)
+    void waitForAll();
+
+    // stats
+    uint64_t requests();
+    uint64_t cacheHits();           // requests for a file that was already requested
+    uint64_t sharedTextures();      // textures whose pixels turned out to be the same of another file
+
+private:
+    void _loadMesh(std::shared_ptr<Asset<Mesh>> asset, const int& lodLevels);
+    void _loadTexture(std::shared_ptr<Asset<Texture>> asset);
+
+    static std::string _key(const std::string& path);
+
+    QThreadPool _pool;
+    std::mutex _mutex;
+
+    std::map<std::string, std::shared_ptr<Asset<Mesh>>> _meshes;
+    std::map<std::string, std::shared_ptr<Asset<Texture>>> _textures;
+    std::multimap<uint64_t, std::shared_ptr<const Texture>> _texturesByHash;
+
+    std::atomic<int> _pending;
+    uint64_t _requests;
+    uint64_t _cacheHits;
+    uint64_t _sharedTextures;
+};
@@ -0,0 +1,1115 @@
+#include "benchmark.h"
+#include "assetmanager.h"
+#include "display.h"
+#include "jobsystem.h"
+#include "lighting.h"
+#include "meshoptimizer.h"
+#include "microbenchmark.h"
+#include "multiviewrenderer.h"
+#include "pagedmesh.h"
+#include "renderer.h"
+#include "scene.h"
+#include "stressscene.h"
+
+#include <QDir>
+#include <QFile>
+#include <QThread>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+
+
+// timeMs: run func several times and return the average time (ms) of a single run
+static double timeMs(const int& iterations, const std::function<void()>& func)
+{
+    // warm up: first touch of the pages, caches, ...
+    func();
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < iterations; ++i)
+        func();
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / iterations;
+}
+
+/* terrainMesh: a procedural height field of (size * size * 2) faces on the XZ plane, 1 unit between the vertices and
+ * centered at the origin. The faces are Clockwise when seen from above.
+ */
+static Mesh terrainMesh(const int& size)
+{
+    Mesh mesh;
+
+    for (int z = 0; z <= size; ++z)
+        for (int x = 0; x <= size; ++x)
+        {
+            float height = 3.f * std::sin(x * 0.05f) * std::cos(z * 0.07f) + 0.5f * std::sin(x * 0.31f + z * 0.23f);
+            mesh.vertices.push_back(Vec3d(x - size / 2.f, height, z - size / 2.f));
+        }
+
+    for (int z = 0; z < size; ++z)
+        for (int x = 0; x < size; ++x)
+        {
+            int a = z * (size + 1) + x;     // near-left
+            int b = a + 1;                  // near-right
+            int c = a + size + 1;           // far-left
+            int d = c + 1;                  // far-right
+
+            Tex2 uvA(x / (float)size, z / (float)size), uvB((x + 1) / (float)size, z / (float)size);
+            Tex2 uvC(x / (float)size, (z + 1) / (float)size), uvD((x + 1) / (float)size, (z + 1) / (float)size);
+
+            mesh.faces.push_back(Face(a, c, b, uvA, uvC, uvB, 0xFFFFFFFF));
+            mesh.faces.push_back(Face(b, c, d, uvB, uvC, uvD, 0xFFFFFFFF));
+        }
+
+    return mesh;
+}
+
+// threadSteps: 1, 2, 4, ... up to the number of cores
+static std::vector<int> threadSteps()
+{
+    int maxThreads = std::max(QThread::idealThreadCount(), 1);
+    std::vector<int> threadCounts;
+    for (int t = 1; t < maxThreads; t *= 2)
+        threadCounts.push_back(t);
+    threadCounts.push_back(maxThreads);
+
+    return threadCounts;
+}
+
+// stressFrames: average time (ms) of a frame of meshes seen from the origin looking down +Z. The profiler of the
+// renderer is left with the averages of the stages over the same frames
+static double stressFrames(Renderer& renderer, std::vector<Mesh>& meshes, const RENDER_MODE& renderMode, const int& frames)
+{
+    Vec3d eye(0.f, 0.f, 0.f);
+    Mat4 viewMatrix = Mat4::lookAt(eye, Vec3d(0.f, 0.f, 1.f), Vec3d(0.f, 1.f, 0.f));
+
+    auto frame = [&]()
+    {
+        renderer.processGeometry(meshes, eye, viewMatrix);
+        renderer.render(renderMode);
+        renderer.display().resolveClears();
+        renderer.profiler().frameDone();
+    };
+
+    // warm up
+    frame();
+    renderer.profiler().reset();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < frames; ++f)
+        frame();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count() / frames;
+}
+
+int Benchmark::run(const std::vector<std::string>& args)
+{
+    // a scene file replaces the built-in benchmarks
+    for (unsigned int i = 0; i + 1 < args.size(); ++i)
+        if (args[i] == "--scene")
+        {
+            _scene(args[i + 1]);
+            return 0;
+        }
+
+    // --micro: only the primitives, optionally saved as JSON
+    if (std::find(args.begin(), args.end(), "--micro") != args.end())
+    {
+        std::string jsonFile, filter;
+        for (unsigned int i = 0; i + 1 < args.size(); ++i)
+        {
+            if (args[i] == "--json")
+                jsonFile = args[i + 1];
+            else if (args[i] == "--filter")
+                filter = args[i + 1];
+        }
+
+        return MicroBenchmark::run(jsonFile, filter);
+    }
+
+    // --stress [geometry|fill|overdraw] [--seed N]: only the procedural scenes, one workload or all of them
+    for (unsigned int i = 0; i < args.size(); ++i)
+        if (args[i] == "--stress")
+        {
+            std::string workload = (i + 1 < args.size() && args[i + 1].compare(0, 2, "--") != 0) ? args[i + 1] : "all";
+            uint32_t seed = 1;
+            for (unsigned int j = 0; j + 1 < args.size(); ++j)
+                if (args[j] == "--seed")
+                    seed = (uint32_t)std::strtoul(args[j + 1].c_str(), nullptr, 10);
+
+            if (workload != "all" && workload != "geometry" && workload != "fill" && workload != "overdraw")
+            {
+                std::cout << "Benchmark::run: unknown stress workload " << workload << " (geometry, fill or overdraw)" << std::endl;
+                return 1;
+            }
+
+            if (workload == "all" || workload == "geometry")
+                _stressGeometry(seed);
+            if (workload == "all" || workload == "fill")
+                _stressFill(seed);
+            if (workload == "all" || workload == "overdraw")
+                _stressOverdraw(seed);
+
+            return 0;
+        }
+
+    _clears();
+    _geometry();
+    _jobs();
+    _lod();
+    _vertexCache();
+    _lighting();
+    _paging();
+    _views();
+    _shadows();
+
+    return 0;
+}
+
+/* _clears: compares 3 ways of preparing the buffers for a new frame (color + depth + grid):
+ *  - scalar: the nested x/y loops used before the vectorized clears;
+ *  - eager: vectorized clears with streaming stores;
+ *  - lazy: the clears only mark the tiles, which are filled later by resolveClears(). This measures the worst case
+ *    where no tile is touched by geometry and the whole screen is filled at presentation time.
+ */
+void Benchmark::_clears()
+{
+    struct Resolution { const char* name; int width; int height; };
+    Resolution resolutions[] = { { "720p", 1280, 720 }, { "1080p", 1920, 1080 }, { "4K", 3840, 2160 } };
+
+    const int ITERATIONS = 50;
+
+    std::cout << "Benchmark::_clears: average time per frame (ms) of color + depth clears + grid" << std::endl;
+    std::cout << std::setw(8) << "res" << std::setw(12) << "scalar" << std::setw(12) << "eager" << std::setw(12) << "lazy mark"
+              << std::setw(14) << "lazy resolve" << std::endl;
+
+    for (const Resolution& res : resolutions)
+    {
+        Display gfx;
+        gfx.setSize(res.width, res.height);
+
+        double scalarMs = timeMs(ITERATIONS, [&]()
+        {
+            uint32_t* colorBuffer = gfx.colorBuffer();
+            float* depthBuffer = gfx.depthBuffer();
+            const int stride = gfx.stride();
+
+            for (int y = 0; y < res.height; ++y)
+                for (int x = 0; x < res.width; ++x)
+                    colorBuffer[stride*y+x] = 0xFF000000;
+
+            for (int y = 0; y < res.height; ++y)
+                for (int x = 0; x < res.width; ++x)
+                    depthBuffer[stride*y+x] = 1.0f;
+
+            for (int y = 0; y < res.height; y += 25)
+                for (int x = 0; x < res.width; x += 25)
+                    colorBuffer[stride*y+x] = 0xFF808080;
+        });
+
+        gfx.setLazyClear(false);
+        double eagerMs = timeMs(ITERATIONS, [&]()
+        {
+            gfx.clearColorBuffer(0xFF000000);
+            gfx.clearDepthBuffer(1.0f);
+            gfx.drawGrid();
+        });
+
+        gfx.setLazyClear(true);
+        double markMs = 0, resolveMs = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            gfx.clearColorBuffer(0xFF000000);
+            gfx.clearDepthBuffer(1.0f);
+            gfx.drawGrid();
+
+            auto mid = std::chrono::steady_clock::now();
+            gfx.resolveClears();
+
+            auto end = std::chrono::steady_clock::now();
+            markMs += std::chrono::duration<double, std::milli>(mid - start).count();
+            resolveMs += std::chrono::duration<double, std::milli>(end - mid).count();
+        }
+
+        std::cout << std::fixed << std::setprecision(3)
+                  << std::setw(8) << res.name << std::setw(12) << scalarMs << std::setw(12) << eagerMs
+                  << std::setw(12) << markMs / ITERATIONS << std::setw(14) << resolveMs / ITERATIONS << std::endl;
+    }
+}
+
+/* _geometry: a stress scene with a grid of 1000 small spheres and a big sphere of 130k faces behind them,
+ * processed with a growing number of threads. The triangles must be identical to the ones of the serial run.
+ */
+void Benchmark::_geometry()
+{
+    std::vector<Mesh> meshes;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        Mesh sphere = StressScene::uvSphere(12, 24);
+        sphere.scale = Vec3d(0.4f, 0.4f, 0.4f);
+        sphere.translation = Vec3d((i % 40) - 19.5f, ((i / 40) % 25) - 12.f, 20.f + (i % 7));
+        meshes.push_back(sphere);
+    }
+
+    Mesh bigSphere = StressScene::uvSphere(256, 256);
+    bigSphere.scale = Vec3d(10.f, 10.f, 10.f);
+    bigSphere.translation = Vec3d(0.f, 0.f, 45.f);
+    meshes.push_back(bigSphere);
+
+    unsigned int faces = 0;
+    for (unsigned int m = 0; m < meshes.size(); ++m)
+        faces += meshes[m].faces.size();
+
+    const int ITERATIONS = 10;
+    Vec3d cameraPosition(0.f, 0.f, 0.f);
+    Mat4 viewMatrix = Mat4::lookAt(cameraPosition, Vec3d(0.f, 0.f, 1.f), Vec3d(0.f, 1.f, 0.f));
+
+    Renderer renderer;
+    renderer.display().setSize(1920, 1080);
+    renderer.setProjection(3.14159265358979323846f / 3.f, 1920 / 1080.f, 1.f, 100.f);
+
+    std::cout << "Benchmark::_geometry: " << meshes.size() << " meshes, " << faces << " faces, average time per frame (ms)" << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(12) << "geometry" << std::setw(10) << "speedup" << std::setw(12) << "triangles"
+              << std::setw(12) << "identical" << std::endl;
+
+    std::vector<Triangle> reference;
+    double serialMs = 0;
+    std::vector<int> threadCounts = threadSteps();
+
+    for (unsigned int i = 0; i < threadCounts.size(); ++i)
+    {
+        int threads = threadCounts[i];
+        renderer.setThreadCount(threads);
+
+        double ms = timeMs(ITERATIONS, [&]()
+        {
+            renderer.processGeometry(meshes, cameraPosition, viewMatrix);
+        });
+
+        const std::vector<Triangle>& triangles = renderer.triangles();
+        if (threads == 1)
+        {
+            reference = triangles;
+            serialMs = ms;
+        }
+
+        bool identical = (triangles.size() == reference.size());
+        for (unsigned int t = 0; identical && t < triangles.size(); ++t)
+            identical = std::memcmp(triangles[t].points, reference[t].points, sizeof(triangles[t].points)) == 0 &&
+                        triangles[t].color == reference[t].color;
+
+        std::cout << std::fixed << std::setprecision(3)
+                  << std::setw(8) << threads << std::setw(12) << ms << std::setw(10) << std::setprecision(2) << serialMs / ms
+                  << std::setw(12) << triangles.size() << std::setw(12) << (identical ? "yes" : "NO") << std::endl;
+    }
+}
+
+/* _jobs: batches of BATCH_SIZE tiny jobs (one item each, a few nanoseconds of work) measure the cost of a job:
+ * submission, pop/steal, execution and completion. The same batch run with std::threads started for it shows what
+ * a stage would pay without a pool of workers. Then a big parallelFor() with nested parallelFor()s checks that
+ * every item is visited exactly once.
+ */
+void Benchmark::_jobs()
+{
+    const unsigned int BATCH_SIZE = 1024;
+    const int ITERATIONS = 200;
+
+    std::cout << "Benchmark::_jobs: batches of " << BATCH_SIZE << " jobs, average cost per job (ns)" << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(12) << "jobsystem" << std::setw(12) << "threads" << std::setw(10) << "stolen"
+              << std::setw(12) << "exactly 1x" << std::endl;
+
+    std::vector<int> threadCounts = threadSteps();
+    for (unsigned int i = 0; i < threadCounts.size(); ++i)
+    {
+        int threads = threadCounts[i];
+        JobSystem jobSystem;
+        jobSystem.setThreadCount(threads);
+
+        std::vector<uint32_t> items(BATCH_SIZE, 0);
+        double poolMs = timeMs(ITERATIONS, [&]()
+        {
+            jobSystem.parallelFor(BATCH_SIZE, 1, [&](unsigned int begin, unsigned int end)
+            {
+                for (unsigned int j = begin; j < end; ++j)
+                    items[j] += j;
+            });
+        });
+        double stolen = 100.0 * jobSystem.stolen() / std::max(jobSystem.executed(), (uint64_t)1);
+
+        // ad hoc: a thread per core started for the batch, taking the items from a shared counter
+        double adHocMs = timeMs(ITERATIONS / 10, [&]()
+        {
+            std::atomic<unsigned int> next(0);
+            auto worker = [&]()
+            {
+                for (unsigned int j = next++; j < BATCH_SIZE; j = next++)
+                    items[j] += j;
+            };
+
+            std::vector<std::thread> workers;
+            for (int t = 1; t < threads; ++t)
+                workers.push_back(std::thread(worker));
+
+            worker();
+            for (unsigned int t = 0; t < workers.size(); ++t)
+                workers[t].join();
+        });
+
+        // 256 x 256 items, the inner loops are parallelFor()s too
+        const unsigned int OUTER = 256, INNER = 256;
+        std::vector<std::atomic<uint32_t>> visits(OUTER * INNER);
+        for (unsigned int j = 0; j < visits.size(); ++j)
+            visits[j] = 0;
+
+        jobSystem.parallelFor(OUTER, 4, [&](unsigned int begin, unsigned int end)
+        {
+            for (unsigned int o = begin; o < end; ++o)
+                jobSystem.parallelFor(INNER, 16, [&](unsigned int innerBegin, unsigned int innerEnd)
+                {
+                    for (unsigned int j = innerBegin; j < innerEnd; ++j)
+                        visits[o * INNER + j]++;
+                });
+        });
+
+        bool exactlyOnce = true;
+        for (unsigned int j = 0; j < visits.size(); ++j)
+            exactlyOnce = exactlyOnce && (visits[j] == 1);
+
+        std::cout << std::fixed << std::setprecision(1)
+                  << std::setw(8) << threads << std::setw(12) << poolMs * 1e6 / BATCH_SIZE << std::setw(12) << adHocMs * 1e6 / BATCH_SIZE
+                  << std::setw(9) << stolen << "%" << std::setw(12) << (exactlyOnce ? "yes" : "NO") << std::endl;
+    }
+}
+
+/* _lod: 200 spheres of 3k faces placed from 5 to 80 units away from the camera. The LODs are generated first (the
+ * cost paid at load time), then the scene is processed with and without them.
+ */
+void Benchmark::_lod()
+{
+    std::vector<Mesh> meshes;
+    Mesh sphere = StressScene::uvSphere(32, 48);
+
+    auto start = std::chrono::steady_clock::now();
+    sphere.generateLods(3);
+    std::chrono::duration<double, std::milli> lodMs = std::chrono::steady_clock::now() - start;
+
+    for (int i = 0; i < 200; ++i)
+    {
+        Mesh mesh = sphere;
+        mesh.translation = Vec3d((i % 10) * 2.5f - 11.25f, ((i / 10) % 4) * 2.5f - 3.75f, 5.f + (i / 40) * 15.f + (i % 3) * 5.f);
+        meshes.push_back(mesh);
+    }
+
+    std::cout << "Benchmark::_lod: " << sphere.faces.size() << " faces per mesh, LODs generated in " << std::fixed << std::setprecision(3)
+              << lodMs.count() << " ms:";
+    for (unsigned int l = 0; l < sphere.lods.size(); ++l)
+        std::cout << " " << sphere.lods[l].faces.size() << " faces (error " << sphere.lodErrors[l] << ")";
+    std::cout << std::endl;
+
+    const int ITERATIONS = 20;
+    Vec3d cameraPosition(0.f, 0.f, 0.f);
+    Mat4 viewMatrix = Mat4::lookAt(cameraPosition, Vec3d(0.f, 0.f, 1.f), Vec3d(0.f, 1.f, 0.f));
+
+    Renderer renderer;
+    renderer.display().setSize(1920, 1080);
+    renderer.setProjection(3.14159265358979323846f / 3.f, 1920 / 1080.f, 1.f, 100.f);
+
+    std::cout << std::setw(8) << "lod" << std::setw(12) << "geometry" << std::setw(12) << "submitted" << std::setw(12) << "triangles" << std::endl;
+
+    bool enableLod = ENABLE_LOD;
+    for (int lod = 0; lod < 2; ++lod)
+    {
+        ENABLE_LOD = (lod == 1);
+
+        double ms = timeMs(ITERATIONS, [&]()
+        {
+            renderer.processGeometry(meshes, cameraPosition, viewMatrix);
+        });
+
+        renderer.resetStats();
+        renderer.processGeometry(meshes, cameraPosition, viewMatrix);
+
+        std::cout << std::fixed << std::setprecision(3)
+                  << std::setw(8) << (ENABLE_LOD ? "on" : "off") << std::setw(12) << ms << std::setw(12) << renderer.processedFaces()
+                  << std::setw(12) << renderer.triangles().size() << std::endl;
+    }
+
+    ENABLE_LOD = enableLod;
+}
+
+/* _vertexCache: a sphere of 24k faces stored as a "triangle soup" (3 vertices of its own per face) in random order,
+ * like a mesh exported without indexes. MeshOptimizer welds it back and sorts the faces.
+ */
+void Benchmark::_vertexCache()
+{
+    Mesh sphere = StressScene::uvSphere(96, 128);
+
+    Mesh soup;
+    std::vector<unsigned int> order(sphere.faces.size());
+    for (unsigned int f = 0; f < order.size(); ++f)
+        order[f] = f;
+
+    std::mt19937 random(42);
+    std::shuffle(order.begin(), order.end(), random);
+
+    for (unsigned int f = 0; f < order.size(); ++f)
+    {
+        const Face& face = sphere.faces[order[f]];
+        int first = soup.vertices.size();
+        soup.vertices.push_back(sphere.vertices[face.a]);
+        soup.vertices.push_back(sphere.vertices[face.b]);
+        soup.vertices.push_back(sphere.vertices[face.c]);
+        soup.faces.push_back(Face(first, first + 1, first + 2, face.a_uv, face.b_uv, face.c_uv, face.color));
+    }
+    soup.translation = Vec3d(0.f, 0.f, 4.f);
+
+    Mesh welded = soup;
+    MeshOptimizer::weldVertices(welded);
+
+    Mesh optimized = welded;
+    auto start = std::chrono::steady_clock::now();
+    MeshOptimizer::optimize(optimized);
+    std::chrono::duration<double, std::milli> optimizeMs = std::chrono::steady_clock::now() - start;
+
+    const int ITERATIONS = 50;
+    Vec3d cameraPosition(0.f, 0.f, 0.f);
+    Mat4 viewMatrix = Mat4::lookAt(cameraPosition, Vec3d(0.f, 0.f, 1.f), Vec3d(0.f, 1.f, 0.f));
+
+    Renderer renderer;
+    renderer.setThreadCount(1);
+    renderer.display().setSize(1920, 1080);
+    renderer.setProjection(3.14159265358979323846f / 3.f, 1920 / 1080.f, 1.f, 100.f);
+
+    std::cout << "Benchmark::_vertexCache: " << soup.faces.size() << " faces, optimized in " << std::fixed << std::setprecision(3)
+              << optimizeMs.count() << " ms, geometry on a single thread" << std::endl;
+    std::cout << std::setw(12) << "mesh" << std::setw(10) << "vertices" << std::setw(12) << "simulated" << std::setw(12) << "measured"
+              << std::setw(12) << "geometry" << std::setw(12) << "triangles" << std::endl;
+
+    struct Variant { const char* name; Mesh* mesh; };
+    Variant variants[] = { { "soup", &soup }, { "welded", &welded }, { "optimized", &optimized } };
+
+    for (const Variant& variant : variants)
+    {
+        std::vector<Mesh> meshes(1, *variant.mesh);
+
+        double ms = timeMs(ITERATIONS, [&]()
+        {
+            renderer.processGeometry(meshes, cameraPosition, viewMatrix);
+        });
+
+        renderer.resetStats();
+        renderer.processGeometry(meshes, cameraPosition, viewMatrix);
+
+        std::cout << std::setw(12) << variant.name << std::setw(10) << variant.mesh->vertices.size()
+                  << std::setw(11) << std::setprecision(1) << MeshOptimizer::cacheHitRate(*variant.mesh) * 100.f << "%"
+                  << std::setw(11) << renderer.vertexCacheHitRate() * 100.f << "%"
+                  << std::setw(12) << std::setprecision(3) << ms << std::setw(12) << renderer.triangles().size() << std::endl;
+    }
+}
+
+/* _lighting: a batch of 64k samples with random normals, positions and colors is shaded by 1, 2, 4 and 8 lights (half of
+ * them directional, half point lights). The SSE2 and the scalar paths must produce the same colors.
+ */
+void Benchmark::_lighting()
+{
+    const unsigned int SAMPLES = 65536;
+    const int ITERATIONS = 20;
+
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> uniform(-1.f, 1.f);
+
+    Lighting::Batch batch;
+    for (unsigned int i = 0; i < SAMPLES; ++i)
+    {
+        Vec3d normal(uniform(random), uniform(random), uniform(random));
+        normal.norm();
+        Vec3d position(uniform(random) * 10.f, uniform(random) * 10.f, 10.f + uniform(random) * 5.f);
+        batch.add(normal, position, 0xFF000000 | (random() & 0x00FFFFFF));
+    }
+
+    std::vector<Light> lights;
+    for (int l = 0; l < MAX_LIGHTS; ++l)
+    {
+        Light light;
+        if (l % 2 == 0)
+            light = Light(LIGHT_TYPE::DIRECTIONAL, Vec3d(uniform(random), uniform(random), 1.f), 0xFFFFFFFF, 0.6f);
+        else
+            light = Light(LIGHT_TYPE::POINT, Vec3d(uniform(random) * 5.f, uniform(random) * 5.f, 8.f), 0xFFFFC080, 0.8f);
+        light.cameraSpace = true;
+        lights.push_back(light);
+    }
+
+    // the shading of a single light before the lighting stage: one Light::calcIntensity() per face
+    std::vector<uint32_t> colors(SAMPLES);
+    double singleMs = timeMs(ITERATIONS, [&]()
+    {
+        for (unsigned int i = 0; i < SAMPLES; ++i)
+            colors[i] = Light::calcIntensity(batch.colors[i], -batch.nz[i]);
+    });
+
+    std::cout << "Benchmark::_lighting: " << SAMPLES << " samples, Light::calcIntensity() with 1 light: " << std::fixed << std::setprecision(2)
+              << singleMs * 1e6 / SAMPLES << " ns/sample" << std::endl;
+    std::cout << std::setw(8) << "lights" << std::setw(14) << "scalar ns" << std::setw(14) << "sse2 ns" << std::setw(10) << "speedup"
+              << std::setw(12) << "max diff" << std::endl;
+
+    Lighting lighting;
+    std::vector<uint32_t> scalarColors;
+    for (int count = 1; count <= MAX_LIGHTS; count *= 2)
+    {
+        lighting.setLights(std::vector<Light>(lights.begin(), lights.begin() + count), Mat4::eye());
+
+        double scalarMs = timeMs(ITERATIONS, [&]() { lighting.shadeScalar(batch, scalarColors); });
+        double simdMs = timeMs(ITERATIONS, [&]() { lighting.shadeSse2(batch, colors); });
+
+        int maxDiff = 0;
+        for (unsigned int i = 0; i < SAMPLES; ++i)
+            for (int shift = 0; shift < 32; shift += 8)
+                maxDiff = std::max(maxDiff, std::abs((int)((colors[i] >> shift) & 0xFF) - (int)((scalarColors[i] >> shift) & 0xFF)));
+
+        std::cout << std::setw(8) << count << std::setw(14) << scalarMs * 1e6 / SAMPLES << std::setw(14) << simdMs * 1e6 / SAMPLES
+                  << std::setw(9) << scalarMs / simdMs << "x" << std::setw(12) << maxDiff << std::endl;
+    }
+
+    // flat vs Gouraud in the geometry stage: a sphere whose normals are its own vertices
+    Mesh sphere = StressScene::uvSphere(96, 128);
+    sphere.normals = sphere.vertices;
+    for (unsigned int f = 0; f < sphere.faces.size(); ++f)
+    {
+        sphere.faces[f].a_n = sphere.faces[f].a;
+        sphere.faces[f].b_n = sphere.faces[f].b;
+        sphere.faces[f].c_n = sphere.faces[f].c;
+    }
+    sphere.translation = Vec3d(0.f, 0.f, 4.f);
+    std::vector<Mesh> meshes(1, sphere);
+
+    Vec3d cameraPosition(0.f, 0.f, 0.f);
+    Mat4 viewMatrix = Mat4::lookAt(cameraPosition, Vec3d(0.f, 0.f, 1.f), Vec3d(0.f, 1.f, 0.f));
+
+    Renderer renderer;
+    renderer.display().setSize(1920, 1080);
+    renderer.setProjection(3.14159265358979323846f / 3.f, 1920 / 1080.f, 1.f, 100.f);
+    renderer.setLights(std::vector<Light>(lights.begin(), lights.begin() + 4));
+
+    std::cout << std::setw(10) << "shading" << std::setw(12) << "geometry" << std::setw(12) << "triangles" << std::endl;
+
+    bool gouraud = GOURAUD_SHADING;
+    for (int smooth = 0; smooth < 2; ++smooth)
+    {
+        GOURAUD_SHADING = (smooth == 1);
+        double ms = timeMs(ITERATIONS, [&]() { renderer.processGeometry(meshes, cameraPosition, viewMatrix); });
+
+        std::cout << std::setw(10) << (GOURAUD_SHADING ? "gouraud" : "flat") << std::setw(12) << std::setprecision(3) << ms
+                  << std::setw(12) << renderer.triangles().size() << std::endl;
+    }
+
+    GOURAUD_SHADING = gouraud;
+}
+
+/* _paging: the page file of a 512x512 terrain (~30 MB resident at full detail) is streamed with a budget of 4 MB while
+ * the camera flies low over it. The resident memory must never go over the budget.
+ * The loads run in the background: at the end of each frame the benchmark waits for them (as if the frame had lasted
+ * long enough) so that every run streams the same pages, and reports that wait apart from the time of update().
+ */
+void Benchmark::_paging()
+{
+    const int SIZE = 512;
+    const uint64_t BUDGET = 4u << 20;
+    const int FRAMES = 120;
+    std::string filename = QDir::tempPath().toStdString() + "/qt3DRenderer_bench.pages";
+
+    Mesh terrain = terrainMesh(SIZE);
+
+    auto start = std::chrono::steady_clock::now();
+    if (!PagedMesh::build(terrain, filename))
+    {
+        std::cout << "Benchmark::_paging: unable to write " << filename << std::endl;
+        return;
+    }
+    std::chrono::duration<double, std::milli> buildMs = std::chrono::steady_clock::now() - start;
+
+    PagedMesh paged;
+    paged.open(filename);
+    paged.setBudget(BUDGET);
+
+    std::cout << "Benchmark::_paging: " << terrain.faces.size() << " faces in " << paged.pageCount() << " pages, built in "
+              << std::fixed << std::setprecision(3) << buildMs.count() << " ms, budget " << (BUDGET >> 20) << " MB" << std::endl;
+
+    Renderer renderer;
+    renderer.display().setSize(1920, 1080);
+    renderer.setProjection(3.14159265358979323846f / 3.f, 1920 / 1080.f, 1.f, 100.f);
+
+    double updateMs = 0.0, geometryMs = 0.0, loadMs = 0.0;
+    uint64_t maxResident = 0, faces = 0, triangles = 0, visible = 0;
+    int pendingFrames = 0;
+
+    for (int frame = 0; frame < FRAMES; ++frame)
+    {
+        // fly from one side of the terrain to the other, turning slowly
+        float t = frame / (float)(FRAMES - 1);
+        Vec3d cameraPosition(-SIZE * 0.4f + t * SIZE * 0.8f, 8.f, -SIZE * 0.4f + t * SIZE * 0.6f);
+        float angle = 0.8f + t * 1.5f;
+        Mat4 viewMatrix = Mat4::lookAt(cameraPosition, cameraPosition + Vec3d(std::cos(angle), -0.25f, std::sin(angle)), Vec3d(0.f, 1.f, 0.f));
+
+        auto frameStart = std::chrono::steady_clock::now();
+        renderer.setView(cameraPosition, viewMatrix);
+        paged.update(renderer);
+        auto updated = std::chrono::steady_clock::now();
+
+        renderer.resetStats();
+        renderer.processGeometry(paged.meshes(), cameraPosition, viewMatrix);
+        auto processed = std::chrono::steady_clock::now();
+
+        paged.waitForLoads();
+        loadMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - processed).count();
+
+        updateMs += std::chrono::duration<double, std::milli>(updated - frameStart).count();
+        geometryMs += std::chrono::duration<double, std::milli>(processed - updated).count();
+        maxResident = std::max(maxResident, paged.residentBytes());
+        faces += renderer.processedFaces();
+        triangles += renderer.triangles().size();
+        visible += paged.visiblePages();
+        pendingFrames += paged.pending();
+    }
+
+    std::cout << std::fixed << std::setprecision(3)
+              << "  per frame: update " << updateMs / FRAMES << " ms, geometry " << geometryMs / FRAMES << " ms, background loads "
+              << loadMs / FRAMES << " ms, "
+              << visible / FRAMES << " visible pages, " << faces / FRAMES << " faces submitted, " << triangles / FRAMES << " triangles" << std::endl
+              << "  " << paged.loads() << " loads, " << paged.evictions() << " evictions, " << pendingFrames << " frames with pages pending, "
+              << "max resident " << std::setprecision(1) << maxResident / 1048576.0 << " MB"
+              << ((maxResident <= BUDGET) ? " (within budget)" : " (OVER BUDGET)") << std::endl;
+
+    paged.close();
+    QFile::remove(QString::fromStdString(filename));
+}
+
+/* _views: 500 spheres all around the origin seen by 2 cameras (640x360) and the 6 faces of a cube map (256x256).
+ * The serial run renders each view with its own Renderer, one after the other (the geometry stage of each view is
+ * still multithreaded). MultiViewRenderer computes the transforms of the meshes once, skips the meshes outside of each
+ * view and renders the views in parallel. The images may differ by rounding: the World and View matrices are
+ * concatenated.
+ */
+void Benchmark::_views()
+{
+    const float PI = 3.14159265358979323846f;
+    const int ITERATIONS = 5;
+
+    std::vector<Mesh> meshes;
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> angle(0.f, 2.f * PI), height(-8.f, 8.f), distance(6.f, 30.f);
+
+    for (int i = 0; i < 500; ++i)
+    {
+        Mesh sphere = StressScene::uvSphere(12, 24);
+        float a = angle(random), d = distance(random);
+        sphere.scale = Vec3d(0.5f, 0.5f, 0.5f);
+        sphere.translation = Vec3d(d * std::cos(a), height(random), d * std::sin(a));
+        meshes.push_back(sphere);
+    }
+
+    unsigned int faces = 0;
+    for (unsigned int m = 0; m < meshes.size(); ++m)
+        faces += meshes[m].faces.size();
+
+    // both runs share the same threads
+    JobSystem jobSystem;
+    jobSystem.setThreadCount(0);
+
+    MultiViewRenderer multiView(&jobSystem);
+    Vec3d cockpit(0.f, 1.f, 0.f), chase(-4.f, 3.f, -4.f), target(0.f, 0.f, 10.f), up(0.f, 1.f, 0.f);
+    multiView.setCamera(multiView.addView(640, 360, PI / 3.f, 0.5f, 100.f), cockpit, Mat4::lookAt(cockpit, target, up));
+    multiView.setCamera(multiView.addView(640, 360, PI / 3.f, 0.5f, 100.f), chase, Mat4::lookAt(chase, target, up));
+    multiView.setCubeMapCamera(multiView.addCubeMap(256, 0.5f, 100.f), Vec3d(0.f, 0.f, 0.f));
+
+    // the serial run: the same views, each with its own Renderer
+    std::vector<std::unique_ptr<Renderer>> renderers;
+    std::vector<Vec3d> positions;
+    std::vector<Mat4> viewMatrices;
+
+    for (int v = 0; v < multiView.viewCount(); ++v)
+    {
+        Display& gfx = multiView.view(v).display();
+        float fovY = (v < 2) ? PI / 3.f : PI / 2.f;
+
+        renderers.push_back(std::unique_ptr<Renderer>(new Renderer(&jobSystem)));
+        renderers[v]->display().setSize(gfx.width(), gfx.height());
+        renderers[v]->display().setup();
+        renderers[v]->setProjection(fovY, gfx.width() / (float)gfx.height(), 0.5f, 100.f);
+    }
+
+    Vec3d cubePosition(0.f, 0.f, 0.f);
+    positions = { cockpit, chase, cubePosition, cubePosition, cubePosition, cubePosition, cubePosition, cubePosition };
+    viewMatrices = { Mat4::lookAt(cockpit, target, up), Mat4::lookAt(chase, target, up) };
+    Vec3d directions[6] = { Vec3d(1.f, 0.f, 0.f), Vec3d(-1.f, 0.f, 0.f), Vec3d(0.f, 1.f, 0.f),
+                            Vec3d(0.f, -1.f, 0.f), Vec3d(0.f, 0.f, 1.f), Vec3d(0.f, 0.f, -1.f) };
+    Vec3d ups[6] = { up, up, Vec3d(0.f, 0.f, -1.f), Vec3d(0.f, 0.f, 1.f), up, up };
+    for (int face = 0; face < 6; ++face)
+        viewMatrices.push_back(Mat4::lookAt(cubePosition, cubePosition + directions[face], ups[face]));
+
+    std::cout << "Benchmark::_views: " << meshes.size() << " meshes, " << faces << " faces, " << multiView.viewCount()
+              << " views, " << jobSystem.threadCount() << " threads, average time per frame (ms)" << std::endl;
+
+    uint64_t serialFaces = 0, multiFaces = 0;
+
+    double serialMs = timeMs(ITERATIONS, [&]()
+    {
+        for (unsigned int v = 0; v < renderers.size(); ++v)
+        {
+            renderers[v]->processGeometry(meshes, positions[v], viewMatrices[v]);
+            renderers[v]->render(RENDER_MODE::TRIANGLES);
+        }
+    });
+
+    double multiMs = timeMs(ITERATIONS, [&]()
+    {
+        multiView.render(meshes, RENDER_MODE::TRIANGLES);
+    });
+
+    // how much of the images changed with the concatenated matrices
+    uint64_t pixels = 0, different = 0;
+    for (unsigned int v = 0; v < renderers.size(); ++v)
+    {
+        Display& a = renderers[v]->display();
+        Display& b = multiView.view(v).display();
+        serialFaces += renderers[v]->processedFaces() / (ITERATIONS + 1);
+        multiFaces += multiView.view(v).processedFaces() / (ITERATIONS + 1);
+
+        for (int y = 0; y < a.height(); ++y)
+            for (int x = 0; x < a.width(); ++x)
+            {
+                pixels++;
+                if (a.colorBuffer()[y * a.stride() + x] != b.colorBuffer()[y * b.stride() + x])
+                    different++;
+            }
+    }
+
+    std::cout << std::setw(16) << "" << std::setw(12) << "frame" << std::setw(10) << "speedup" << std::setw(16) << "faces/frame" << std::endl;
+    std::cout << std::fixed << std::setprecision(3)
+              << std::setw(16) << "one by one" << std::setw(12) << serialMs << std::setw(10) << std::setprecision(2) << 1.0
+              << std::setw(16) << serialFaces << std::endl;
+    std::cout << std::fixed << std::setprecision(3)
+              << std::setw(16) << "multi view" << std::setw(12) << multiMs << std::setw(10) << std::setprecision(2) << serialMs / multiMs
+              << std::setw(16) << multiFaces << std::endl;
+    std::cout << "Benchmark::_views: world/views " << multiView.profiler().report() << ", "
+              << std::setprecision(3) << 100.0 * different / pixels << "% of the pixels differ" << std::endl;
+}
+
+/* _shadows: spheres floating over a terrain, lit by a directional light that casts shadows, while the camera orbits
+ * around them. The shadow map is rendered on every frame or only once (cached: nothing but the camera moves). The
+ * fraction of the pixels darkened tells that the shadows were really drawn.
+ */
+void Benchmark::_shadows()
+{
+    const float PI = 3.14159265358979323846f;
+    const int FRAMES = 20;
+
+    std::vector<Mesh> meshes;
+    meshes.push_back(terrainMesh(64));
+
+    std::mt19937 random(11);
+    std::uniform_real_distribution<float> position(-24.f, 24.f), height(5.f, 10.f);
+    for (int i = 0; i < 100; ++i)
+    {
+        Mesh sphere = StressScene::uvSphere(12, 24);
+        sphere.translation = Vec3d(position(random), height(random), position(random));
+        meshes.push_back(sphere);
+    }
+
+    unsigned int faces = 0;
+    for (unsigned int m = 0; m < meshes.size(); ++m)
+        faces += meshes[m].faces.size();
+
+    Light sun(LIGHT_TYPE::DIRECTIONAL, Vec3d(0.5f, -1.f, 0.8f));
+    sun.castShadows = true;
+
+    Renderer renderer;
+    renderer.display().setSize(1280, 720);
+    renderer.display().setup();
+    renderer.setProjection(PI / 3.f, 1280 / 720.f, 0.5f, 200.f);
+    renderer.setLights({ sun });
+
+    std::cout << "Benchmark::_shadows: " << meshes.size() << " meshes, " << faces << " faces, " << SHADOW_MAP_SIZE << "x"
+              << SHADOW_MAP_SIZE << " shadow map, average time per frame (ms)" << std::endl;
+    std::cout << std::setw(16) << "" << std::setw(12) << "frame" << std::setw(12) << "overhead" << std::setw(12) << "map"
+              << std::setw(12) << "lookup" << std::setw(14) << "map renders" << std::endl;
+
+    struct Mode { const char* name; bool shadows; bool cache; };
+    Mode modes[] = { { "no shadows", false, false }, { "cached", true, true }, { "every frame", true, false } };
+
+    double baseMs = 0.0;
+    std::vector<uint32_t> unshadowed;
+
+    for (const Mode& mode : modes)
+    {
+        ENABLE_SHADOWS = mode.shadows;
+        CACHE_SHADOW_MAP = mode.cache;
+        uint64_t rendersBefore = renderer.shadowMap().renders();
+        renderer.profiler().reset();
+
+        auto start = std::chrono::steady_clock::now();
+        for (int f = 0; f < FRAMES; ++f)
+        {
+            float angle = 2.f * PI * f / FRAMES;
+            Vec3d eye(40.f * std::cos(angle), 20.f, 40.f * std::sin(angle));
+            renderer.processGeometry(meshes, eye, Mat4::lookAt(eye, Vec3d(0.f, 0.f, 0.f), Vec3d(0.f, 1.f, 0.f)));
+            renderer.render(RENDER_MODE::TRIANGLES);
+            renderer.display().resolveClears();
+            renderer.profiler().frameDone();
+        }
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        double ms = elapsed.count() / FRAMES;
+
+        // the last frame is the same in every mode: compare it to the one without shadows
+        Display& gfx = renderer.display();
+        uint64_t shadowed = 0;
+        for (int y = 0; y < gfx.height(); ++y)
+            for (int x = 0; x < gfx.width(); ++x)
+            {
+                uint32_t color = gfx.colorBuffer()[y * gfx.stride() + x];
+                if (!mode.shadows)
+                    unshadowed.push_back(color);
+                else if (color != unshadowed[y * gfx.width() + x])
+                    shadowed++;
+            }
+
+        if (!mode.shadows)
+            baseMs = ms;
+
+        std::cout << std::fixed << std::setprecision(3) << std::setw(16) << mode.name << std::setw(12) << ms
+                  << std::setw(11) << std::setprecision(1) << 100.0 * (ms - baseMs) / baseMs << "%"
+                  << std::setw(12) << std::setprecision(3) << renderer.profiler().average("shadowmap")
+                  << std::setw(12) << renderer.profiler().average("shadows")
+                  << std::setw(14) << renderer.shadowMap().renders() - rendersBefore;
+        if (mode.shadows)
+            std::cout << "   " << std::setprecision(1) << 100.0 * shadowed / (gfx.width() * gfx.height()) << "% of the pixels in the shadow";
+        std::cout << std::endl;
+    }
+
+    ENABLE_SHADOWS = false;
+    CACHE_SHADOW_MAP = true;
+}
+
+/* _scene: every enabled mesh of the scene is loaded up front (loadDistance is ignored: the benchmark must measure the
+ * same work on every run), then the camera orbits the target once like the Window does (or follows the camera path).
+ */
+void Benchmark::_scene(const std::string& filename)
+{
+    const float PI = 3.14159265358979323846f;
+    const int FRAMES = 120;
+
+    Scene scene;
+    if (!scene.load(filename))
+    {
+        std::cout << "Benchmark::_scene: unable to load " << filename << std::endl;
+        return;
+    }
+
+    AssetManager assets;
+    std::vector<Mesh> meshes;
+
+    auto start = std::chrono::steady_clock::now();
+    scene.loadMeshes(assets, meshes);
+    std::chrono::duration<double, std::milli> loadMs = std::chrono::steady_clock::now() - start;
+
+    uint64_t faces = 0;
+    for (unsigned int m = 0; m < meshes.size(); ++m)
+        faces += meshes[m].geometry()->faces.size();
+
+    Renderer renderer;
+    renderer.display().setSize(1280, 900);
+    renderer.display().setup();
+    renderer.setProjection(scene.camera.fovY * PI / 180.f, 1280 / 900.f, scene.camera.zNear, scene.camera.zFar);
+    if (!scene.lights.empty())
+        renderer.setLights(scene.lights);
+
+    // one orbit around the target, or the whole camera path
+    float duration = scene.camera.path.empty() ? 360.f / std::max(std::fabs(scene.camera.orbitSpeed), 1e-3f) : scene.camera.path.back().time;
+    auto frame = [&](const int& f)
+    {
+        Vec3d position, target;
+        scene.cameraAt(duration * f / FRAMES, position, target);
+
+        Mat4 viewMatrix = Mat4::lookAt(position, target, Vec3d(0.f, 1.f, 0.f));
+        renderer.processGeometry(meshes, position, viewMatrix);
+        renderer.render(RENDER_MODE::TEXTURED);
+        renderer.display().resolveClears();
+        renderer.profiler().frameDone();
+    };
+
+    frame(0);
+    renderer.profiler().reset();
+
+    start = std::chrono::steady_clock::now();
+    for (int f = 0; f < FRAMES; ++f)
+        frame(f);
+    std::chrono::duration<double, std::milli> frameMs = std::chrono::steady_clock::now() - start;
+
+    std::cout << "Benchmark::_scene: " << filename << ": " << meshes.size() << " meshes, " << faces << " faces loaded in "
+              << std::fixed << std::setprecision(3) << loadMs.count() << " ms (" << assets.requests() << " requests, "
+              << assets.cacheHits() << " cache hits)" << std::endl;
+    std::cout << "Benchmark::_scene: " << frameMs.count() / FRAMES << " ms/frame over " << FRAMES << " frames: "
+              << renderer.profiler().report() << std::endl;
+}
+
+/* _stressGeometry: workloads bound by the geometry stage, the meshes cover a small part of the screen.
+ *  - a single sphere of 1K to 1M triangles about 100 pixels wide: the cost per triangle of the transforms, clipping
+ *    and culling;
+ *  - grids of 144 to 2304 instances of a sphere of 320 triangles spread over the screen: the cost per mesh (culling,
+ *    World matrices, LOD selection) on top of the cost per triangle.
+ */
+void Benchmark::_stressGeometry(const uint32_t& seed)
+{
+    const float PI = 3.14159265358979323846f;
+    const int WIDTH = 1280, HEIGHT = 720;
+    const int FRAMES = 10;
+
+    Renderer renderer;
+    renderer.display().setSize(WIDTH, HEIGHT);
+    renderer.display().setup();
+    renderer.setProjection(PI / 3.f, WIDTH / (float)HEIGHT, 0.5f, 500.f);
+
+    std::cout << "Benchmark::_stressGeometry: seed " << seed << ", " << WIDTH << "x" << HEIGHT << ", "
+              << renderer.threadCount() << " threads, average time per frame (ms)" << std::endl;
+    std::cout << std::setw(12) << "meshes" << std::setw(12) << "triangles" << std::setw(12) << "frame" << std::setw(12)
+              << "geometry" << std::setw(12) << "raster" << std::setw(14) << "ns/triangle" << std::endl;
+
+    auto row = [&](std::vector<Mesh>& meshes)
+    {
+        uint64_t faces = 0;
+        for (unsigned int m = 0; m < meshes.size(); ++m)
+            faces += meshes[m].geometry()->faces.size();
+
+        double ms = stressFrames(renderer, meshes, RENDER_MODE::TEXTURED, FRAMES);
+        double geometryMs = renderer.profiler().average("geometry");
+
+        std::cout << std::fixed << std::setprecision(3) << std::setw(12) << meshes.size() << std::setw(12) << faces
+                  << std::setw(12) << ms << std::setw(12) << geometryMs << std::setw(12) << renderer.profiler().average("raster")
+                  << std::setw(14) << std::setprecision(2) << geometryMs * 1e6 / faces << std::endl;
+    };
+
+    for (int triangles = 1000; triangles <= 1000000; triangles *= 10)
+    {
+        std::vector<Mesh> meshes = StressScene::instanceGrid(seed, StressScene::sphere(triangles), 1, 1, 0.f, 12.f);
+        row(meshes);
+    }
+
+    // 16:9 grids that span the width of the screen at distance 60: the spheres get smaller as the grid gets denser, so
+    // they always cover about the same number of pixels
+    const float DISTANCE = 60.f;
+    for (int k = 1; k <= 4; k *= 2)
+    {
+        int columns = 16 * k, rows = 9 * k;
+        float spacing = 2.f * DISTANCE * std::tan(PI / 6.f) * (WIDTH / (float)HEIGHT) / columns;
+
+        std::vector<Mesh> meshes = StressScene::instanceGrid(seed, StressScene::sphere(320), columns, rows, spacing, DISTANCE);
+        for (unsigned int m = 0; m < meshes.size(); ++m)
+            meshes[m].scale = Vec3d(spacing * 0.15f, spacing * 0.15f, spacing * 0.15f);
+        row(meshes);
+    }
+}
+
+/* _stressFill: a single textured quad that covers the whole screen at 720p, 1080p and 4K. With 2 triangles per frame
+ * the time goes to the clears and to the rasterization of every pixel exactly once.
+ */
+void Benchmark::_stressFill(const uint32_t& seed)
+{
+    const float PI = 3.14159265358979323846f;
+    const int FRAMES = 10;
+
+    struct Resolution { const char* name; int width; int height; };
+    Resolution resolutions[] = { { "720p", 1280, 720 }, { "1080p", 1920, 1080 }, { "4K", 3840, 2160 } };
+
+    std::cout << "Benchmark::_stressFill: seed " << seed << ", 1 full screen quad, average time per frame (ms)" << std::endl;
+    std::cout << std::setw(12) << "" << std::setw(12) << "pixels" << std::setw(12) << "frame" << std::setw(12) << "clear"
+              << std::setw(12) << "raster" << std::setw(14) << "Mpixels/s" << std::endl;
+
+    for (const Resolution& resolution : resolutions)
+    {
+        Renderer renderer;
+        renderer.display().setSize(resolution.width, resolution.height);
+        renderer.display().setup();
+        renderer.setProjection(PI / 3.f, resolution.width / (float)resolution.height, 0.5f, 100.f);
+
+        // a little bigger than the screen so that no pixel is left out by the rounding of the edges
+        float halfHeight = std::tan(PI / 6.f) * 1.05f;
+        std::vector<Mesh> meshes = StressScene::quadStack(seed, 1, 2.f, 2.f, halfHeight * resolution.width / resolution.height, halfHeight);
+
+        double ms = stressFrames(renderer, meshes, RENDER_MODE::TEXTURED, FRAMES);
+        double rasterMs = renderer.profiler().average("raster");
+        int pixels = resolution.width * resolution.height;
+
+        std::cout << std::fixed << std::setprecision(3) << std::setw(12) << resolution.name << std::setw(12) << pixels
+                  << std::setw(12) << ms << std::setw(12) << renderer.profiler().average("clear") << std::setw(12) << rasterMs
+                  << std::setw(14) << std::setprecision(1) << pixels / (rasterMs * 1000.0) << std::endl;
+    }
+}
+
+/* _stressOverdraw: stacks of 1 to 16 full screen quads at 1080p, every pixel is covered once per layer.
+ *  - back to front: every layer passes the depth test and is textured over the previous one;
+ *  - front to back: the depth test rejects the pixels of all the layers behind the first one;
+ *  - z-prepass: back to front with the depth-only pass first, only the nearest layer is textured.
+ * ms/layer is the raster time of one more layer drawn back to front.
+ */
+void Benchmark::_stressOverdraw(const uint32_t& seed)
+{
+    const float PI = 3.14159265358979323846f;
+    const int WIDTH = 1920, HEIGHT = 1080;
+    const int FRAMES = 10;
+
+    Renderer renderer;
+    renderer.display().setSize(WIDTH, HEIGHT);
+    renderer.display().setup();
+    renderer.setProjection(PI / 3.f, WIDTH / (float)HEIGHT, 0.5f, 100.f);
+
+    float halfHeight = std::tan(PI / 6.f) * 1.05f;
+    float halfWidth = halfHeight * WIDTH / HEIGHT;
+
+    std::cout << "Benchmark::_stressOverdraw: seed " << seed << ", " << WIDTH << "x" << HEIGHT << ", full screen quads, "
+              << "average time per frame (ms)" << std::endl;
+    std::cout << std::setw(12) << "layers" << std::setw(16) << "back to front" << std::setw(16) << "front to back"
+              << std::setw(12) << "z-prepass" << std::setw(12) << "ms/layer" << std::endl;
+
+    bool zPrepass = ENABLE_Z_PREPASS;
+    double firstRasterMs = 0.0;
+
+    for (int layers = 1; layers <= 16; layers *= 2)
+    {
+        std::vector<Mesh> backToFront = StressScene::quadStack(seed, layers, 2.f, 20.f, halfWidth, halfHeight, true);
+        std::vector<Mesh> frontToBack = StressScene::quadStack(seed, layers, 2.f, 20.f, halfWidth, halfHeight, false);
+
+        ENABLE_Z_PREPASS = false;
+        double backMs = stressFrames(renderer, backToFront, RENDER_MODE::TEXTURED, FRAMES);
+        double rasterMs = renderer.profiler().average("raster");
+        double frontMs = stressFrames(renderer, frontToBack, RENDER_MODE::TEXTURED, FRAMES);
+
+        ENABLE_Z_PREPASS = true;
+        double prepassMs = stressFrames(renderer, backToFront, RENDER_MODE::TEXTURED, FRAMES);
+
+        if (layers == 1)
+            firstRasterMs = rasterMs;
+
+        std::cout << std::fixed << std::setprecision(3) << std::setw(12) << layers << std::setw(16) << backMs
+                  << std::setw(16) << frontMs << std::setw(12) << prepassMs << std::setw(12);
+        if (layers > 1)
+            std::cout << (rasterMs - firstRasterMs) / (layers - 1);
+        else
+            std::cout << "-";
+        std::cout << std::endl;
+    }
+
+    ENABLE_Z_PREPASS = zPrepass;
+}
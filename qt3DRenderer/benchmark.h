@@ -0,0 +1,64 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+/* Benchmark: headless measurements of the renderer that run without opening a window.
+ *
+ * Usage: qt3DRenderer --bench
+ *        qt3DRenderer --bench --scene scene.json       (only renders the scene file)
+ *        qt3DRenderer --bench --micro [--json file]    (only the primitives, see MicroBenchmark)
+ *        qt3DRenderer --bench --stress [geometry|fill|overdraw] [--seed N]
+ *                                                      (only the procedural scenes of StressScene)
+ */
+class Benchmark
+{
+public:
+    // run: execute the benchmarks and return the exit code of the application
+    static int run(const std::vector<std::string>& args);
+
+private:
+    // _clears: cost of clearing the color/depth buffers and drawing the background grid at 720p, 1080p and 4K
+    static void _clears();
+
+    // _geometry: scaling of the multithreaded geometry stage on a scene with many meshes + one big mesh
+    static void _geometry();
+
+    // _jobs: overhead per job of the job system (compared to starting threads for every batch) and a check that every
+    // item of a parallelFor() runs exactly once, also when the jobs are nested
+    static void _jobs();
+
+    // _lod: faces submitted to the geometry stage with and without LODs on a scene of meshes spread in depth
+    static void _lod();
+
+    // _vertexCache: hit rate of the post-transform vertex cache and geometry time before/after MeshOptimizer
+    static void _vertexCache();
+
+    // _lighting: cost per sample of the lighting stage for 1 to MAX_LIGHTS lights (SSE2 vs scalar) and of flat vs
+    // Gouraud shading in the geometry stage
+    static void _lighting();
+
+    // _paging: a terrain much bigger than the budget of resident pages streamed by PagedMesh while the camera flies over it
+    static void _paging();
+
+    // _views: a frame of 8 views (2 cameras + a cube map) rendered one after the other vs by MultiViewRenderer
+    static void _views();
+
+    // _shadows: frame time without shadows, with the shadow map rendered on every frame and with the cached map
+    static void _shadows();
+
+    // _stressGeometry: frame time of a sphere of 1K to 1M triangles and of grids of instanced spheres (few pixels)
+    static void _stressGeometry(const uint32_t& seed);
+
+    // _stressFill: frame time of a full screen quad at 720p, 1080p and 4K (few triangles, every pixel drawn once)
+    static void _stressFill(const uint32_t& seed);
+
+    // _stressOverdraw: frame time of 1 to 16 full screen quads stacked in depth, drawn back to front, front to back and
+    // with the Z-prepass
+    static void _stressOverdraw(const uint32_t& seed);
+
+    // _scene: load time of the assets of a scene file and average frame time of a full orbit around its target (or of
+    // its camera path)
+    static void _scene(const std::string& filename);
+};
@@ -1,47 +1,52 @@
-#pragma once
-#include "vec3d.h"
-#include "vec4d.h"
-#include "triangle.h"
-
-#include <vector>
-
-
-enum FRUSTUM_PLANE
-{
-    LEFT   = 0,
-    RIGHT  = 1,
-    TOP    = 2,
-    BOTTOM = 3,
-    NEAR   = 4,
-    FAR    = 5
-};
-
-
-class Plane
-{
-public:
-    Plane();
-
-    Vec3d point;
-    Vec3d normal;
-};
-
-
-class Polygon
-{
-public:
-    // Constructor: receive the vertices for a triangle and its associated texture coordinates
-    Polygon(const Vec3d& v1, const Vec3d& v2, const Vec3d& v3, const Tex2& t1, const Tex2& t2, const Tex2& t3);
-
-    // clip: performs polygon clipping based on each of the Frustum sides
-    void clip(const Plane frustumPlanes[6]);
-
-    // triangles: breaks down the vertices vector into one or more Triangle objects
-    std::vector<Triangle> triangles();
-
-    std::vector<Vec3d> vertices;
-    std::vector<Tex2> texCoords;
-
-private:
-    void _clipAgainstPlane(const Plane& frustumPlane);
-};
+#pragma once
+#include "vec3d.h"
+#include "vec4d.h"
+#include "triangle.h"
+
+#define MAX_POLYGON_VERTICES 10     // a triangle gains at most 1 vertex from each of the 6 planes of the frustum
+#define MAX_POLYGON_TRIANGLES (MAX_POLYGON_VERTICES - 2)
+
+
+enum FRUSTUM_PLANE
+{
+    LEFT   = 0,
+    RIGHT  = 1,
+    TOP    = 2,
+    BOTTOM = 3,
+    NEAR   = 4,
+    FAR    = 5
+};
+
+
+class Plane
+{
+public:
+    Plane();
+
+    Vec3d point;
+    Vec3d normal;
+};
+
+
+/* Polygon: a triangle being clipped. The vertices live in fixed arrays (no heap allocation per face, the geometry
+ * stage clips every face that gets through culling)
+ */
+class Polygon
+{
+public:
+    // Constructor: receive the vertices for a triangle and its associated texture coordinates
+    Polygon(const Vec3d& v1, const Vec3d& v2, const Vec3d& v3, const Tex2& t1, const Tex2& t2, const Tex2& t3);
+
+    // clip: performs polygon clipping based on each of the Frustum sides
+    void clip(const Plane frustumPlanes[6]);
+
+    // triangles: breaks down the vertices into one or more Triangle objects (a fan) and returns how many there are
+    int triangles(Triangle triangles[MAX_POLYGON_TRIANGLES]) const;
+
+    Vec3d vertices[MAX_POLYGON_VERTICES];
+    Tex2 texCoords[MAX_POLYGON_VERTICES];
+    int vertexCount;
+
+private:
+    void _clipAgainstPlane(const Plane& frustumPlane);
+};
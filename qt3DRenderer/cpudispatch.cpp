@@ -0,0 +1,166 @@
+#include "cpudispatch.h"
+#include "display.h"
+#include "lighting.h"
+#include "postprocess.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #define HAS_CPUID 1
+    #include <intrin.h>
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define HAS_CPUID 1
+    #include <cpuid.h>
+#else
+    #define HAS_CPUID 0
+#endif
+
+
+static bool g_bound = false;
+static CPU_LEVEL g_level = CPU_SCALAR;
+static std::vector<std::pair<std::string, CPU_LEVEL>> g_kernels;
+
+
+#if HAS_CPUID
+// cpuid: the registers eax, ebx, ecx, edx of a leaf (and subleaf) of CPUID
+static void cpuid(const unsigned int& leaf, const unsigned int& subleaf, unsigned int regs[4])
+{
+#ifdef _MSC_VER
+    int r[4];
+    __cpuidex(r, (int)leaf, (int)subleaf);
+    for (int i = 0; i < 4; ++i)
+        regs[i] = (unsigned int)r[i];
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// xcr0: the register states the OS saves on a context switch (bits 1 and 2: the SSE and AVX registers)
+static unsigned long long xcr0()
+{
+#ifdef _MSC_VER
+    return _xgetbv(0);
+#else
+    unsigned int eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((unsigned long long)edx << 32) | eax;
+#endif
+}
+#endif
+
+CPU_LEVEL CpuDispatch::detectedLevel()
+{
+    CPU_LEVEL level = CPU_SCALAR;
+
+#if HAS_CPUID
+    unsigned int regs[4];
+    cpuid(0, 0, regs);
+    unsigned int maxLeaf = regs[0];
+
+    cpuid(1, 0, regs);
+    bool sse2 = (regs[3] >> 26) & 1;
+    bool osxsave = (regs[2] >> 27) & 1;
+    bool avx = (regs[2] >> 28) & 1;
+
+    if (sse2)
+        level = CPU_SSE2;
+
+    // AVX2 also needs the OS to save the 256-bit registers
+    if (sse2 && avx && osxsave && maxLeaf >= 7 && (xcr0() & 0x6) == 0x6)
+    {
+        cpuid(7, 0, regs);
+        if ((regs[1] >> 5) & 1)
+            level = CPU_AVX2;
+    }
+#endif
+
+    return level;
+}
+
+// init: the log goes to stderr, init() runs before main() knows whether stdout is the video stream of --render -
+void CpuDispatch::init()
+{
+    CPU_LEVEL level = detectedLevel();
+    std::cerr << "CpuDispatch::init: detected " << levelName(level) << std::endl;
+
+    const char* env = std::getenv(CPU_KERNELS_ENV);
+    if (env && *env)
+    {
+        std::string name = env;
+        if (name == "scalar")
+            level = std::min(level, CPU_SCALAR);
+        else if (name == "sse2")
+            level = std::min(level, CPU_SSE2);
+        else if (name == "avx2")
+            level = std::min(level, CPU_AVX2);
+        else
+            std::cerr << "CpuDispatch::init !!! Unknown " << CPU_KERNELS_ENV << "=" << name << " (scalar, sse2 or avx2)" << std::endl;
+
+        std::cerr << "CpuDispatch::init: " << CPU_KERNELS_ENV << "=" << name << std::endl;
+    }
+
+    setLevel(level);
+    std::cerr << "CpuDispatch::init: kernels " << kernels() << std::endl;
+}
+
+void CpuDispatch::setLevel(const CPU_LEVEL& level)
+{
+    g_bound = true;
+    g_level = std::min(level, detectedLevel());
+    g_kernels.clear();
+
+    Display::bindKernels(g_level);
+    Lighting::bindKernels(g_level);
+    PostProcess::bindKernels(g_level);
+}
+
+CPU_LEVEL CpuDispatch::level()
+{
+    if (!g_bound)
+        init();
+
+    return g_level;
+}
+
+const char* CpuDispatch::levelName(const CPU_LEVEL& level)
+{
+    switch (level)
+    {
+        case CPU_SSE2:
+            return "sse2";
+
+        case CPU_AVX2:
+            return "avx2";
+
+        default:
+            return "scalar";
+    }
+}
+
+void CpuDispatch::setKernel(const std::string& family, const CPU_LEVEL& variant)
+{
+    for (unsigned int k = 0; k < g_kernels.size(); ++k)
+        if (g_kernels[k].first == family)
+        {
+            g_kernels[k].second = variant;
+            return;
+        }
+
+    g_kernels.push_back(std::make_pair(family, variant));
+}
+
+std::string CpuDispatch::kernels()
+{
+    if (!g_bound)
+        init();
+
+    std::string list;
+    for (unsigned int k = 0; k < g_kernels.size(); ++k)
+        list += (k ? " " : "") + g_kernels[k].first + "=" + levelName(g_kernels[k].second);
+
+    return list;
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <string>
+
+#define CPU_KERNELS_ENV "QT3D_KERNELS"  // environment variable that overrides the level: scalar, sse2 or avx2
+
+
+// CPU_LEVEL: the instruction sets the kernels can be written with, from the slowest to the fastest
+enum CPU_LEVEL {
+    CPU_SCALAR,             // plain C++
+    CPU_SSE2,               // 4 floats / 16 bytes at a time (every x86-64 CPU)
+    CPU_AVX2                // 8 floats / 32 bytes at a time
+};
+
+
+/* CpuDispatch: picks, at run time, the variant of each family of hot kernels that the CPU can run, so the same binary
+ * uses AVX2 where it's available and falls back to SSE2 or plain C++ elsewhere.
+ *
+ * init() detects the CPU (CPUID, and whether the OS saves the AVX registers) and binds the function pointers of every
+ * family to the best variant up to that level: each family only has the variants that are worth having, so the level
+ * of a family can be lower than the level of the CPU. The QT3D_KERNELS environment variable lowers the level to test
+ * the fallbacks on a machine that supports more. The bound variants are listed by kernels() and in the reports of the
+ * Profiler.
+ *
+ * The kernels are bound once before rendering starts: setLevel() must not be called while a frame is being rendered.
+ */
+class CpuDispatch
+{
+public:
+    // init: detect the CPU, apply the override of QT3D_KERNELS and bind the kernels
+    static void init();
+
+    // setLevel: bind the kernels of a level (lowered to what the CPU supports)
+    static void setLevel(const CPU_LEVEL& level);
+
+    // level: the level the kernels were bound to (init() is called first if it wasn't yet)
+    static CPU_LEVEL level();
+
+    // detectedLevel: the best level supported by the CPU (and compiled in)
+    static CPU_LEVEL detectedLevel();
+
+    // levelName: "scalar", "sse2" or "avx2"
+    static const char* levelName(const CPU_LEVEL& level);
+
+    // setKernel: called by each family of kernels when it binds a variant
+    static void setKernel(const std::string& family, const CPU_LEVEL& variant);
+
+    // kernels: the variant bound for each family, e.g. "clear=avx2 lighting=sse2"
+    static std::string kernels();
+};
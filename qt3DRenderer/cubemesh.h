@@ -1,13 +1,13 @@
-#pragma once
-#include "mesh.h"
-
-
-class CubeMesh : public Mesh
-{
-public:
-    CubeMesh();
-    CubeMesh(const uint32_t* texData, const int& texWidth, const int& texHeight);
-
-private:
-    void _init();
-};
+#pragma once
+#include "mesh.h"
+
+
+class CubeMesh : public Mesh
+{
+public:
+    CubeMesh();
+    CubeMesh(const uint32_t* texData, const int& texWidth, const int& texHeight);
+
+private:
+    void _init();
+};
@@ -1,665 +1,1927 @@
-// Left-handed coordinate system: the Z value grows (+) towards the monitor.
-#include "display.h"
-#include "tex2.h"
-
-#include <cmath>
-#include <utility>
-#include <QThread>
-
-#define ORTHO 0
-
-
-bool USE_PAINTERS_ALGO = false;
-
-
-Display::Display()
-{
-    _colorBuffer = nullptr;
-    _depthBuffer = nullptr;
-
-    _screenWidth = _screenHeight = 0;
-    _bkgColor = 0xFFFFFFFF; // black
-    _fovFactor = 640;
-}
-
-Display::~Display()
-{
-    if (_colorBuffer)
-        delete[] _colorBuffer;
-
-    if (_depthBuffer)
-        delete[] _depthBuffer;
-}
-
-void Display::setSize(const int& width, const int& height)
-{
-    std::cout << "Display::setSize: " << width << "x" << height << std::endl;
-
-    if ((width >= 0 && height >= 0) && (width != _screenWidth || height != _screenHeight))
-    {
-        _screenWidth = width;
-        _screenHeight = height;
-
-        // recreate the Color Buffer with the appropriate size
-        setup();
-    }
-}
-
-int Display::width()
-{
-    return _screenWidth;
-}
-
-int Display::height()
-{
-    return _screenHeight;
-}
-
-void Display::setup()
-{
-    std::cout << "Display::setup" << std::endl;
-
-    if (_colorBuffer)
-        delete[] _colorBuffer;
-
-    if (_depthBuffer)
-        delete[] _depthBuffer;
-
-    // allocate color buffer
-    _colorBuffer = new uint32_t[_screenWidth * _screenHeight];
-
-    // allocate z-buffer
-    _depthBuffer = new float[_screenWidth * _screenHeight];
-
-    // clear with solid color
-    clearColorBuffer(_bkgColor);
-    clearDepthBuffer(1.0f); // depth values range from 0.0f (near) to 1.0f (far)
-}
-
-// clearColorBuffer: input color is ARGB
-void Display::clearColorBuffer(const uint32_t& c)
-{
-    for (int y = 0; y < _screenHeight; ++y)
-        for (int x = 0; x < _screenWidth; ++x)
-            _colorBuffer[_screenWidth*y+x] = c;
-}
-
-// clearDepthBuffer: input color is ARGB
-void Display::clearDepthBuffer(const float& d)
-{
-    for (int y = 0; y < _screenHeight; ++y)
-        for (int x = 0; x < _screenWidth; ++x)
-            _depthBuffer[_screenWidth*y+x] = d;
-}
-
-uint32_t* Display::colorBuffer()
-{
-    return _colorBuffer;
-}
-
-float* Display::depthBuffer()
-{
-    return _depthBuffer;
-}
-
-void Display::drawGrid()
-{
-    //std::cout << "Display::drawGrid" << std::endl;
-
-    unsigned int cellSize = 25;
-
-    for (int y = 0; y < _screenHeight; y += cellSize)
-        for (int x = 0; x < _screenWidth; x+= cellSize)
-                _colorBuffer[_screenWidth*y+x] = 0xFF808080; // gray
-}
-
-#if ORTHO
-Vec2d Display::project(Vec3d p)
-{
-    // the bigger the Z values, the more they divide
-    return Vec2d(p.x * _fovFactor,
-                 p.y * _fovFactor);
-}
-#else
-// Weak Perspective Projection
-Vec2d Display::project(Vec3d p)
-{
-    // the bigger the Z values, the more they divide
-    return Vec2d(p.x * _fovFactor / p.z,    // Perspective Divide: P'x = Px / Pz
-                 p.y * _fovFactor / p.z);   // Perspective Divide: P'y = Py / Pz
-}
-#endif
-
-void Display::drawPixel(const int& x, const int& y, const uint32_t& color)
-{
-    //std::cout << "drawPixel: x=" << x << " y=" << y << " color=0x" << std::hex << color << std::dec << std::endl;
-
-    if (x < 0 || x >= _screenWidth || y < 0 || y >= _screenHeight)
-        return;
-
-    // set pixel at row 10 column 20 to red: _screenWidth*10+20
-    _colorBuffer[_screenWidth*y+x] = color;
-}
-
-void Display::drawPixel(const int& x, const int& y, const Vec4d& a, const Vec4d& b, const Vec4d& c, const uint32_t& color)
-{
-    // define the center of the baricentric coordinate computation and retrieve the weights at this position
-    Vec2d p(x, y);
-    Vec3d weights = _barycentricWeights(Vec4d::toVec2d(a), Vec4d::toVec2d(b), Vec4d::toVec2d(c), p);
-
-    //std::cout << "------------------------------------------------------------" << std::endl;
-    //std::cout << "drawPixel:  xy @ " << x << "," << y << "  a=" << a << " b=" << b << " c=" << c << " p=" << p << std::endl;
-
-    float alpha = weights.x;
-    float beta = weights.y;
-    float gamma = weights.z;
-    //std::cout << "drawPixel: alpha=" << alpha << " beta=" << beta << " gamma=" << gamma << std::endl;
-
-    // Check if the values of alpha beta and gamma are valid
-    const float EPSILON = 0.0000001f;
-    if (alpha < -EPSILON || beta < -EPSILON || gamma < -EPSILON)
-        return;
-
-    float interpolated_reciprocal_w = 0;
-
-    // TODO: calculate interpolated_reciprocal_w before drawPixel() so it is calculated only once per triangle instead of for every pixel
-
-    // interpolate the value of 1/w for the current pixel
-    interpolated_reciprocal_w = (1.f / a.w) * alpha + (1.f / b.w) * beta + (1.f / c.w) * gamma;
-
-    /* draw the pixel only of the depth value is less than what's already stored in the depth buffer.
-     * Keep in mind that because the reciprocal is being calculated, the closer a vertex is to the camera
-     * the higher its 1/w value is going to be (i.e. 0.25). The furthest a vertex is, the smaller its 1/w is going to be (i.e. 0.17).
-     * Adjust interpolated reciprocal of w to compensate for that:
-     */
-    interpolated_reciprocal_w = 1.0f - interpolated_reciprocal_w;
-    int bufferIdx = (_screenWidth * y) + x;
-    bufferIdx = bufferIdx % (_screenWidth * _screenHeight);
-
-    if (interpolated_reciprocal_w < _depthBuffer[bufferIdx])
-    {
-        // draw the pixel
-        drawPixel(x, y, color);
-
-        // update z-buffer with this pixel's 1/w
-        _depthBuffer[bufferIdx] = interpolated_reciprocal_w;
-    }
-}
-
-/* Return the barycentric weights (alpha, beta, gamma) for point P inside triangle ABC.
- * An alternative to texture interpolation.
- *
- *                 A
- *                 o
- *                /|`.
- *               / |  `.
- *              /𝛾 |   β`.
- *             / .(P).    `.
- *         B  o´      ` .   `.
- *             `---_   α ` .  `.
- *                   ---_   ` . `.
- *                        ---_  `.`.
- *                             ---_`o  C
- */
-Vec3d Display::_barycentricWeights(const Vec2d& a, const Vec2d& b, const Vec2d& c, const Vec2d& p)
-{
-    // find the vectors between vertices ABC and point P
-    Vec2d ab = b.sub(a);
-    Vec2d ac = c.sub(a);
-    Vec2d bc = c.sub(b);
-
-    Vec2d ap = p.sub(a);
-    Vec2d bp = p.sub(b);
-
-    // calculate the area of the ABC triangle using cross product (area of paralellogram)
-    float triangleABCarea = (ab.x * ac.y - ab.y * ac.x);
-
-    // weight alpha is the area of the subtriangle BCP divided by the area of the (full) triangle ABC
-    float alpha = (bc.x * bp.y - bp.x * bc.y) / triangleABCarea;
-
-    // weight beta is the area of the subtriangle ACP divided by the area of the (full) triangle ABC
-    float beta = (ap.x * ac.y - ac.x * ap.y) / triangleABCarea;
-
-    // weight gamma is easily found since barycentric coordinates always add up to 1
-    float gamma = 1 - alpha - beta;
-
-    Vec3d weights(alpha, beta, gamma);
-    return weights;
-}
-
-void Display::drawTexel(const int& x, const int& y,
-                        const Vec4d& a, const Vec4d& b, const Vec4d& c,
-                        const Tex2& a_uv, const Tex2& b_uv, const Tex2& c_uv,
-                        const uint32_t* texture, const int& textureWidth, const int& textureHeight,
-                        const bool& fixDistortion)
-{
-    // define the center of the baricentric coordinate computation and retrieve the weights at this position
-    Vec2d p(x, y);
-    Vec3d weights = _barycentricWeights(Vec4d::toVec2d(a), Vec4d::toVec2d(b), Vec4d::toVec2d(c), p);
-
-    //std::cout << "------------------------------------------------------------" << std::endl;
-    //std::cout << "drawTexel:  xy @ " << x << "," << y << "  a=" << a << " b=" << b << " c=" << c << " p=" << p << std::endl;
-    //std::cout << "drawTexel: uv1 @ " << u1 << "," << v1 << "  uv2 @ " << u2 << "," << v2 << "  uv3 @ " << u3 << "," << v3 << std::endl;
-
-    float alpha = weights.x;
-    float beta = weights.y;
-    float gamma = weights.z;
-    //std::cout << "drawTexel: alpha=" << alpha << " beta=" << beta << " gamma=" << gamma << std::endl;
-
-    // preventing texture buffer overflow: actually disabled this for the modulus operation at the end
-//    const float EPS = 0.00001f;
-//    if (alpha < EPS || beta < EPS || gamma < EPS)
-//        return;
-
-    float interpolated_u = 0;
-    float interpolated_v = 0;
-    float interpolated_reciprocal_w = 0;
-
-    // TODO: calculate interpolated_reciprocal_w before drawTexel() so it is calculated only once per triangle instead of for every pixel
-    if (!fixDistortion)
-    {
-        // calculate the interpolation of U,V coords using barycentric weights (with perspective distortion bug)
-        interpolated_u = (a_uv.u * alpha) + (b_uv.u * beta) + (c_uv.u * gamma);
-        interpolated_v = (a_uv.v * alpha) + (b_uv.v * beta) + (c_uv.v * gamma);
-    }
-    else
-    {
-        /* calculate the interpolation of U,V coords using barycentric weights (perspective distortion fixed)
-         *      1. Use the reciprocal of all attributes (1/w)
-         *      2. Interpolate over the triangle face
-         *      3. Divide all the attributes by 1/w (undoes the perspective transform)
-         */
-        interpolated_u = (a_uv.u / a.w) * alpha + (b_uv.u / b.w) * beta + (c_uv.u / c.w) * gamma;
-        interpolated_v = (a_uv.v / a.w) * alpha + (b_uv.v / b.w) * beta + (c_uv.v / c.w) * gamma;
-        interpolated_reciprocal_w = (1.f / a.w) * alpha + (1.f / b.w) * beta + (1.f / c.w) * gamma;
-
-        interpolated_u /= interpolated_reciprocal_w;
-        interpolated_v /= interpolated_reciprocal_w;
-    }
-
-    //std::cout << "drawTexel: interpolated_u=" << interpolated_u << " interpolated_v=" << interpolated_v << std::endl;
-
-    // map X,Y position to the full texture size
-    int texX = std::abs((int)(interpolated_u * textureWidth));
-    int texY = std::abs((int)(interpolated_v * textureHeight));
-    int texIndex = ((textureWidth * texY) + texX) % (textureWidth * textureHeight);
-    uint32_t color = (uint32_t) texture[texIndex];
-    //printf("1D=%d stores=0x%08x\n", ((textureWidth * texY) + texX), texture[(textureWidth * texY)+texX]);
-    //std::cout << "drawTexel: texcoord @ " << texX << "," << texY << " texColor=0x" << std::hex << color << std::dec << std::endl;
-
-
-    // DEBUG: first pixel on the top-left of the 1st rendered face
-    /*
-    if (texIndex > 4090)
-    {
-        std::cout << "------------------------------------------------------------" << std::endl;
-        std::cout << "drawTexel:  xy @ " << x << "," << y << "  a=" << a << " b=" << b << " c=" << c << " p=" << p << std::endl;
-        std::cout << "drawTexel: uv1 @ " << u1 << "," << v1 << "  uv2 @ " << u2 << "," << v2 << "  uv3 @ " << u3 << "," << v3 << std::endl;
-        std::cout << "drawTexel: alpha=" << alpha << " beta=" << beta << " gamma=" << gamma << std::endl;
-        std::cout << "drawTexel: interpolated_u=" << interpolated_u << " interpolated_v=" << interpolated_v << std::endl;
-        std::cout << "drawTexel: texcoord @ " << texX << "," << texY << "  texIndex=" << texIndex << "  texColor=0x" << std::hex << color << std::dec << std::endl;
-        //QThread::currentThread()->msleep(30000);
-    }
-    */
-
-    /* draw the pixel only of the depth value is less than what's already stored in the depth buffer.
-     * Keep in mind that because the reciprocal is being calculated, the closer a vertex is to the camera
-     * the higher its 1/w value is going to be (i.e. 0.25). The furthest a vertex is, the smaller its 1/w is going to be (i.e. 0.17).
-     * Adjust interpolated reciprocal of w to compensate for that:
-     */
-    interpolated_reciprocal_w = 1.0f - interpolated_reciprocal_w;
-    int bufferIdx = (_screenWidth * y) + x;
-    bufferIdx = bufferIdx % (_screenWidth * _screenHeight);
-
-    if (interpolated_reciprocal_w < _depthBuffer[bufferIdx])
-    {
-        // draw the pixel
-        drawPixel(x, y, color);
-
-        // update z-buffer with this pixel's 1/w
-        _depthBuffer[bufferIdx] = interpolated_reciprocal_w;
-    }
-}
-
-// DDA algorithm: Digital Diferential Analyser
-void Display::drawLine(const int& x1, const int& y1, const int& x2, const int& y2, const uint32_t& color)
-{
-    //std::cout << "drawLine: x1,y1=" << x1 << "," << y1 << " x2,y2=" << x2 << "," << y2 << std::endl;
-
-    // Line equation: y = mx + c
-    //      m = slope, calculated as: Dy / Dx (opposite side of the triangle DIVIDED BY the adjacent side)
-    //      c = y-intercept
-    int dx = x2 - x1;
-    int dy = y2 - y1;
-
-    // longest side length: how much to run
-    int sideLen = (std::abs(dx) >= std::abs(dy)) ? std::abs(dx) : std::abs(dy);
-
-    // size of the increment step
-    float xInc = dx / (float) sideLen;
-    float yInc = dy / (float) sideLen;
-
-    //std::cout << "drawLine: dx=" << dx << " dy=" << dy << " xInc=" << xInc << " yInc=" << yInc << std::endl;
-
-    float curX = (float)x1;
-    float curY = (float)y1;
-
-    for (int i = 0; i <= sideLen; ++i)
-    {
-        //std::cout << "drawLine: round(curX)=" << std::round(curX) << " round(curY)=" << std::round(curY) << std::endl;
-        drawPixel((int)std::round(curX), (int)std::round(curY), color);
-        curX += xInc;
-        curY += yInc;
-    }
-}
-
-void Display::drawRect(const int& x, const int& y, const int& w, const int& h, const uint32_t& color)
-{
-    //std::cout << "Display::drawRect rect x=" << x << " y=" << y << " w=" << w << " h=" << h << std::endl;
-
-    if (x < 0 || x >= _screenWidth || y < 0 || y >= _screenHeight)
-        return;
-
-    int curX = 0;
-    int curY = 0;
-
-    for (int i = 0; i < w; ++i)
-        for (int j = 0; j < h; ++j)
-        {
-            //_colorBuffer[_screenWidth*(y+j)+(x+i)] = color;
-
-            curX = x + i;
-            curY = y + j;
-            drawPixel(curX, curY, color);
-        }
-}
-
-void Display::drawTriangle(const int& x1, const int& y1, const int& x2, const int& y2, const int& x3, const int& y3, const uint32_t& color)
-{
-    //std::cout << "Display::drawTriangle x1=" << x1 << " y1=" << y1 << " x2=" << x2 << " y2=" << y2 << " x3=" << x3 << " y3=" << y3 << std::endl;
-    drawLine(x1, y1, x2, y2, color);
-    drawLine(x2, y2, x3, y3, color);
-    drawLine(x3, y3, x1, y1, color);
-}
-
-/* fillTriangle: triangle rasterization (flat-bottom & flat-top approach)
- * Split the triangle in two, half flat-bottom and half flat-top
- *
- *              (x1, y1)
- *                 o
- *                / \
- *              /    \               FLAT BOTTOM
- *            /       \
- *   (x2,y2) o - - - - o (Mx,My)                            Mx = (x3-x1) (y2-y1)
- *           `.         \                                        -------------- + x1
- *             `.        \                                           (y3-y1)
- *               `.       \
- *                 `.      \
- *                   `.     \        FLAT TOP
- *                     `.    \
- *                       `.   \
- *                         `.  \
- *                           `. \
- *                             ` o (x3,y3)
- */
-void Display::fillTriangle(Vec4d p1, Vec4d p2, Vec4d p3, const uint32_t& color)
-{
-    // convert X,Y's to integer to fix rounding issues that mess up drawing and later crash drawPixel()
-    p1.x = (int)p1.x;
-    p1.y = (int)p1.y;
-    p2.x = (int)p2.x;
-    p2.y = (int)p2.y;
-    p3.x = (int)p3.x;
-    p3.y = (int)p3.y;
-
-    if (p1.y > p2.y)
-    {
-        std::swap(p1.y, p2.y);
-        std::swap(p1.x, p2.x);
-        std::swap(p1.z, p2.z);
-        std::swap(p1.w, p2.w);
-    }
-
-    if (p2.y > p3.y)
-    {
-        std::swap(p2.y, p3.y);
-        std::swap(p2.x, p3.x);
-        std::swap(p2.z, p3.z);
-        std::swap(p2.w, p3.w);
-    }
-
-    if (p1.y > p2.y)
-    {
-        std::swap(p1.y, p2.y);
-        std::swap(p1.x, p2.x);
-        std::swap(p1.z, p2.z);
-        std::swap(p1.w, p2.w);
-    }
-
-    // identify vector points for barycentric coordinates computation in drawTexel()
-    Vec4d a = p1;
-    Vec4d b = p2;
-    Vec4d c = p3;
-
-    /* draw the upper part of the triangle (flat-bottom) */
-
-    // retrieve the slopes of both legs of the upper triangle
-    float invLeftSlope = 0; // Dx / Dy
-    if ((int)(p2.y - p1.y) != 0)
-        invLeftSlope = (p2.x-p1.x) / (float)std::abs(p2.y-p1.y);
-
-    float invRightSlope = 0; // Dx / Dy
-    if ((int)(p3.y - p1.y) != 0)
-        invRightSlope = (p3.x-p1.x) / (float)std::abs(p3.y-p1.y);
-
-    // if (y2-y1) is zero, don't do any of this
-    if ((int)(p2.y - p1.y) != 0)
-    {
-        // loop through all the scanlines (top to bottom)
-        int xStart = 0, xEnd = 0;
-        for (int y = p1.y; y <= (int)p2.y; ++y)
-        {
-            xStart = p2.x + (int)(y - p2.y) * invLeftSlope;
-            xEnd   = p1.x + (int)(y - p1.y) * invRightSlope;
-
-            // rotation of the triangle might cause xEnd to be before the xStart: hence the swap below
-            if (xEnd < xStart)
-                std::swap(xEnd, xStart);
-
-            for (int x = xStart; x <= xEnd; ++x)
-            {
-                // draw pixel using the desired color
-                drawPixel(x, y, a, b, c, color);
-            }
-        }
-    }
-
-    /* draw the lower part of the triangle (flat-top) */
-
-    // retrieve the slopes of both legs of the lower triangle
-    invLeftSlope = 0; // Dx / Dy
-    if ((int)(p3.y - p2.y) != 0)
-        invLeftSlope = (p3.x-p2.x) / (float)std::abs(p3.y-p2.y);
-
-    invRightSlope = 0; // Dx / Dy
-    if ((int)(p3.y - p1.y) != 0)
-        invRightSlope = (p3.x-p1.x) / (float)std::abs(p3.y-p1.y);
-
-    // if (y3-y2) is zero, don't do scanlines
-    if ((int)(p3.y - p2.y) != 0)
-    {
-        // loop through all the scanlines (top to bottom)
-        int xStart = 0, xEnd = 0;
-        for (int y = p2.y; y <= (int)p3.y; ++y)
-        {
-            xStart = p2.x + (int)(y - p2.y) * invLeftSlope;
-            xEnd   = p1.x + (int)(y - p1.y) * invRightSlope;
-
-            // rotation of the triangle might cause xEnd to be positioned before xStart: hence the swap below
-            if (xEnd < xStart)
-                std::swap(xEnd, xStart);
-
-            for (int x = xStart; x <= xEnd; ++x)
-            {
-                // draw pixel using the desired color
-                drawPixel(x, y, a, b, c, color);
-            }
-        }
-    }
-}
-
-// Draw textured triangle using flat-top/flat-bottom method
-void Display::drawTexturedTriangle(Vec4d p1, Vec4d p2, Vec4d p3,
-                                   Tex2 uv1, Tex2 uv2, Tex2 uv3,
-                                   const uint32_t* texture, const int& textureWidth, const int& textureHeight,
-                                   const bool& fixDistortion)
-{
-    //std::cout << "Display::drawTexturedTriangle x1=" << x1 << " y1=" << y1 << " x2=" << x2 << " y2=" << y2 << " x3=" << x3 << " y3=" << y3 << std::endl;
-
-    if (!texture)
-    {
-        std::cout << "Display::drawTexturedTriangle !!! NULL texture" << std::endl;
-        return;
-    }
-
-    // convert X,Y's to integer to fix rounding issues that mess up drawing and later crash drawTexel()
-    p1.x = (int)p1.x;
-    p1.y = (int)p1.y;
-    p2.x = (int)p2.x;
-    p2.y = (int)p2.y;
-    p3.x = (int)p3.x;
-    p3.y = (int)p3.y;
-
-    /* sort the vectices by y-coord in asceding order (y1 < y2 < y3) */
-
-    if (p1.y > p2.y)
-    {
-        std::swap(p1.y, p2.y);
-        std::swap(p1.x, p2.x);
-        std::swap(p1.z, p2.z);
-        std::swap(p1.w, p2.w);
-
-
-        std::swap(uv1.u, uv2.u);
-        std::swap(uv1.v, uv2.v);
-    }
-
-    if (p2.y > p3.y)
-    {
-        std::swap(p2.y, p3.y);
-        std::swap(p2.x, p3.x);
-        std::swap(p2.z, p3.z);
-        std::swap(p2.w, p3.w);
-
-        std::swap(uv2.u, uv3.u);
-        std::swap(uv2.v, uv3.v);
-    }
-
-    if (p1.y > p2.y)
-    {
-        std::swap(p1.y, p2.y);
-        std::swap(p1.x, p2.x);
-        std::swap(p1.z, p2.z);
-        std::swap(p1.w, p2.w);
-
-        std::swap(uv1.u, uv2.u);
-        std::swap(uv1.v, uv2.v);
-    }
-
-    // flip the V component to account for inverted UV-coordinate system from .obj file (V grows downwards because origin is at thetop-left)
-    uv1.v = 1.f - uv1.v;
-    uv2.v = 1.f - uv2.v;
-    uv3.v = 1.f - uv3.v;
-
-    // identify vector points for barycentric coordinates computation in drawTexel()
-    Vec4d a = p1;
-    Vec4d b = p2;
-    Vec4d c = p3;
-
-    /* draw the upper part of the triangle (flat-bottom)
-     *
-     *           (x1,y1) (u1,v1)
-     *             o
-     *            . `.
-     *           .    `.
-     * (x2,y2) o.-------`o (mx,my)
-     * (u2,v2)   ` .      `.
-     *               ` .    `.
-     *                   ` .  `.
-     *                       ` .`.
-     *                           ` o (x3,y3)
-     *                               (u3,v3)
-     */
-
-    // retrieve the slopes of both legs of the upper triangle
-    float invLeftSlope = 0; // Dx / Dy
-    if ((int)(p2.y - p1.y) != 0)
-        invLeftSlope = (float)(p2.x-p1.x) / (float)std::abs(p2.y-p1.y);
-
-    float invRightSlope = 0; // Dx / Dy
-    if ((int)(p3.y - p1.y) != 0)
-        invRightSlope = (float)(p3.x-p1.x) / (float)std::abs(p3.y-p1.y);
-
-    // if (y2-y1) is zero, don't do any of this
-    if ((int)(p2.y - p1.y) != 0)
-    {
-        // loop through all the scanlines (top to bottom)
-        int xStart = 0, xEnd = 0;
-        for (int y = p1.y; y <= p2.y; ++y)
-        {
-            xStart = (p2.x) + (y - p2.y) * invLeftSlope;
-            xEnd   = (p1.x) + (y - p1.y) * invRightSlope;
-
-            // rotation of the triangle might cause xEnd to be before the xStart: hence the swap below
-            if (xEnd < xStart)
-                std::swap(xEnd, xStart);
-
-            for (int x = xStart; x <= xEnd; ++x)
-            {
-                // draw pixel using predefined color for testing
-                //drawPixel(x, y, 0xFFFFFF00); // yellow
-
-                // draw pixel using color from the texture
-                drawTexel(x, y, a, b, c, uv1, uv2, uv3, texture, textureWidth, textureHeight, fixDistortion);
-            }
-        }
-    }
-
-    /* draw the lower part of the triangle (flat-top) */
-
-    // retrieve the slopes of both legs of the lower triangle
-    invLeftSlope = 0; // Dx / Dy
-    if ((int)(p3.y - p2.y) != 0)
-        invLeftSlope = (float)(p3.x-p2.x) / (float)std::abs(p3.y-p2.y);
-
-    invRightSlope = 0; // Dx / Dy
-    if ((int)(p3.y - p1.y) != 0)
-        invRightSlope = (float)(p3.x-p1.x) / (float)std::abs(p3.y-p1.y);
-
-    // if (y3-y2) is zero, don't do scanlines
-    if ((int)(p3.y - p2.y) != 0)
-    {
-        // loop through all the scanlines (top to bottom)
-        int xStart = 0, xEnd = 0;
-        for (int y = p2.y; y <= p3.y; ++y)
-        {
-            xStart = p2.x + (y - p2.y) * invLeftSlope;
-            xEnd   = p1.x + (y - p1.y) * invRightSlope;
-
-            // rotation of the triangle might cause xEnd to be positioned before xStart: hence the swap below
-            if (xEnd < xStart)
-                std::swap(xEnd, xStart);
-
-            for (int x = xStart; x <= xEnd; ++x)
-            {
-                //std::cout << "Display::drawTexturedTriangle: flat-top x=" << 0 << " y=" << y << std::endl;
-
-                // draw pixel using color from the texture
-                //drawPixel(x, y, 0xFFFF00FF); // magenta
-
-                // draw pixel using color from the texture
-                drawTexel(x, y, a, b, c, uv1, uv2, uv3, texture, textureWidth, textureHeight, fixDistortion);
-            }
-        }
-    }
-}
+// Left-handed coordinate system: the Z value grows (+) towards the monitor.
+#include "display.h"
+#include "jobsystem.h"
+#include "tex2.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define HAS_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define HAS_SSE2 0
+#endif
+
+#define ORTHO 0
+
+#define BUFFER_ALIGNMENT 64         // the buffers start on a cache line boundary
+#define STRIDE_ALIGNMENT 16         // rows are padded to a multiple of 16 pixels (64 bytes) so they are all aligned too
+
+#define TILE_SIZE 64                // lazy clears work on tiles of TILE_SIZE x TILE_SIZE pixels
+#define TILE_COLOR_PENDING 0x1      // the color of the tile still needs to be cleared
+#define TILE_DEPTH_PENDING 0x2      // the depth of the tile still needs to be cleared
+
+#define RESOLVE_ROWS_PER_JOB 32     // rows of the visibility buffer shaded by a single job
+
+#define GRID_CELL_SIZE 25
+#define GRID_COLOR 0xFF808080       // gray
+
+
+bool USE_PAINTERS_ALGO = false;
+
+
+// alignedAlloc: allocate memory that starts on a BUFFER_ALIGNMENT boundary
+static void* alignedAlloc(const size_t& bytes)
+{
+#ifdef _MSC_VER
+    return _aligned_malloc(bytes, BUFFER_ALIGNMENT);
+#else
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, BUFFER_ALIGNMENT, bytes) != 0)
+        return nullptr;
+    return ptr;
+#endif
+}
+
+// alignedFree: release the memory allocated by alignedAlloc()
+static void alignedFree(void* ptr)
+{
+#ifdef _MSC_VER
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+#if HAS_SSE2 && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+    #define HAS_AVX2 1
+    #include <immintrin.h>
+    #ifdef _MSC_VER
+        #define TARGET_AVX2
+    #else
+        #define TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#else
+    #define HAS_AVX2 0
+#endif
+
+// fill32Scalar: write the same 32-bit value count times
+static void fill32Scalar(uint32_t* dst, const uint32_t& value, size_t count, const bool& stream)
+{
+    (void)stream;
+
+    for (size_t i = 0; i < count; ++i)
+        dst[i] = value;
+}
+
+#if HAS_SSE2
+/* fill32Sse2: the bulk of the buffer is written 16 bytes at a time, and streaming (non-temporal) stores can be used
+ * for full-screen clears so they don't evict the rest of the cache with data that won't be read soon.
+ */
+static void fill32Sse2(uint32_t* dst, const uint32_t& value, size_t count, const bool& stream)
+{
+    // scalar head: until dst is aligned to 16 bytes
+    while (count && ((uintptr_t)dst & 15))
+    {
+        *dst++ = value;
+        count--;
+    }
+
+    __m128i v = _mm_set1_epi32((int)value);
+    size_t blocks = count / 16; // 4 stores of 4 pixels each per iteration
+
+    if (stream)
+    {
+        for (size_t i = 0; i < blocks; ++i, dst += 16)
+        {
+            _mm_stream_si128((__m128i*)(dst + 0), v);
+            _mm_stream_si128((__m128i*)(dst + 4), v);
+            _mm_stream_si128((__m128i*)(dst + 8), v);
+            _mm_stream_si128((__m128i*)(dst + 12), v);
+        }
+
+        // make the streaming stores visible before anybody reads the buffer
+        _mm_sfence();
+    }
+    else
+    {
+        for (size_t i = 0; i < blocks; ++i, dst += 16)
+        {
+            _mm_store_si128((__m128i*)(dst + 0), v);
+            _mm_store_si128((__m128i*)(dst + 4), v);
+            _mm_store_si128((__m128i*)(dst + 8), v);
+            _mm_store_si128((__m128i*)(dst + 12), v);
+        }
+    }
+
+    // scalar tail
+    fill32Scalar(dst, value, count - blocks * 16, false);
+}
+#endif
+
+#if HAS_AVX2
+// fill32Avx2: same as fill32Sse2() with 32-byte stores (compiled for AVX2 whatever the flags of the rest of the file)
+TARGET_AVX2 static void fill32Avx2(uint32_t* dst, const uint32_t& value, size_t count, const bool& stream)
+{
+    // scalar head: until dst is aligned to 32 bytes
+    while (count && ((uintptr_t)dst & 31))
+    {
+        *dst++ = value;
+        count--;
+    }
+
+    __m256i v = _mm256_set1_epi32((int)value);
+    size_t blocks = count / 32; // 4 stores of 8 pixels each per iteration
+
+    if (stream)
+    {
+        for (size_t i = 0; i < blocks; ++i, dst += 32)
+        {
+            _mm256_stream_si256((__m256i*)(dst + 0), v);
+            _mm256_stream_si256((__m256i*)(dst + 8), v);
+            _mm256_stream_si256((__m256i*)(dst + 16), v);
+            _mm256_stream_si256((__m256i*)(dst + 24), v);
+        }
+
+        _mm_sfence();
+    }
+    else
+    {
+        for (size_t i = 0; i < blocks; ++i, dst += 32)
+        {
+            _mm256_store_si256((__m256i*)(dst + 0), v);
+            _mm256_store_si256((__m256i*)(dst + 8), v);
+            _mm256_store_si256((__m256i*)(dst + 16), v);
+            _mm256_store_si256((__m256i*)(dst + 24), v);
+        }
+    }
+
+    fill32Scalar(dst, value, count - blocks * 32, false);
+}
+#endif
+
+// the fill bound by Display::bindKernels(), SSE2 until then when it's compiled in
+typedef void (*Fill32Kernel)(uint32_t* dst, const uint32_t& value, size_t count, const bool& stream);
+#if HAS_SSE2
+static Fill32Kernel g_fill32 = fill32Sse2;
+#else
+static Fill32Kernel g_fill32 = fill32Scalar;
+#endif
+
+// fill32: write the same 32-bit value count times with the bound kernel
+static void fill32(uint32_t* dst, const uint32_t& value, size_t count, const bool& stream)
+{
+    g_fill32(dst, value, count, stream);
+}
+
+// fill32: float version, the value is written with its 32-bit pattern
+static void fill32(float* dst, const float& value, size_t count, const bool& stream)
+{
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    fill32(reinterpret_cast<uint32_t*>(dst), bits, count, stream);
+}
+
+// fill16: 16-bit version, pairs of values are written as 32-bit values
+static void fill16(uint16_t* dst, const uint16_t& value, size_t count, const bool& stream)
+{
+    if (count && ((uintptr_t)dst & 2))
+    {
+        *dst++ = value;
+        count--;
+    }
+
+    fill32(reinterpret_cast<uint32_t*>(dst), ((uint32_t)value << 16) | value, count / 2, stream);
+
+    if (count & 1)
+        dst[count - 1] = value;
+}
+
+
+/* Depth formats (see DEPTH_FORMAT): encode() turns the interpolated 1/w of a pixel into the value stored in the depth
+ * buffer, closer() is the comparison of DEPTH_LESS and clear() converts a depth from 0 (near) to 1 (far).
+ */
+
+// DepthFloat: 1 - 1/w, the format used before the others were added (bit by bit the same results)
+struct DepthFloat
+{
+    typedef float Type;
+
+    static Type encode(const float& reciprocalW, const float& zNear) { (void)zNear; return 1.0f - reciprocalW; }
+    static float decode(const Type& depth, const float& zNear) { (void)zNear; return 1.0f - depth; }
+    static bool closer(const Type& depth, const Type& stored) { return depth < stored; }
+    static Type clear(const float& depth) { return depth; }
+};
+
+// DepthUnorm16: 1 - zNear/w scaled to 16 bits, the near plane is 0
+struct DepthUnorm16
+{
+    typedef uint16_t Type;
+
+    static Type encode(const float& reciprocalW, const float& zNear)
+    {
+        float depth = std::min(std::max(1.0f - reciprocalW * zNear, 0.f), 1.f);
+        return (Type)(depth * 65535.f + 0.5f);
+    }
+
+    static float decode(const Type& depth, const float& zNear) { return (1.0f - depth / 65535.f) / zNear; }
+
+    static bool closer(const Type& depth, const Type& stored) { return depth < stored; }
+    static Type clear(const float& depth) { return (Type)(std::min(std::max(depth, 0.f), 1.f) * 65535.f + 0.5f); }
+};
+
+// DepthReversedFloat: zNear/w, the near plane is 1 and the values go towards 0 with the distance
+struct DepthReversedFloat
+{
+    typedef float Type;
+
+    static Type encode(const float& reciprocalW, const float& zNear) { return reciprocalW * zNear; }
+    static float decode(const Type& depth, const float& zNear) { return depth / zNear; }
+    static bool closer(const Type& depth, const Type& stored) { return depth > stored; }
+    static Type clear(const float& depth) { return 1.0f - depth; }
+};
+
+
+void Display::bindKernels(const CPU_LEVEL& level)
+{
+    (void)level;
+    CPU_LEVEL variant = CPU_SCALAR;
+    g_fill32 = fill32Scalar;
+
+#if HAS_SSE2
+    if (level >= CPU_SSE2)
+    {
+        variant = CPU_SSE2;
+        g_fill32 = fill32Sse2;
+    }
+#endif
+
+#if HAS_AVX2
+    if (level >= CPU_AVX2)
+    {
+        variant = CPU_AVX2;
+        g_fill32 = fill32Avx2;
+    }
+#endif
+
+    CpuDispatch::setKernel("clear", variant);
+}
+
+Display::Display()
+{
+    _colorBuffer = nullptr;
+    _depthBuffer = nullptr;
+    _triangleIdBuffer = nullptr;
+
+    _depthFunc = DEPTH_FUNC::DEPTH_LESS;
+    _depthFormat = DEPTH_FORMAT::DEPTH_FLOAT;
+    _zNear = 1.f;
+
+    _lazyClear = false;
+    _tilesX = _tilesY = 0;
+    _clearColor = 0xFF000000;
+    _clearDepth = 1.0f;
+    _clearGrid = false;
+    _rasterizedPixels = _shadedPixels = _writtenPixels = 0;
+
+    _screenWidth = _screenHeight = 0;
+    _stride = 0;
+    _capacity = 0;
+    _allocations = 0;
+
+    _scissorX1 = _scissorY1 = _scissorX2 = _scissorY2 = 0;
+    _bkgColor = 0xFFFFFFFF; // black
+    _fovFactor = 640;
+}
+
+Display::~Display()
+{
+    _freeBuffers();
+}
+
+void Display::setSize(const int& width, const int& height)
+{
+    std::cout << "Display::setSize: " << width << "x" << height << std::endl;
+
+    if ((width >= 0 && height >= 0) && (width != _screenWidth || height != _screenHeight))
+    {
+        _screenWidth = width;
+        _screenHeight = height;
+
+        // recreate the Color Buffer with the appropriate size
+        setup();
+    }
+}
+
+int Display::width()
+{
+    return _screenWidth;
+}
+
+int Display::height()
+{
+    return _screenHeight;
+}
+
+int Display::stride()
+{
+    return _stride;
+}
+
+int Display::allocations()
+{
+    return _allocations;
+}
+
+/* setup: prepares the buffers for the current screen size.
+ *
+ * Rows are padded to a multiple of STRIDE_ALIGNMENT pixels and all the buffers start on a 64-byte boundary.
+ * The buffers are only reallocated when the new size doesn't fit in the current capacity: shrinking the window,
+ * or growing it back within the capacity, reuses the same memory. When they must grow, some headroom is reserved
+ * so that dragging the border of the window doesn't reallocate on every resize event.
+ */
+void Display::setup()
+{
+    std::cout << "Display::setup" << std::endl;
+
+    _stride = ((_screenWidth + STRIDE_ALIGNMENT - 1) / STRIDE_ALIGNMENT) * STRIDE_ALIGNMENT;
+    size_t size = (size_t)_stride * _screenHeight;
+
+    if (size > _capacity || !_colorBuffer)
+    {
+        _freeBuffers();
+
+        // 25% of headroom, at least 1 pixel so that an empty screen still gets valid pointers
+        _capacity = std::max(size + size / 4, (size_t)1);
+        _allocations++;
+
+        std::cout << "Display::setup: allocating " << _capacity << " pixels per buffer (stride=" << _stride << ")" << std::endl;
+
+        // allocate color buffer
+        _colorBuffer = (uint32_t*)alignedAlloc(_capacity * sizeof(uint32_t));
+
+        // allocate z-buffer
+        _depthBuffer = (float*)alignedAlloc(_capacity * sizeof(float));
+
+        // allocate visibility buffer (triangle IDs)
+        _triangleIdBuffer = (uint32_t*)alignedAlloc(_capacity * sizeof(uint32_t));
+    }
+
+    // a new size invalidates the scissor rectangle
+    resetScissor();
+
+    // split the screen in tiles for the lazy clears
+    _tilesX = (_screenWidth + TILE_SIZE - 1) / TILE_SIZE;
+    _tilesY = (_screenHeight + TILE_SIZE - 1) / TILE_SIZE;
+    _tileFlags.assign(_tilesX * _tilesY, 0);
+
+    // clear with solid color
+    clearColorBuffer(_bkgColor);
+    clearDepthBuffer(1.0f); // depth values range from 0.0f (near) to 1.0f (far)
+    clearVisibilityBuffer();
+}
+
+void Display::_freeBuffers()
+{
+    if (_colorBuffer)
+        alignedFree(_colorBuffer);
+
+    if (_depthBuffer)
+        alignedFree(_depthBuffer);
+
+    if (_triangleIdBuffer)
+        alignedFree(_triangleIdBuffer);
+
+    _colorBuffer = nullptr;
+    _depthBuffer = nullptr;
+    _triangleIdBuffer = nullptr;
+    _capacity = 0;
+}
+
+// clearColorBuffer: input color is ARGB
+void Display::clearColorBuffer(const uint32_t& c)
+{
+    _clearColor = c;
+    _clearGrid = false;
+
+    // only the rows of the scissor rectangle are cleared (always eagerly: a partial redraw touches few pixels)
+    if (_scissorEnabled())
+    {
+        for (int y = _scissorY1; y < _scissorY2; ++y)
+            fill32(&_colorBuffer[_stride*y] + _scissorX1, c, _scissorX2 - _scissorX1, false);
+        return;
+    }
+
+    if (_lazyClear)
+    {
+        for (unsigned int i = 0; i < _tileFlags.size(); ++i)
+            _tileFlags[i] |= TILE_COLOR_PENDING;
+        return;
+    }
+
+    fill32(_colorBuffer, c, (size_t)_stride * _screenHeight, true);
+}
+
+// clearDepthBuffer: 0 (near) to 1 (far)
+void Display::clearDepthBuffer(const float& d)
+{
+    _clearDepth = d;
+
+    if (_scissorEnabled())
+    {
+        for (int y = _scissorY1; y < _scissorY2; ++y)
+            _fillDepth((size_t)_stride*y + _scissorX1, _scissorX2 - _scissorX1, false);
+        return;
+    }
+
+    if (_lazyClear)
+    {
+        for (unsigned int i = 0; i < _tileFlags.size(); ++i)
+            _tileFlags[i] |= TILE_DEPTH_PENDING;
+        return;
+    }
+
+    _fillDepth(0, (size_t)_stride * _screenHeight, true);
+}
+
+void Display::_fillDepth(const size_t& offset, const size_t& count, const bool& stream)
+{
+    switch (_depthFormat)
+    {
+        case DEPTH_FORMAT::DEPTH_UNORM16:
+            fill16(depthBuffer16() + offset, DepthUnorm16::clear(_clearDepth), count, stream);
+            break;
+
+        case DEPTH_FORMAT::DEPTH_REVERSED_FLOAT:
+            fill32(_depthBuffer + offset, DepthReversedFloat::clear(_clearDepth), count, stream);
+            break;
+
+        default:
+            fill32(_depthBuffer + offset, DepthFloat::clear(_clearDepth), count, stream);
+            break;
+    }
+}
+
+void Display::setDepthFormat(const DEPTH_FORMAT& format)
+{
+    _depthFormat = format;
+}
+
+DEPTH_FORMAT Display::depthFormat()
+{
+    return _depthFormat;
+}
+
+void Display::setNearPlane(const float& zNear)
+{
+    _zNear = zNear;
+}
+
+void Display::setLazyClear(const bool& enable)
+{
+    // the tiles that are still pending must receive their clear values before switching to eager clears
+    if (!enable)
+        resolveClears();
+
+    _lazyClear = enable;
+}
+
+bool Display::lazyClear()
+{
+    return _lazyClear;
+}
+
+void Display::setScissor(const int& x, const int& y, const int& w, const int& h)
+{
+    _scissorX1 = std::max(x, 0);
+    _scissorY1 = std::max(y, 0);
+    _scissorX2 = std::min(x + w, _screenWidth);
+    _scissorY2 = std::min(y + h, _screenHeight);
+
+    // an empty rectangle discards everything
+    _scissorX2 = std::max(_scissorX1, _scissorX2);
+    _scissorY2 = std::max(_scissorY1, _scissorY2);
+}
+
+void Display::resetScissor()
+{
+    _scissorX1 = 0;
+    _scissorY1 = 0;
+    _scissorX2 = _screenWidth;
+    _scissorY2 = _screenHeight;
+}
+
+// _scissorEnabled: true when the scissor rectangle is smaller than the screen
+bool Display::_scissorEnabled()
+{
+    return _scissorX1 > 0 || _scissorY1 > 0 || _scissorX2 < _screenWidth || _scissorY2 < _screenHeight;
+}
+
+void Display::resolveClears()
+{
+    if (!_lazyClear)
+        return;
+
+    /* the tiles of the same row are filled one scanline at a time: runs of consecutive pending tiles become a single
+     * long streaming fill, which is much friendlier to the memory system than filling each tile separately.
+     * Color and depth are filled in separate passes so that each pass writes a single sequential stream.
+     */
+    for (int ty = 0; ty < _tilesY; ++ty)
+    {
+        uint8_t* flags = &_tileFlags[_tilesX*ty];
+        int yEnd = std::min((ty + 1) * TILE_SIZE, _screenHeight);
+
+        for (int pending = TILE_COLOR_PENDING; pending <= TILE_DEPTH_PENDING; pending <<= 1)
+        {
+            for (int tx = 0; tx < _tilesX; )
+            {
+                if (!(flags[tx] & pending))
+                {
+                    tx++;
+                    continue;
+                }
+
+                // find the run of consecutive tiles with the same pending flag
+                int txEnd = tx + 1;
+                while (txEnd < _tilesX && (flags[txEnd] & pending))
+                    txEnd++;
+
+                int x = tx * TILE_SIZE;
+                int w = std::min(txEnd * TILE_SIZE, _screenWidth) - x;
+                int yStart = ty * TILE_SIZE;
+
+                // when the run covers the whole width of the screen its rows (+ padding) are contiguous in memory: fill them at once
+                bool fullRows = (w == _screenWidth);
+                int rows = fullRows ? 1 : yEnd - yStart;
+                size_t count = fullRows ? (size_t)_stride * (yEnd - yStart) : w;
+
+                for (int row = 0; row < rows; ++row)
+                {
+                    size_t offset = (size_t)_stride * (yStart + row) + x;
+
+                    if (pending == TILE_DEPTH_PENDING)
+                        _fillDepth(offset, count, true);
+                    else
+                        fill32(_colorBuffer + offset, _clearColor, count, true);
+                }
+
+                // the grid that drawGrid() postponed
+                if (pending == TILE_COLOR_PENDING && _clearGrid)
+                    for (int y = ((yStart + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE) * GRID_CELL_SIZE; y < yEnd; y += GRID_CELL_SIZE)
+                        for (int col = ((x + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE) * GRID_CELL_SIZE; col < x + w; col += GRID_CELL_SIZE)
+                            _colorBuffer[_stride*y+col] = GRID_COLOR;
+
+                tx = txEnd;
+            }
+        }
+
+        for (int tx = 0; tx < _tilesX; ++tx)
+            flags[tx] = 0;
+    }
+}
+
+// _touchTiles: clear the pending tiles that intersect the rectangle (x1,y1)-(x2,y2) before something is drawn there
+void Display::_touchTiles(int x1, int y1, int x2, int y2)
+{
+    if (!_lazyClear)
+        return;
+
+    // 1 extra pixel on each side covers the rounding of the scanlines
+    x1 = std::max(x1 - 1, 0);
+    y1 = std::max(y1 - 1, 0);
+    x2 = std::min(x2 + 1, _screenWidth - 1);
+    y2 = std::min(y2 + 1, _screenHeight - 1);
+
+    if (x1 > x2 || y1 > y2)
+        return;
+
+    for (int ty = y1 / TILE_SIZE; ty <= y2 / TILE_SIZE; ++ty)
+        for (int tx = x1 / TILE_SIZE; tx <= x2 / TILE_SIZE; ++tx)
+            if (_tileFlags[_tilesX*ty+tx])
+                _clearTile(tx, ty);
+}
+
+// _clearTile: fill a tile with the clear values (and the background grid) and mark it as cleared
+void Display::_clearTile(const int& tileX, const int& tileY)
+{
+    uint8_t& flags = _tileFlags[_tilesX*tileY+tileX];
+
+    int x = tileX * TILE_SIZE;
+    int y = tileY * TILE_SIZE;
+    int w = std::min(TILE_SIZE, _screenWidth - x);
+    int h = std::min(TILE_SIZE, _screenHeight - y);
+
+    for (int row = y; row < y + h; ++row)
+    {
+        if (flags & TILE_COLOR_PENDING)
+        {
+            uint32_t* colorRow = &_colorBuffer[_stride*row];
+            fill32(colorRow + x, _clearColor, w, false);
+
+            // the grid that drawGrid() postponed
+            if (_clearGrid && row % GRID_CELL_SIZE == 0)
+                for (int col = ((x + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE) * GRID_CELL_SIZE; col < x + w; col += GRID_CELL_SIZE)
+                    colorRow[col] = GRID_COLOR;
+        }
+
+        if (flags & TILE_DEPTH_PENDING)
+            _fillDepth((size_t)_stride*row + x, w, false);
+    }
+
+    flags = 0;
+}
+
+void Display::setDepthFunc(const DEPTH_FUNC& func)
+{
+    _depthFunc = func;
+}
+
+uint32_t* Display::colorBuffer()
+{
+    return _colorBuffer;
+}
+
+float* Display::depthBuffer()
+{
+    return _depthBuffer;
+}
+
+uint16_t* Display::depthBuffer16()
+{
+    return reinterpret_cast<uint16_t*>(_depthBuffer);
+}
+
+uint32_t* Display::triangleIdBuffer()
+{
+    return _triangleIdBuffer;
+}
+
+void Display::resetStats()
+{
+    _rasterizedPixels = 0;
+    _shadedPixels = 0;
+    _writtenPixels = 0;
+}
+
+uint64_t Display::rasterizedPixels()
+{
+    return _rasterizedPixels;
+}
+
+uint64_t Display::shadedPixels()
+{
+    return _shadedPixels;
+}
+
+uint64_t Display::writtenPixels()
+{
+    return _writtenPixels;
+}
+
+uint64_t Display::coveredPixels()
+{
+    switch (_depthFormat)
+    {
+        case DEPTH_FORMAT::DEPTH_UNORM16:           return _coveredPixels<DepthUnorm16>();
+        case DEPTH_FORMAT::DEPTH_REVERSED_FLOAT:    return _coveredPixels<DepthReversedFloat>();
+        default:                                    return _coveredPixels<DepthFloat>();
+    }
+}
+
+// _coveredPixels: the pixels closer than the far plane
+template <typename Depth>
+uint64_t Display::_coveredPixels()
+{
+    const typename Depth::Type* depthBuffer = reinterpret_cast<const typename Depth::Type*>(_depthBuffer);
+    const typename Depth::Type far = Depth::clear(1.0f);
+    uint64_t covered = 0;
+
+    for (int y = 0; y < _screenHeight; ++y)
+        for (int x = 0; x < _screenWidth; ++x)
+        {
+            // tiles that are still waiting for the lazy clear were not touched by any triangle
+            if (_lazyClear && (_tileFlags[_tilesX*(y/TILE_SIZE)+(x/TILE_SIZE)] & TILE_DEPTH_PENDING))
+                continue;
+
+            if (Depth::closer(depthBuffer[_stride*y+x], far))
+                covered++;
+        }
+
+    return covered;
+}
+
+void Display::reciprocalW(const int& y, const int& x1, const int& x2, float* values)
+{
+    switch (_depthFormat)
+    {
+        case DEPTH_FORMAT::DEPTH_UNORM16:
+            _reciprocalW<DepthUnorm16>(y, x1, x2, values);
+            break;
+
+        case DEPTH_FORMAT::DEPTH_REVERSED_FLOAT:
+            _reciprocalW<DepthReversedFloat>(y, x1, x2, values);
+            break;
+
+        default:
+            _reciprocalW<DepthFloat>(y, x1, x2, values);
+            break;
+    }
+}
+
+template <typename Depth>
+void Display::_reciprocalW(const int& y, const int& x1, const int& x2, float* values)
+{
+    const typename Depth::Type* depthRow = &_depthData<Depth>()[_stride * y];
+
+    for (int x = x1; x < x2; ++x)
+    {
+        // tiles still waiting for the lazy clear hold the depth of an older frame
+        if (_lazyClear && (_tileFlags[_tilesX*(y/TILE_SIZE)+(x/TILE_SIZE)] & TILE_DEPTH_PENDING))
+            values[x - x1] = 0.f;
+        else
+            values[x - x1] = Depth::decode(depthRow[x], _zNear);
+    }
+}
+
+void Display::drawGrid()
+{
+    //std::cout << "Display::drawGrid" << std::endl;
+
+    unsigned int cellSize = GRID_CELL_SIZE;
+
+    // only the dots inside of the scissor rectangle are drawn
+    if (_scissorEnabled())
+    {
+        int xStart = ((_scissorX1 + cellSize - 1) / cellSize) * cellSize;
+        int yStart = ((_scissorY1 + cellSize - 1) / cellSize) * cellSize;
+
+        for (int y = yStart; y < _scissorY2; y += cellSize)
+            for (int x = xStart; x < _scissorX2; x += cellSize)
+                _colorBuffer[_stride*y+x] = GRID_COLOR;
+        return;
+    }
+
+    // with lazy clears the grid is drawn by _clearTile() on the tiles that are still waiting to be cleared
+    _clearGrid = _lazyClear;
+
+    for (int y = 0; y < _screenHeight; y += cellSize)
+        for (int x = 0; x < _screenWidth; x+= cellSize)
+        {
+            if (_lazyClear && (_tileFlags[_tilesX*(y/TILE_SIZE)+(x/TILE_SIZE)] & TILE_COLOR_PENDING))
+                continue;
+
+            _colorBuffer[_stride*y+x] = GRID_COLOR;
+        }
+}
+
+#if ORTHO
+Vec2d Display::project(Vec3d p)
+{
+    // the bigger the Z values, the more they divide
+    return Vec2d(p.x * _fovFactor,
+                 p.y * _fovFactor);
+}
+#else
+// Weak Perspective Projection
+Vec2d Display::project(Vec3d p)
+{
+    // the bigger the Z values, the more they divide
+    return Vec2d(p.x * _fovFactor / p.z,    // Perspective Divide: P'x = Px / Pz
+                 p.y * _fovFactor / p.z);   // Perspective Divide: P'y = Py / Pz
+}
+#endif
+
+void Display::drawPixel(const int& x, const int& y, const uint32_t& color)
+{
+    //std::cout << "drawPixel: x=" << x << " y=" << y << " color=0x" << std::hex << color << std::dec << std::endl;
+
+    if (x < _scissorX1 || x >= _scissorX2 || y < _scissorY1 || y >= _scissorY2)
+        return;
+
+    // set pixel at row 10 column 20 to red: _stride*10+20
+    _colorBuffer[_stride*y+x] = color;
+}
+
+template <typename Depth>
+void Display::_drawPixel(const int& x, const int& y, const Vec4d& a, const Vec4d& b, const Vec4d& c, const uint32_t& color)
+{
+    // define the center of the baricentric coordinate computation and retrieve the weights at this position
+    Vec2d p(x, y);
+    Vec3d weights = _barycentricWeights(Vec4d::toVec2d(a), Vec4d::toVec2d(b), Vec4d::toVec2d(c), p);
+
+    //std::cout << "------------------------------------------------------------" << std::endl;
+    //std::cout << "drawPixel:  xy @ " << x << "," << y << "  a=" << a << " b=" << b << " c=" << c << " p=" << p << std::endl;
+
+    float alpha = weights.x;
+    float beta = weights.y;
+    float gamma = weights.z;
+    //std::cout << "drawPixel: alpha=" << alpha << " beta=" << beta << " gamma=" << gamma << std::endl;
+
+    // Check if the values of alpha beta and gamma are valid
+    const float EPSILON = 0.0000001f;
+    if (alpha < -EPSILON || beta < -EPSILON || gamma < -EPSILON)
+        return;
+
+    // pixels outside of the screen (or the scissor) are discarded (wrapping them around would write depth on some other row)
+    if (x < _scissorX1 || x >= _scissorX2 || y < _scissorY1 || y >= _scissorY2)
+        return;
+
+    // interpolate the value of 1/w for the current pixel (converted to a depth value)
+    typename Depth::Type depth = _interpolateDepth<Depth>(weights, a, b, c);
+    int bufferIdx = (_stride * y) + x;
+    _rasterizedPixels++;
+
+    if (_depthTest<Depth>(depth, bufferIdx))
+    {
+        // draw the pixel
+        drawPixel(x, y, color);
+        _writtenPixels++;
+
+        // update z-buffer with this pixel's 1/w
+        _depthData<Depth>()[bufferIdx] = depth;
+    }
+}
+
+void Display::drawPixel(const int& x, const int& y, const Vec4d& a, const Vec4d& b, const Vec4d& c, const uint32_t& color)
+{
+    switch (_depthFormat)
+    {
+        case DEPTH_FORMAT::DEPTH_UNORM16:
+            _drawPixel<DepthUnorm16>(x, y, a, b, c, color);
+            break;
+
+        case DEPTH_FORMAT::DEPTH_REVERSED_FLOAT:
+            _drawPixel<DepthReversedFloat>(x, y, a, b, c, color);
+            break;
+
+        default:
+            _drawPixel<DepthFloat>(x, y, a, b, c, color);
+            break;
+    }
+}
+
+template <typename Depth>
+void Display::_drawPixel(const int& x, const int& y, const Vec4d& a, const Vec4d& b, const Vec4d& c,
+                         const uint32_t& a_color, const uint32_t& b_color, const uint32_t& c_color)
+{
+    Vec2d p(x, y);
+    Vec3d weights = _barycentricWeights(Vec4d::toVec2d(a), Vec4d::toVec2d(b), Vec4d::toVec2d(c), p);
+
+    // same coverage test of the flat drawPixel()
+    const float EPSILON = 0.0000001f;
+    if (weights.x < -EPSILON || weights.y < -EPSILON || weights.z < -EPSILON)
+        return;
+
+    if (x < _scissorX1 || x >= _scissorX2 || y < _scissorY1 || y >= _scissorY2)
+        return;
+
+    typename Depth::Type depth = _interpolateDepth<Depth>(weights, a, b, c);
+    int bufferIdx = (_stride * y) + x;
+    _rasterizedPixels++;
+
+    if (!_depthTest<Depth>(depth, bufferIdx))
+        return;
+
+    // perspective correct interpolation: the colors are divided by w at the vertices and multiplied back by w here
+    float wa = weights.x / a.w, wb = weights.y / b.w, wc = weights.z / c.w;
+    float w = 1.f / (wa + wb + wc);
+    wa *= w; wb *= w; wc *= w;
+
+    uint32_t color = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        float channel = ((a_color >> shift) & 0xFF) * wa + ((b_color >> shift) & 0xFF) * wb + ((c_color >> shift) & 0xFF) * wc;
+        color |= (uint32_t)std::min(std::max(channel + 0.5f, 0.f), 255.f) << shift;
+    }
+
+    drawPixel(x, y, color);
+    _writtenPixels++;
+
+    _depthData<Depth>()[bufferIdx] = depth;
+}
+
+void Display::drawPixel(const int& x, const int& y, const Vec4d& a, const Vec4d& b, const Vec4d& c,
+                        const uint32_t& a_color, const uint32_t& b_color, const uint32_t& c_color)
+{
+    switch (_depthFormat)
+    {
+        case DEPTH_FORMAT::DEPTH_UNORM16:
+            _drawPixel<DepthUnorm16>(x, y, a, b, c, a_color, b_color, c_color);
+            break;
+
+        case DEPTH_FORMAT::DEPTH_REVERSED_FLOAT:
+            _drawPixel<DepthReversedFloat>(x, y, a, b, c, a_color, b_color, c_color);
+            break;
+
+        default:
+            _drawPixel<DepthFloat>(x, y, a, b, c, a_color, b_color, c_color);
+            break;
+    }
+}
+
+/* _interpolateDepth: interpolate the value of 1/w at the pixel and return it as a depth value.
+ * Every kernel must compute depth through this function so that the Z-prepass and the color pass agree bit by bit.
+ *
+ * Keep in mind that because the reciprocal is being calculated, the closer a vertex is to the camera
+ * the higher its 1/w value is going to be (i.e. 0.25). The furthest a vertex is, the smaller its 1/w is going to be (i.e. 0.17).
+ * Adjust interpolated reciprocal of w to compensate for that, so depth values range from 0.0f (near) to 1.0f (far).
+ */
+template <typename Depth>
+typename Depth::Type Display::_interpolateDepth(const Vec3d& weights, const Vec4d& a, const Vec4d& b, const Vec4d& c)
+{
+    float interpolated_reciprocal_w = (1.f / a.w) * weights.x + (1.f / b.w) * weights.y + (1.f / c.w) * weights.z;
+    return Depth::encode(interpolated_reciprocal_w, _zNear);
+}
+
+// _depthTest: draw the pixel only if its depth passes the current depth function
+template <typename Depth>
+bool Display::_depthTest(const typename Depth::Type& depth, const int& bufferIdx)
+{
+    if (_depthFunc == DEPTH_FUNC::DEPTH_EQUAL)
+        return depth == _depthData<Depth>()[bufferIdx];
+
+    return Depth::closer(depth, _depthData<Depth>()[bufferIdx]);
+}
+
+/* Return the barycentric weights (alpha, beta, gamma) for point P inside triangle ABC.
+ * An alternative to texture interpolation.
+ *
+ *                 A
+ *                 o
+ *                /|`.
+ *               / |  `.
+ *              /𝛾 |   β`.
+ *             / .(P).    `.
+ *         B  o´      ` .   `.
+ *             `---_   α ` .  `.
+ *                   ---_   ` . `.
+ *                        ---_  `.`.
+ *                             ---_`o  C
+ */
+Vec3d Display::_barycentricWeights(const Vec2d& a, const Vec2d& b, const Vec2d& c, const Vec2d& p)
+{
+    // find the vectors between vertices ABC and point P
+    Vec2d ab = b.sub(a);
+    Vec2d ac = c.sub(a);
+    Vec2d bc = c.sub(b);
+
+    Vec2d ap = p.sub(a);
+    Vec2d bp = p.sub(b);
+
+    // calculate the area of the ABC triangle using cross product (area of paralellogram)
+    float triangleABCarea = (ab.x * ac.y - ab.y * ac.x);
+
+    // weight alpha is the area of the subtriangle BCP divided by the area of the (full) triangle ABC
+    float alpha = (bc.x * bp.y - bp.x * bc.y) / triangleABCarea;
+
+    // weight beta is the area of the subtriangle ACP divided by the area of the (full) triangle ABC
+    float beta = (ap.x * ac.y - ac.x * ap.y) / triangleABCarea;
+
+    // weight gamma is easily found since barycentric coordinates always add up to 1
+    float gamma = 1 - alpha - beta;
+
+    Vec3d weights(alpha, beta, gamma);
+    return weights;
+}
+
+template <typename Depth>
+void Display::_drawTexel(const int& x, const int& y,
+                         const Vec4d& a, const Vec4d& b, const Vec4d& c,
+                         const Tex2& a_uv, const Tex2& b_uv, const Tex2& c_uv,
+                         const uint32_t* texture, const int& textureWidth, const int& textureHeight,
+                         const bool& fixDistortion)
+{
+    // define the center of the baricentric coordinate computation and retrieve the weights at this position
+    Vec2d p(x, y);
+    Vec3d weights = _barycentricWeights(Vec4d::toVec2d(a), Vec4d::toVec2d(b), Vec4d::toVec2d(c), p);
+
+    //std::cout << "------------------------------------------------------------" << std::endl;
+    //std::cout << "drawTexel:  xy @ " << x << "," << y << "  a=" << a << " b=" << b << " c=" << c << " p=" << p << std::endl;
+
+    // pixels outside of the screen (or the scissor) are discarded (wrapping them around would write depth on some other row)
+    if (x < _scissorX1 || x >= _scissorX2 || y < _scissorY1 || y >= _scissorY2)
+        return;
+
+    // draw the pixel only of the depth value is less than what's already stored in the depth buffer
+    typename Depth::Type depth = _interpolateDepth<Depth>(weights, a, b, c);
+    int bufferIdx = (_stride * y) + x;
+    _rasterizedPixels++;
+
+    // the depth test runs before the texel is fetched: hidden pixels don't pay for the texture lookup
+    if (_depthTest<Depth>(depth, bufferIdx))
+    {
+        uint32_t color = _sampleTexture(weights, a, b, c, a_uv, b_uv, c_uv, texture, textureWidth, textureHeight, fixDistortion);
+        _shadedPixels++;
+
+        // draw the pixel
+        drawPixel(x, y, color);
+        _writtenPixels++;
+
+        // update z-buffer with this pixel's 1/w
+        _depthData<Depth>()[bufferIdx] = depth;
+    }
+}
+
+void Display::drawTexel(const int& x, const int& y,
+                        const Vec4d& a, const Vec4d& b, const Vec4d& c,
+                        const Tex2& a_uv, const Tex2& b_uv, const Tex2& c_uv,
+                        const uint32_t* texture, const int& textureWidth, const int& textureHeight,
+                        const bool& fixDistortion)
+{
+    switch (_depthFormat)
+    {
+        case DEPTH_FORMAT::DEPTH_UNORM16:
+            _drawTexel<DepthUnorm16>(x, y, a, b, c, a_uv, b_uv, c_uv, texture, textureWidth, textureHeight, fixDistortion);
+            break;
+
+        case DEPTH_FORMAT::DEPTH_REVERSED_FLOAT:
+            _drawTexel<DepthReversedFloat>(x, y, a, b, c, a_uv, b_uv, c_uv, texture, textureWidth, textureHeight, fixDistortion);
+            break;
+
+        default:
+            _drawTexel<DepthFloat>(x, y, a, b, c, a_uv, b_uv, c_uv, texture, textureWidth, textureHeight, fixDistortion);
+            break;
+    }
+}
+
+/* _sampleTexture: interpolates the U,V coordinates of a pixel using its barycentric weights and
+ * returns the color stored in the texture at that position.
+ */
+uint32_t Display::_sampleTexture(const Vec3d& weights,
+                                 const Vec4d& a, const Vec4d& b, const Vec4d& c,
+                                 const Tex2& a_uv, const Tex2& b_uv, const Tex2& c_uv,
+                                 const uint32_t* texture, const int& textureWidth, const int& textureHeight,
+                                 const bool& fixDistortion)
+{
+    //std::cout << "drawTexel: uv1 @ " << u1 << "," << v1 << "  uv2 @ " << u2 << "," << v2 << "  uv3 @ " << u3 << "," << v3 << std::endl;
+
+    float alpha = weights.x;
+    float beta = weights.y;
+    float gamma = weights.z;
+    //std::cout << "drawTexel: alpha=" << alpha << " beta=" << beta << " gamma=" << gamma << std::endl;
+
+    // preventing texture buffer overflow: actually disabled this for the modulus operation at the end
+//    const float EPS = 0.00001f;
+//    if (alpha < EPS || beta < EPS || gamma < EPS)
+//        return;
+
+    float interpolated_u = 0;
+    float interpolated_v = 0;
+    float interpolated_reciprocal_w = 0;
+
+    // TODO: calculate interpolated_reciprocal_w before drawTexel() so it is calculated only once per triangle instead of for every pixel
+    if (!fixDistortion)
+    {
+        // calculate the interpolation of U,V coords using barycentric weights (with perspective distortion bug)
+        interpolated_u = (a_uv.u * alpha) + (b_uv.u * beta) + (c_uv.u * gamma);
+        interpolated_v = (a_uv.v * alpha) + (b_uv.v * beta) + (c_uv.v * gamma);
+    }
+    else
+    {
+        /* calculate the interpolation of U,V coords using barycentric weights (perspective distortion fixed)
+         *      1. Use the reciprocal of all attributes (1/w)
+         *      2. Interpolate over the triangle face
+         *      3. Divide all the attributes by 1/w (undoes the perspective transform)
+         */
+        interpolated_u = (a_uv.u / a.w) * alpha + (b_uv.u / b.w) * beta + (c_uv.u / c.w) * gamma;
+        interpolated_v = (a_uv.v / a.w) * alpha + (b_uv.v / b.w) * beta + (c_uv.v / c.w) * gamma;
+        interpolated_reciprocal_w = (1.f / a.w) * alpha + (1.f / b.w) * beta + (1.f / c.w) * gamma;
+
+        interpolated_u /= interpolated_reciprocal_w;
+        interpolated_v /= interpolated_reciprocal_w;
+    }
+
+    //std::cout << "drawTexel: interpolated_u=" << interpolated_u << " interpolated_v=" << interpolated_v << std::endl;
+
+    // map X,Y position to the full texture size
+    int texX = std::abs((int)(interpolated_u * textureWidth));
+    int texY = std::abs((int)(interpolated_v * textureHeight));
+    int texIndex = ((textureWidth * texY) + texX) % (textureWidth * textureHeight);
+    uint32_t color = (uint32_t) texture[texIndex];
+    //printf("1D=%d stores=0x%08x\n", ((textureWidth * texY) + texX), texture[(textureWidth * texY)+texX]);
+    //std::cout << "drawTexel: texcoord @ " << texX << "," << texY << " texColor=0x" << std::hex << color << std::dec << std::endl;
+
+
+    // DEBUG: first pixel on the top-left of the 1st rendered face
+    /*
+    if (texIndex > 4090)
+    {
+        std::cout << "------------------------------------------------------------" << std::endl;
+        std::cout << "drawTexel:  xy @ " << x << "," << y << "  a=" << a << " b=" << b << " c=" << c << " p=" << p << std::endl;
+        std::cout << "drawTexel: uv1 @ " << u1 << "," << v1 << "  uv2 @ " << u2 << "," << v2 << "  uv3 @ " << u3 << "," << v3 << std::endl;
+        std::cout << "drawTexel: alpha=" << alpha << " beta=" << beta << " gamma=" << gamma << std::endl;
+        std::cout << "drawTexel: interpolated_u=" << interpolated_u << " interpolated_v=" << interpolated_v << std::endl;
+        std::cout << "drawTexel: texcoord @ " << texX << "," << texY << "  texIndex=" << texIndex << "  texColor=0x" << std::hex << color << std::dec << std::endl;
+        //QThread::currentThread()->msleep(30000);
+    }
+    */
+
+    return color;
+}
+
+// DDA algorithm: Digital Diferential Analyser
+void Display::drawLine(const int& x1, const int& y1, const int& x2, const int& y2, const uint32_t& color)
+{
+    //std::cout << "drawLine: x1,y1=" << x1 << "," << y1 << " x2,y2=" << x2 << "," << y2 << std::endl;
+
+    // clear the tiles covered by the line before drawing on them (lazy clears)
+    _touchTiles(std::min(x1, x2), std::min(y1, y2), std::max(x1, x2), std::max(y1, y2));
+
+    // Line equation: y = mx + c
+    //      m = slope, calculated as: Dy / Dx (opposite side of the triangle DIVIDED BY the adjacent side)
+    //      c = y-intercept
+    int dx = x2 - x1;
+    int dy = y2 - y1;
+
+    // longest side length: how much to run
+    int sideLen = (std::abs(dx) >= std::abs(dy)) ? std::abs(dx) : std::abs(dy);
+
+    // size of the increment step
+    float xInc = dx / (float) sideLen;
+    float yInc = dy / (float) sideLen;
+
+    //std::cout << "drawLine: dx=" << dx << " dy=" << dy << " xInc=" << xInc << " yInc=" << yInc << std::endl;
+
+    float curX = (float)x1;
+    float curY = (float)y1;
+
+    for (int i = 0; i <= sideLen; ++i)
+    {
+        //std::cout << "drawLine: round(curX)=" << std::round(curX) << " round(curY)=" << std::round(curY) << std::endl;
+        drawPixel((int)std::round(curX), (int)std::round(curY), color);
+        curX += xInc;
+        curY += yInc;
+    }
+}
+
+void Display::drawRect(const int& x, const int& y, const int& w, const int& h, const uint32_t& color)
+{
+    //std::cout << "Display::drawRect rect x=" << x << " y=" << y << " w=" << w << " h=" << h << std::endl;
+
+    if (x < 0 || x >= _screenWidth || y < 0 || y >= _screenHeight)
+        return;
+
+    // clear the tiles covered by the rectangle before drawing on them (lazy clears)
+    _touchTiles(x, y, x + w - 1, y + h - 1);
+
+    int curX = 0;
+    int curY = 0;
+
+    for (int i = 0; i < w; ++i)
+        for (int j = 0; j < h; ++j)
+        {
+            //_colorBuffer[_stride*(y+j)+(x+i)] = color;
+
+            curX = x + i;
+            curY = y + j;
+            drawPixel(curX, curY, color);
+        }
+}
+
+void Display::drawTriangle(const int& x1, const int& y1, const int& x2, const int& y2, const int& x3, const int& y3, const uint32_t& color)
+{
+    //std::cout << "Display::drawTriangle x1=" << x1 << " y1=" << y1 << " x2=" << x2 << " y2=" << y2 << " x3=" << x3 << " y3=" << y3 << std::endl;
+    drawLine(x1, y1, x2, y2, color);
+    drawLine(x2, y2, x3, y3, color);
+    drawLine(x3, y3, x1, y1, color);
+}
+
+/* fillTriangle: triangle rasterization (flat-bottom & flat-top approach)
+ * Split the triangle in two, half flat-bottom and half flat-top
+ *
+ *              (x1, y1)
+ *                 o
+ *                / \
+ *              /    \               FLAT BOTTOM
+ *            /       \
+ *   (x2,y2) o - - - - o (Mx,My)                            Mx = (x3-x1) (y2-y1)
+ *           `.         \                                        -------------- + x1
+ *             `.        \                                           (y3-y1)
+ *               `.       \
+ *                 `.      \
+ *                   `.     \        FLAT TOP
+ *                     `.    \
+ *                       `.   \
+ *                         `.  \
+ *                           `. \
+ *                             ` o (x3,y3)
+ */
+template <typename Depth>
+void Display::_fillTriangle(Vec4d p1, Vec4d p2, Vec4d p3, const uint32_t& color)
+{
+    // convert X,Y's to integer to fix rounding issues that mess up drawing and later crash drawPixel()
+    p1.x = (int)p1.x;
+    p1.y = (int)p1.y;
+    p2.x = (int)p2.x;
+    p2.y = (int)p2.y;
+    p3.x = (int)p3.x;
+    p3.y = (int)p3.y;
+
+    if (p1.y > p2.y)
+    {
+        std::swap(p1.y, p2.y);
+        std::swap(p1.x, p2.x);
+        std::swap(p1.z, p2.z);
+        std::swap(p1.w, p2.w);
+    }
+
+    if (p2.y > p3.y)
+    {
+        std::swap(p2.y, p3.y);
+        std::swap(p2.x, p3.x);
+        std::swap(p2.z, p3.z);
+        std::swap(p2.w, p3.w);
+    }
+
+    if (p1.y > p2.y)
+    {
+        std::swap(p1.y, p2.y);
+        std::swap(p1.x, p2.x);
+        std::swap(p1.z, p2.z);
+        std::swap(p1.w, p2.w);
+    }
+
+    // clear the tiles covered by the triangle before drawing on them (lazy clears)
+    _touchTiles(std::min(std::min(p1.x, p2.x), p3.x), p1.y, std::max(std::max(p1.x, p2.x), p3.x), p3.y);
+
+    // identify vector points for barycentric coordinates computation in drawTexel()
+    Vec4d a = p1;
+    Vec4d b = p2;
+    Vec4d c = p3;
+
+    /* draw the upper part of the triangle (flat-bottom) */
+
+    // retrieve the slopes of both legs of the upper triangle
+    float invLeftSlope = 0; // Dx / Dy
+    if ((int)(p2.y - p1.y) != 0)
+        invLeftSlope = (p2.x-p1.x) / (float)std::abs(p2.y-p1.y);
+
+    float invRightSlope = 0; // Dx / Dy
+    if ((int)(p3.y - p1.y) != 0)
+        invRightSlope = (p3.x-p1.x) / (float)std::abs(p3.y-p1.y);
+
+    // if (y2-y1) is zero, don't do any of this
+    if ((int)(p2.y - p1.y) != 0)
+    {
+        // loop through all the scanlines (top to bottom)
+        int xStart = 0, xEnd = 0;
+        for (int y = p1.y; y <= (int)p2.y; ++y)
+        {
+            xStart = p2.x + (int)(y - p2.y) * invLeftSlope;
+            xEnd   = p1.x + (int)(y - p1.y) * invRightSlope;
+
+            // rotation of the triangle might cause xEnd to be before the xStart: hence the swap below
+            if (xEnd < xStart)
+                std::swap(xEnd, xStart);
+
+            for (int x = xStart; x <= xEnd; ++x)
+            {
+                // draw pixel using the desired color
+                _drawPixel<Depth>(x, y, a, b, c, color);
+            }
+        }
+    }
+
+    /* draw the lower part of the triangle (flat-top) */
+
+    // retrieve the slopes of both legs of the lower triangle
+    invLeftSlope = 0; // Dx / Dy
+    if ((int)(p3.y - p2.y) != 0)
+        invLeftSlope = (p3.x-p2.x) / (float)std::abs(p3.y-p2.y);
+
+    invRightSlope = 0; // Dx / Dy
+    if ((int)(p3.y - p1.y) != 0)
+        invRightSlope = (p3.x-p1.x) / (float)std::abs(p3.y-p1.y);
+
+    // if (y3-y2) is zero, don't do scanlines
+    if ((int)(p3.y - p2.y) != 0)
+    {
+        // loop through all the scanlines (top to bottom)
+        int xStart = 0, xEnd = 0;
+        for (int y = p2.y; y <= (int)p3.y; ++y)
+        {
+            xStart = p2.x + (int)(y - p2.y) * invLeftSlope;
+            xEnd   = p1.x + (int)(y - p1.y) * invRightSlope;
+
+            // rotation of the triangle might cause xEnd to be positioned before xStart: hence the swap below
+            if (xEnd < xStart)
+                std::swap(xEnd, xStart);
+
+            for (int x = xStart; x <= xEnd; ++x)
+            {
+                // draw pixel using the desired color
+                _drawPixel<Depth>(x, y, a, b, c, color);
+            }
+        }
+    }
+}
+
+void Display::fillTriangle(Vec4d p1, Vec4d p2, Vec4d p3, const uint32_t& color)
+{
+    switch (_depthFormat)
+    {
+        case DEPTH_FORMAT::DEPTH_UNORM16:
+            _fillTriangle<DepthUnorm16>(p1, p2, p3, color);
+            break;
+
+        case DEPTH_FORMAT::DEPTH_REVERSED_FLOAT:
+            _fillTriangle<DepthReversedFloat>(p1, p2, p3, color);
+            break;
+
+        default:
+            _fillTriangle<DepthFloat>(p1, p2, p3, color);
+            break;
+    }
+}
+
+/* fillTriangle (Gouraud shading): same scanlines and depth test of the flat fillTriangle() (so the Z-prepass matches
+ * it too), but the color of each pixel is interpolated from the colors of the 3 vertices.
+ */
+template <typename Depth>
+void Display::_fillTriangle(Vec4d p1, Vec4d p2, Vec4d p3, uint32_t c1, uint32_t c2, uint32_t c3)
+{
+    // convert X,Y's to integer to fix rounding issues that mess up drawing and later crash drawPixel()
+    p1.x = (int)p1.x;
+    p1.y = (int)p1.y;
+    p2.x = (int)p2.x;
+    p2.y = (int)p2.y;
+    p3.x = (int)p3.x;
+    p3.y = (int)p3.y;
+
+    if (p1.y > p2.y)
+    {
+        std::swap(p1.y, p2.y);
+        std::swap(p1.x, p2.x);
+        std::swap(p1.z, p2.z);
+        std::swap(p1.w, p2.w);
+        std::swap(c1, c2);
+    }
+
+    if (p2.y > p3.y)
+    {
+        std::swap(p2.y, p3.y);
+        std::swap(p2.x, p3.x);
+        std::swap(p2.z, p3.z);
+        std::swap(p2.w, p3.w);
+        std::swap(c2, c3);
+    }
+
+    if (p1.y > p2.y)
+    {
+        std::swap(p1.y, p2.y);
+        std::swap(p1.x, p2.x);
+        std::swap(p1.z, p2.z);
+        std::swap(p1.w, p2.w);
+        std::swap(c1, c2);
+    }
+
+    // clear the tiles covered by the triangle before drawing on them (lazy clears)
+    _touchTiles(std::min(std::min(p1.x, p2.x), p3.x), p1.y, std::max(std::max(p1.x, p2.x), p3.x), p3.y);
+
+    // identify vector points for barycentric coordinates computation in drawTexel()
+    Vec4d a = p1;
+    Vec4d b = p2;
+    Vec4d c = p3;
+
+    /* draw the upper part of the triangle (flat-bottom) */
+
+    // retrieve the slopes of both legs of the upper triangle
+    float invLeftSlope = 0; // Dx / Dy
+    if ((int)(p2.y - p1.y) != 0)
+        invLeftSlope = (p2.x-p1.x) / (float)std::abs(p2.y-p1.y);
+
+    float invRightSlope = 0; // Dx / Dy
+    if ((int)(p3.y - p1.y) != 0)
+        invRightSlope = (p3.x-p1.x) / (float)std::abs(p3.y-p1.y);
+
+    // if (y2-y1) is zero, don't do any of this
+    if ((int)(p2.y - p1.y) != 0)
+    {
+        // loop through all the scanlines (top to bottom)
+        int xStart = 0, xEnd = 0;
+        for (int y = p1.y; y <= (int)p2.y; ++y)
+        {
+            xStart = p2.x + (int)(y - p2.y) * invLeftSlope;
+            xEnd   = p1.x + (int)(y - p1.y) * invRightSlope;
+
+            // rotation of the triangle might cause xEnd to be before the xStart: hence the swap below
+            if (xEnd < xStart)
+                std::swap(xEnd, xStart);
+
+            for (int x = xStart; x <= xEnd; ++x)
+            {
+                // draw pixel blending the colors of the vertices
+                _drawPixel<Depth>(x, y, a, b, c, c1, c2, c3);
+            }
+        }
+    }
+
+    /* draw the lower part of the triangle (flat-top) */
+
+    // retrieve the slopes of both legs of the lower triangle
+    invLeftSlope = 0; // Dx / Dy
+    if ((int)(p3.y - p2.y) != 0)
+        invLeftSlope = (p3.x-p2.x) / (float)std::abs(p3.y-p2.y);
+
+    invRightSlope = 0; // Dx / Dy
+    if ((int)(p3.y - p1.y) != 0)
+        invRightSlope = (p3.x-p1.x) / (float)std::abs(p3.y-p1.y);
+
+    // if (y3-y2) is zero, don't do scanlines
+    if ((int)(p3.y - p2.y) != 0)
+    {
+        // loop through all the scanlines (top to bottom)
+        int xStart = 0, xEnd = 0;
+        for (int y = p2.y; y <= (int)p3.y; ++y)
+        {
+            xStart = p2.x + (int)(y - p2.y) * invLeftSlope;
+            xEnd   = p1.x + (int)(y - p1.y) * invRightSlope;
+
+            // rotation of the triangle might cause xEnd to be positioned before xStart: hence the swap below
+            if (xEnd < xStart)
+                std::swap(xEnd, xStart);
+
+            for (int x = xStart; x <= xEnd; ++x)
+            {
+                // draw pixel blending the colors of the vertices
+                _drawPixel<Depth>(x, y, a, b, c, c1, c2, c3);
+            }
+        }
+    }
+}
+
+void Display::fillTriangle(Vec4d p1, Vec4d p2, Vec4d p3, uint32_t c1, uint32_t c2, uint32_t c3)
+{
+    switch (_depthFormat)
+    {
+        case DEPTH_FORMAT::DEPTH_UNORM16:
+            _fillTriangle<DepthUnorm16>(p1, p2, p3, c1, c2, c3);
+            break;
+
+        case DEPTH_FORMAT::DEPTH_REVERSED_FLOAT:
+            _fillTriangle<DepthReversedFloat>(p1, p2, p3, c1, c2, c3);
+            break;
+
+        default:
+            _fillTriangle<DepthFloat>(p1, p2, p3, c1, c2, c3);
+            break;
+    }
+}
+
+// Draw textured triangle using flat-top/flat-bottom method
+template <typename Depth>
+void Display::_drawTexturedTriangle(Vec4d p1, Vec4d p2, Vec4d p3,
+                                    Tex2 uv1, Tex2 uv2, Tex2 uv3,
+                                    const uint32_t* texture, const int& textureWidth, const int& textureHeight,
+                                    const bool& fixDistortion)
+{
+    //std::cout << "Display::drawTexturedTriangle x1=" << x1 << " y1=" << y1 << " x2=" << x2 << " y2=" << y2 << " x3=" << x3 << " y3=" << y3 << std::endl;
+
+    if (!texture)
+    {
+        std::cout << "Display::drawTexturedTriangle !!! NULL texture" << std::endl;
+        return;
+    }
+
+    // convert X,Y's to integer to fix rounding issues that mess up drawing and later crash drawTexel()
+    p1.x = (int)p1.x;
+    p1.y = (int)p1.y;
+    p2.x = (int)p2.x;
+    p2.y = (int)p2.y;
+    p3.x = (int)p3.x;
+    p3.y = (int)p3.y;
+
+    /* sort the vectices by y-coord in asceding order (y1 < y2 < y3) */
+
+    if (p1.y > p2.y)
+    {
+        std::swap(p1.y, p2.y);
+        std::swap(p1.x, p2.x);
+        std::swap(p1.z, p2.z);
+        std::swap(p1.w, p2.w);
+
+
+        std::swap(uv1.u, uv2.u);
+        std::swap(uv1.v, uv2.v);
+    }
+
+    if (p2.y > p3.y)
+    {
+        std::swap(p2.y, p3.y);
+        std::swap(p2.x, p3.x);
+        std::swap(p2.z, p3.z);
+        std::swap(p2.w, p3.w);
+
+        std::swap(uv2.u, uv3.u);
+        std::swap(uv2.v, uv3.v);
+    }
+
+    if (p1.y > p2.y)
+    {
+        std::swap(p1.y, p2.y);
+        std::swap(p1.x, p2.x);
+        std::swap(p1.z, p2.z);
+        std::swap(p1.w, p2.w);
+
+        std::swap(uv1.u, uv2.u);
+        std::swap(uv1.v, uv2.v);
+    }
+
+    // flip the V component to account for inverted UV-coordinate system from .obj file (V grows downwards because origin is at thetop-left)
+    uv1.v = 1.f - uv1.v;
+    uv2.v = 1.f - uv2.v;
+    uv3.v = 1.f - uv3.v;
+
+    // clear the tiles covered by the triangle before drawing on them (lazy clears)
+    _touchTiles(std::min(std::min(p1.x, p2.x), p3.x), p1.y, std::max(std::max(p1.x, p2.x), p3.x), p3.y);
+
+    // identify vector points for barycentric coordinates computation in drawTexel()
+    Vec4d a = p1;
+    Vec4d b = p2;
+    Vec4d c = p3;
+
+    /* draw the upper part of the triangle (flat-bottom)
+     *
+     *           (x1,y1) (u1,v1)
+     *             o
+     *            . `.
+     *           .    `.
+     * (x2,y2) o.-------`o (mx,my)
+     * (u2,v2)   ` .      `.
+     *               ` .    `.
+     *                   ` .  `.
+     *                       ` .`.
+     *                           ` o (x3,y3)
+     *                               (u3,v3)
+     */
+
+    // retrieve the slopes of both legs of the upper triangle
+    float invLeftSlope = 0; // Dx / Dy
+    if ((int)(p2.y - p1.y) != 0)
+        invLeftSlope = (float)(p2.x-p1.x) / (float)std::abs(p2.y-p1.y);
+
+    float invRightSlope = 0; // Dx / Dy
+    if ((int)(p3.y - p1.y) != 0)
+        invRightSlope = (float)(p3.x-p1.x) / (float)std::abs(p3.y-p1.y);
+
+    // if (y2-y1) is zero, don't do any of this
+    if ((int)(p2.y - p1.y) != 0)
+    {
+        // loop through all the scanlines (top to bottom)
+        int xStart = 0, xEnd = 0;
+        for (int y = p1.y; y <= p2.y; ++y)
+        {
+            xStart = (p2.x) + (y - p2.y) * invLeftSlope;
+            xEnd   = (p1.x) + (y - p1.y) * invRightSlope;
+
+            // rotation of the triangle might cause xEnd to be before the xStart: hence the swap below
+            if (xEnd < xStart)
+                std::swap(xEnd, xStart);
+
+            for (int x = xStart; x <= xEnd; ++x)
+            {
+                // draw pixel using predefined color for testing
+                //drawPixel(x, y, 0xFFFFFF00); // yellow
+
+                // draw pixel using color from the texture
+                _drawTexel<Depth>(x, y, a, b, c, uv1, uv2, uv3, texture, textureWidth, textureHeight, fixDistortion);
+            }
+        }
+    }
+
+    /* draw the lower part of the triangle (flat-top) */
+
+    // retrieve the slopes of both legs of the lower triangle
+    invLeftSlope = 0; // Dx / Dy
+    if ((int)(p3.y - p2.y) != 0)
+        invLeftSlope = (float)(p3.x-p2.x) / (float)std::abs(p3.y-p2.y);
+
+    invRightSlope = 0; // Dx / Dy
+    if ((int)(p3.y - p1.y) != 0)
+        invRightSlope = (float)(p3.x-p1.x) / (float)std::abs(p3.y-p1.y);
+
+    // if (y3-y2) is zero, don't do scanlines
+    if ((int)(p3.y - p2.y) != 0)
+    {
+        // loop through all the scanlines (top to bottom)
+        int xStart = 0, xEnd = 0;
+        for (int y = p2.y; y <= p3.y; ++y)
+        {
+            xStart = p2.x + (y - p2.y) * invLeftSlope;
+            xEnd   = p1.x + (y - p1.y) * invRightSlope;
+
+            // rotation of the triangle might cause xEnd to be positioned before xStart: hence the swap below
+            if (xEnd < xStart)
+                std::swap(xEnd, xStart);
+
+            for (int x = xStart; x <= xEnd; ++x)
+            {
+                //std::cout << "Display::drawTexturedTriangle: flat-top x=" << 0 << " y=" << y << std::endl;
+
+                // draw pixel using color from the texture
+                //drawPixel(x, y, 0xFFFF00FF); // magenta
+
+                // draw pixel using color from the texture
+                _drawTexel<Depth>(x, y, a, b, c, uv1, uv2, uv3, texture, textureWidth, textureHeight, fixDistortion);
+            }
+        }
+    }
+}
+
+void Display::drawTexturedTriangle(Vec4d p1, Vec4d p2, Vec4d p3,
+                                   Tex2 uv1, Tex2 uv2, Tex2 uv3,
+                                   const uint32_t* texture, const int& textureWidth, const int& textureHeight,
+                                   const bool& fixDistortion)
+{
+    switch (_depthFormat)
+    {
+        case DEPTH_FORMAT::DEPTH_UNORM16:
+            _drawTexturedTriangle<DepthUnorm16>(p1, p2, p3, uv1, uv2, uv3, texture, textureWidth, textureHeight, fixDistortion);
+            break;
+
+        case DEPTH_FORMAT::DEPTH_REVERSED_FLOAT:
+            _drawTexturedTriangle<DepthReversedFloat>(p1, p2, p3, uv1, uv2, uv3, texture, textureWidth, textureHeight, fixDistortion);
+            break;
+
+        default:
+            _drawTexturedTriangle<DepthFloat>(p1, p2, p3, uv1, uv2, uv3, texture, textureWidth, textureHeight, fixDistortion);
+            break;
+    }
+}
+
+/* drawTriangleDepth: depth-only rasterization for the Z-prepass.
+ *
+ * The vertices go through the same integer conversion, sorting and scanlines of fillTriangle() and drawTexturedTriangle(),
+ * and the depth is computed by _interpolateDepth() just like the color kernels do. That way the color pass that follows can use
+ * DEPTH_EQUAL and only the closest triangle on each pixel is colored/textured.
+ */
+template <typename Depth>
+void Display::_drawTriangleDepth(Vec4d p1, Vec4d p2, Vec4d p3, const bool& insideTest)
+{
+    p1.x = (int)p1.x;
+    p1.y = (int)p1.y;
+    p2.x = (int)p2.x;
+    p2.y = (int)p2.y;
+    p3.x = (int)p3.x;
+    p3.y = (int)p3.y;
+
+    /* sort the vectices by y-coord in asceding order (y1 < y2 < y3) */
+
+    if (p1.y > p2.y)
+        std::swap(p1, p2);
+
+    if (p2.y > p3.y)
+        std::swap(p2, p3);
+
+    if (p1.y > p2.y)
+        std::swap(p1, p2);
+
+    // clear the tiles covered by the triangle before drawing on them (lazy clears)
+    _touchTiles(std::min(std::min(p1.x, p2.x), p3.x), p1.y, std::max(std::max(p1.x, p2.x), p3.x), p3.y);
+
+    Vec2d a = Vec4d::toVec2d(p1);
+    Vec2d b = Vec4d::toVec2d(p2);
+    Vec2d c = Vec4d::toVec2d(p3);
+
+    const float EPSILON = 0.0000001f;
+
+    for (int half = 0; half < 2; ++half)
+    {
+        // the upper half is flat-bottom (y1 to y2), the lower half is flat-top (y2 to y3)
+        const Vec4d& top = (half == 0) ? p1 : p2;
+        const Vec4d& bottom = (half == 0) ? p2 : p3;
+
+        if ((int)(bottom.y - top.y) == 0)
+            continue;
+
+        float invLeftSlope = (float)(bottom.x-top.x) / (float)std::abs(bottom.y-top.y);
+
+        float invRightSlope = 0;
+        if ((int)(p3.y - p1.y) != 0)
+            invRightSlope = (float)(p3.x-p1.x) / (float)std::abs(p3.y-p1.y);
+
+        int xStart = 0, xEnd = 0;
+        for (int y = top.y; y <= bottom.y; ++y)
+        {
+            xStart = p2.x + (y - p2.y) * invLeftSlope;
+            xEnd   = p1.x + (y - p1.y) * invRightSlope;
+
+            if (xEnd < xStart)
+                std::swap(xEnd, xStart);
+
+            if (y < _scissorY1 || y >= _scissorY2)
+                continue;
+
+            // clip the span to the screen (scissor): only depth is written, so nothing else has to be computed outside of it
+            xStart = std::max(xStart, _scissorX1);
+            xEnd = std::min(xEnd, _scissorX2-1);
+
+            typename Depth::Type* depthRow = &_depthData<Depth>()[_stride * y];
+            for (int x = xStart; x <= xEnd; ++x)
+            {
+                Vec3d weights = _barycentricWeights(a, b, c, Vec2d(x, y));
+
+                // fillTriangle() discards the pixels of the span that are outside of the triangle
+                if (insideTest && (weights.x < -EPSILON || weights.y < -EPSILON || weights.z < -EPSILON))
+                    continue;
+
+                typename Depth::Type depth = _interpolateDepth<Depth>(weights, p1, p2, p3);
+                _rasterizedPixels++;
+
+                if (Depth::closer(depth, depthRow[x]))
+                    depthRow[x] = depth;
+            }
+        }
+    }
+}
+
+void Display::drawTriangleDepth(Vec4d p1, Vec4d p2, Vec4d p3, const bool& insideTest)
+{
+    switch (_depthFormat)
+    {
+        case DEPTH_FORMAT::DEPTH_UNORM16:
+            _drawTriangleDepth<DepthUnorm16>(p1, p2, p3, insideTest);
+            break;
+
+        case DEPTH_FORMAT::DEPTH_REVERSED_FLOAT:
+            _drawTriangleDepth<DepthReversedFloat>(p1, p2, p3, insideTest);
+            break;
+
+        default:
+            _drawTriangleDepth<DepthFloat>(p1, p2, p3, insideTest);
+            break;
+    }
+}
+
+/* Visibility Buffer rasterization: the same setup and scanlines of drawTexturedTriangle() are used,
+ * but only the depth and the ID of the triangle are written. The texture is fetched later by resolveVisibilityBuffer().
+ */
+void Display::clearVisibilityBuffer()
+{
+    _visTriangles.clear();
+
+    fill32(_triangleIdBuffer, 0, (size_t)_stride * _screenHeight, true);
+}
+
+void Display::drawVisibilityTriangle(Vec4d p1, Vec4d p2, Vec4d p3,
+                                     Tex2 uv1, Tex2 uv2, Tex2 uv3,
+                                     const uint32_t* texture, const int& textureWidth, const int& textureHeight)
+{
+    if (!texture)
+    {
+        std::cout << "Display::drawVisibilityTriangle !!! NULL texture" << std::endl;
+        return;
+    }
+
+    // convert X,Y's to integer to cover exactly the same pixels as drawTexturedTriangle()
+    p1.x = (int)p1.x;
+    p1.y = (int)p1.y;
+    p2.x = (int)p2.x;
+    p2.y = (int)p2.y;
+    p3.x = (int)p3.x;
+    p3.y = (int)p3.y;
+
+    /* sort the vectices by y-coord in asceding order (y1 < y2 < y3) */
+
+    if (p1.y > p2.y)
+    {
+        std::swap(p1, p2);
+        std::swap(uv1, uv2);
+    }
+
+    if (p2.y > p3.y)
+    {
+        std::swap(p2, p3);
+        std::swap(uv2, uv3);
+    }
+
+    if (p1.y > p2.y)
+    {
+        std::swap(p1, p2);
+        std::swap(uv1, uv2);
+    }
+
+    // flip the V component to account for inverted UV-coordinate system from .obj file
+    uv1.v = 1.f - uv1.v;
+    uv2.v = 1.f - uv2.v;
+    uv3.v = 1.f - uv3.v;
+
+    // clear the tiles covered by the triangle before drawing on them (lazy clears)
+    _touchTiles(std::min(std::min(p1.x, p2.x), p3.x), p1.y, std::max(std::max(p1.x, p2.x), p3.x), p3.y);
+
+    // record the triangle: the ID stored in the visibility buffer is its index + 1 (0 means empty)
+    VisTriangle visTriangle = { p1, p2, p3, uv1, uv2, uv3, texture, textureWidth, textureHeight };
+    _visTriangles.push_back(visTriangle);
+    uint32_t triangleId = (uint32_t)_visTriangles.size();
+
+    switch (_depthFormat)
+    {
+        case DEPTH_FORMAT::DEPTH_UNORM16:
+            _drawVisibilityTriangle<DepthUnorm16>(p1, p2, p3, triangleId);
+            break;
+
+        case DEPTH_FORMAT::DEPTH_REVERSED_FLOAT:
+            _drawVisibilityTriangle<DepthReversedFloat>(p1, p2, p3, triangleId);
+            break;
+
+        default:
+            _drawVisibilityTriangle<DepthFloat>(p1, p2, p3, triangleId);
+            break;
+    }
+}
+
+// _drawVisibilityTriangle: the scanlines of drawVisibilityTriangle(), the vertices are already sorted by y-coord
+template <typename Depth>
+void Display::_drawVisibilityTriangle(const Vec4d& p1, const Vec4d& p2, const Vec4d& p3, const uint32_t& triangleId)
+{
+    for (int half = 0; half < 2; ++half)
+    {
+        // the upper half is flat-bottom (y1 to y2), the lower half is flat-top (y2 to y3)
+        const Vec4d& top = (half == 0) ? p1 : p2;
+        const Vec4d& bottom = (half == 0) ? p2 : p3;
+
+        if ((int)(bottom.y - top.y) == 0)
+            continue;
+
+        float invLeftSlope = (float)(bottom.x-top.x) / (float)std::abs(bottom.y-top.y);
+
+        float invRightSlope = 0;
+        if ((int)(p3.y - p1.y) != 0)
+            invRightSlope = (float)(p3.x-p1.x) / (float)std::abs(p3.y-p1.y);
+
+        int xStart = 0, xEnd = 0;
+        for (int y = top.y; y <= bottom.y; ++y)
+        {
+            xStart = p2.x + (y - p2.y) * invLeftSlope;
+            xEnd   = p1.x + (y - p1.y) * invRightSlope;
+
+            if (xEnd < xStart)
+                std::swap(xEnd, xStart);
+
+            if (y < _scissorY1 || y >= _scissorY2)
+                continue;
+
+            for (int x = xStart; x <= xEnd; ++x)
+            {
+                if (x < _scissorX1 || x >= _scissorX2)
+                    continue;
+
+                Vec3d weights = _barycentricWeights(Vec4d::toVec2d(p1), Vec4d::toVec2d(p2), Vec4d::toVec2d(p3), Vec2d(x, y));
+                typename Depth::Type depth = _interpolateDepth<Depth>(weights, p1, p2, p3);
+                _rasterizedPixels++;
+
+                int bufferIdx = (_stride * y) + x;
+                if (Depth::closer(depth, _depthData<Depth>()[bufferIdx]))
+                {
+                    _depthData<Depth>()[bufferIdx] = depth;
+                    _triangleIdBuffer[bufferIdx] = triangleId;
+                }
+            }
+        }
+    }
+}
+
+// resolveVisibilityBuffer: every screen pixel is shaded at most once, no matter how many triangles were rasterized on it
+void Display::resolveVisibilityBuffer(JobSystem& jobSystem, const bool& fixDistortion)
+{
+    std::atomic<uint64_t> shaded(0);
+
+    jobSystem.parallelFor(_screenHeight, RESOLVE_ROWS_PER_JOB, [this, &shaded, fixDistortion](unsigned int begin, unsigned int end)
+    {
+        shaded += _resolveRows(begin, end, fixDistortion);
+    });
+
+    _shadedPixels += shaded;
+    _writtenPixels += shaded;
+}
+
+// _resolveRows: shade rows [yStart, yEnd) of the visibility buffer and return how many pixels were shaded
+uint64_t Display::_resolveRows(const int& yStart, const int& yEnd, const bool& fixDistortion)
+{
+    uint64_t shaded = 0;
+
+    for (int y = yStart; y < yEnd; ++y)
+    {
+        for (int x = 0; x < _screenWidth; ++x)
+        {
+            int bufferIdx = (_stride * y) + x;
+            uint32_t triangleId = _triangleIdBuffer[bufferIdx];
+            if (!triangleId)
+                continue;
+
+            const VisTriangle& t = _visTriangles[triangleId-1];
+            Vec3d weights = _barycentricWeights(Vec4d::toVec2d(t.a), Vec4d::toVec2d(t.b), Vec4d::toVec2d(t.c), Vec2d(x, y));
+
+            _colorBuffer[bufferIdx] = _sampleTexture(weights, t.a, t.b, t.c, t.a_uv, t.b_uv, t.c_uv,
+                                                     t.texture, t.textureWidth, t.textureHeight, fixDistortion);
+            shaded++;
+        }
+    }
+
+    return shaded;
+}
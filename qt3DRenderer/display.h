@@ -1,91 +1,313 @@
-#pragma once
-#include "vec3d.h"
-#include "vec2d.h"
-#include "tex2.h"
-
-#include <cstdint>
-
-extern bool USE_PAINTERS_ALGO;
-
-class Display
-{
-public:
-    Display();
-    ~Display();
-
-    // setup: allocates new color buffer
-    void setup();
-
-    // setSize: set a new screen size (i.e. color buffer)
-    void setSize(const int& width, const int& height);
-
-    // width: return the width of the 3D screen
-    int width();
-
-    // height: return the height of the 3D screen
-    int height();
-
-    // clearColorBuffer: fill color buffer with specific color
-    void clearColorBuffer(const uint32_t& color);
-
-    //
-    void clearDepthBuffer(const float& depth);
-
-    //
-    uint32_t* colorBuffer();
-
-    //
-    float* depthBuffer();
-
-    //
-    void drawGrid();
-
-    //
-    void drawPixel(const int& x, const int& y, const uint32_t& color);
-
-    //
-    void drawPixel(const int& x, const int& y, const Vec4d& a, const Vec4d& b, const Vec4d& c, const uint32_t& color);
-
-    //
-    void drawTexel(const int& x, const int& y,
-                   const Vec4d& a, const Vec4d& b, const Vec4d& c,
-                   const Tex2& a_uv, const Tex2& b_uv, const Tex2& c_uv,
-                   const uint32_t* texture, const int& textureWidth, const int& textureHeight,
-                   const bool& fixDistortion = true);
-
-    //
-    void drawLine(const int& x1, const int& y1, const int& x2, const int& y2, const uint32_t& color);
-
-    //
-    void drawRect(const int& x, const int& y, const int& w, const int& h, const uint32_t& color);
-
-    //
-    void drawTriangle(const int& x1, const int& y1, const int& x2, const int& y2, const int& x3, const int& y3, const uint32_t& color);        
-
-    //
-    void fillTriangle(Vec4d p1, Vec4d p2, Vec4d p3, const uint32_t& color);
-
-    //
-    void drawTexturedTriangle(Vec4d p1, Vec4d p2, Vec4d p3,
-                              Tex2 uv1, Tex2 uv2, Tex2 uv3,
-                              const uint32_t* texture, const int& textureWidth, const int& textureHeight,
-                              const bool& fixDistortion = true);
-
-    // orthographic projection: objects appear to have the same size regardless of their Z distance
-    // receives a 3D vector and returns a projected 2D point
-    Vec2d project(Vec3d p);
-
-private:
-    void _fillFlatBottomTriangle(const int& x1, const int& y1, const int& x2, const int& y2, const int& x3, const int& y3, const uint32_t& color);
-    void _fillFlatTopTriangle(const int& x1, const int& y1, const int& x2, const int& y2, const int& x3, const int& y3, const uint32_t& color);
-
-    Vec3d _barycentricWeights(const Vec2d& a, const Vec2d& b, const Vec2d& c, const Vec2d& p);
-
-    uint32_t* _colorBuffer;
-    float* _depthBuffer;
-
-    int _screenWidth;
-    int _screenHeight;
-    uint32_t _bkgColor;
-    float _fovFactor;
-};
+#pragma once
+#include "vec3d.h"
+#include "vec2d.h"
+#include "tex2.h"
+#include "cpudispatch.h"
+
+#include <cstdint>
+#include <vector>
+
+extern bool USE_PAINTERS_ALGO;
+
+class JobSystem;
+
+
+enum DEPTH_FUNC {
+    DEPTH_LESS,             // the pixel is drawn when it is closer than the value stored in the depth buffer
+    DEPTH_EQUAL             // the pixel is drawn only when it has the value stored in the depth buffer (used after a Z-prepass)
+};
+
+/* DEPTH_FORMAT: how the depth of a pixel (interpolated from 1/w) is stored in the depth buffer.
+ *
+ * The classic 1 - 1/w in a float puts the values of the far half of the scene next to 1.0, where the float has the
+ * least precision, while 1/w itself changes slower and slower with the distance. Reversed-Z stores zNear/w instead:
+ * the far values go towards 0, where the float is most precise, and both curves cancel out (about the same relative
+ * precision at any distance). The 16-bit format halves the memory traffic of the depth test for low-end machines, at
+ * the price of z-fighting much closer to the camera.
+ */
+enum DEPTH_FORMAT {
+    DEPTH_FLOAT,            // 32-bit float 1 - 1/w: 0 (near) to 1 (far), smaller is closer
+    DEPTH_UNORM16,          // 16-bit unsigned normalized 1 - zNear/w: 0 (near plane) to 65535 (far), smaller is closer
+    DEPTH_REVERSED_FLOAT    // 32-bit float zNear/w: 1 (near plane) to 0 (far), bigger is closer
+};
+
+class Display
+{
+public:
+    Display();
+    ~Display();
+
+    // bindKernels: the variant of the buffer fills (clears) used by every Display (see CpuDispatch)
+    static void bindKernels(const CPU_LEVEL& level);
+
+    // setup: allocates new color buffer
+    void setup();
+
+    // setSize: set a new screen size (i.e. color buffer)
+    void setSize(const int& width, const int& height);
+
+    // width: return the width of the 3D screen
+    int width();
+
+    // height: return the height of the 3D screen
+    int height();
+
+    // stride: return the number of pixels between the beginning of two consecutive rows of the buffers (width + padding)
+    int stride();
+
+    // allocations: return how many times the buffers had to be (re)allocated
+    int allocations();
+
+    // clearColorBuffer: fill color buffer with specific color
+    void clearColorBuffer(const uint32_t& color);
+
+    // clearDepthBuffer: depth goes from 0 (near) to 1 (far) and is converted to the format of the depth buffer
+    void clearDepthBuffer(const float& depth);
+
+    // setDepthFormat: select the format of the depth buffer. Its contents are lost, clear it before drawing
+    void setDepthFormat(const DEPTH_FORMAT& format);
+
+    //
+    DEPTH_FORMAT depthFormat();
+
+    // setNearPlane: distance of the near plane, DEPTH_UNORM16 and DEPTH_REVERSED_FLOAT use it to normalize the depth
+    void setNearPlane(const float& zNear);
+
+    /* Lazy clears: clearColorBuffer(), clearDepthBuffer() and drawGrid() only mark the tiles of the screen as "not cleared".
+     * A tile is filled with the clear values when a primitive is drawn over it for the first time, and the tiles that
+     * were never touched by geometry are filled by resolveClears() right before the color buffer is presented.
+     */
+    void setLazyClear(const bool& enable);
+
+    //
+    bool lazyClear();
+
+    // resolveClears: fill all the tiles that are still waiting for their clear values (call before reading the buffers)
+    void resolveClears();
+
+    /* Scissor: the primitives, the clears and the grid only write the pixels inside of the rectangle.
+     * Used to redraw only the damaged region of the screen. setup() resets it to the whole screen.
+     */
+    void setScissor(const int& x, const int& y, const int& w, const int& h);
+
+    //
+    void resetScissor();
+
+    // setDepthFunc: select the comparison used by the depth test of the color kernels
+    void setDepthFunc(const DEPTH_FUNC& func);
+
+    //
+    uint32_t* colorBuffer();
+
+    // depthBuffer: the depth buffer of the float formats
+    float* depthBuffer();
+
+    // depthBuffer16: the depth buffer of DEPTH_UNORM16 (same memory of depthBuffer())
+    uint16_t* depthBuffer16();
+
+    // triangleIdBuffer: return the visibility buffer (0 means no triangle, otherwise the ID of the triangle + 1)
+    uint32_t* triangleIdBuffer();
+
+    //
+    void drawGrid();
+
+    //
+    void drawPixel(const int& x, const int& y, const uint32_t& color);
+
+    //
+    void drawPixel(const int& x, const int& y, const Vec4d& a, const Vec4d& b, const Vec4d& c, const uint32_t& color);
+
+    // drawPixel: depth tested pixel with the color interpolated from the colors of the vertices (Gouraud shading)
+    void drawPixel(const int& x, const int& y, const Vec4d& a, const Vec4d& b, const Vec4d& c,
+                   const uint32_t& a_color, const uint32_t& b_color, const uint32_t& c_color);
+
+    //
+    void drawTexel(const int& x, const int& y,
+                   const Vec4d& a, const Vec4d& b, const Vec4d& c,
+                   const Tex2& a_uv, const Tex2& b_uv, const Tex2& c_uv,
+                   const uint32_t* texture, const int& textureWidth, const int& textureHeight,
+                   const bool& fixDistortion = true);
+
+    //
+    void drawLine(const int& x1, const int& y1, const int& x2, const int& y2, const uint32_t& color);
+
+    //
+    void drawRect(const int& x, const int& y, const int& w, const int& h, const uint32_t& color);
+
+    //
+    void drawTriangle(const int& x1, const int& y1, const int& x2, const int& y2, const int& x3, const int& y3, const uint32_t& color);        
+
+    //
+    void fillTriangle(Vec4d p1, Vec4d p2, Vec4d p3, const uint32_t& color);
+
+    // fillTriangle: Gouraud shading, the colors of the vertices are interpolated across the triangle
+    void fillTriangle(Vec4d p1, Vec4d p2, Vec4d p3, uint32_t c1, uint32_t c2, uint32_t c3);
+
+    //
+    void drawTexturedTriangle(Vec4d p1, Vec4d p2, Vec4d p3,
+                              Tex2 uv1, Tex2 uv2, Tex2 uv3,
+                              const uint32_t* texture, const int& textureWidth, const int& textureHeight,
+                              const bool& fixDistortion = true);
+
+    /* Z-prepass: rasterize only the depth of a triangle (no colors, no U,V) to fill the depth buffer before the color pass.
+     * The coverage matches fillTriangle() when insideTest is true, and drawTexturedTriangle() otherwise.
+     */
+    void drawTriangleDepth(Vec4d p1, Vec4d p2, Vec4d p3, const bool& insideTest = false);
+
+    /* Visibility Buffer (deferred texturing): the first pass rasterizes only depth + a 32-bit triangle ID,
+     * the second pass (resolve) shades each screen pixel exactly once with the triangle that won the depth test.
+     */
+
+    // clearVisibilityBuffer: reset the triangle IDs and forget the triangles recorded by the previous frame
+    void clearVisibilityBuffer();
+
+    // drawVisibilityTriangle: store the triangle for the resolve pass and rasterize its depth + ID (no texture fetches)
+    void drawVisibilityTriangle(Vec4d p1, Vec4d p2, Vec4d p3,
+                                Tex2 uv1, Tex2 uv2, Tex2 uv3,
+                                const uint32_t* texture, const int& textureWidth, const int& textureHeight);
+
+    // resolveVisibilityBuffer: shade the visible pixels, bands of rows are split among the threads of jobSystem
+    void resolveVisibilityBuffer(JobSystem& jobSystem, const bool& fixDistortion = true);
+
+    // resetStats: zero the pixel counters used to compare the direct and the deferred paths
+    void resetStats();
+
+    // rasterizedPixels: number of pixels that went through the depth test since resetStats()
+    uint64_t rasterizedPixels();
+
+    // shadedPixels: number of pixels that fetched a texel from a texture since resetStats()
+    uint64_t shadedPixels();
+
+    // writtenPixels: number of pixels that passed the depth test of a color kernel since resetStats()
+    uint64_t writtenPixels();
+
+    // coveredPixels: number of pixels of the depth buffer that were touched by a triangle on the current frame
+    uint64_t coveredPixels();
+
+    // reciprocalW: the 1/w of pixels [x1, x2) of row y read back from the depth buffer (0 where nothing was drawn)
+    void reciprocalW(const int& y, const int& x1, const int& x2, float* values);
+
+    // orthographic projection: objects appear to have the same size regardless of their Z distance
+    // receives a 3D vector and returns a projected 2D point
+    Vec2d project(Vec3d p);
+
+private:
+    void _fillFlatBottomTriangle(const int& x1, const int& y1, const int& x2, const int& y2, const int& x3, const int& y3, const uint32_t& color);
+    void _fillFlatTopTriangle(const int& x1, const int& y1, const int& x2, const int& y2, const int& x3, const int& y3, const uint32_t& color);
+
+    Vec3d _barycentricWeights(const Vec2d& a, const Vec2d& b, const Vec2d& c, const Vec2d& p);
+
+    /* the kernels are templates over the depth format (see the Depth* structs of display.cpp): the public functions
+     * pick the format once per triangle, not once per pixel
+     */
+    template <typename Depth>
+    void _drawPixel(const int& x, const int& y, const Vec4d& a, const Vec4d& b, const Vec4d& c, const uint32_t& color);
+
+    template <typename Depth>
+    void _drawPixel(const int& x, const int& y, const Vec4d& a, const Vec4d& b, const Vec4d& c,
+                    const uint32_t& a_color, const uint32_t& b_color, const uint32_t& c_color);
+
+    template <typename Depth>
+    void _drawTexel(const int& x, const int& y,
+                    const Vec4d& a, const Vec4d& b, const Vec4d& c,
+                    const Tex2& a_uv, const Tex2& b_uv, const Tex2& c_uv,
+                    const uint32_t* texture, const int& textureWidth, const int& textureHeight,
+                    const bool& fixDistortion);
+
+    template <typename Depth>
+    void _fillTriangle(Vec4d p1, Vec4d p2, Vec4d p3, const uint32_t& color);
+
+    template <typename Depth>
+    void _fillTriangle(Vec4d p1, Vec4d p2, Vec4d p3, uint32_t c1, uint32_t c2, uint32_t c3);
+
+    template <typename Depth>
+    void _drawTexturedTriangle(Vec4d p1, Vec4d p2, Vec4d p3,
+                               Tex2 uv1, Tex2 uv2, Tex2 uv3,
+                               const uint32_t* texture, const int& textureWidth, const int& textureHeight,
+                               const bool& fixDistortion);
+
+    template <typename Depth>
+    void _drawTriangleDepth(Vec4d p1, Vec4d p2, Vec4d p3, const bool& insideTest);
+
+    template <typename Depth>
+    void _drawVisibilityTriangle(const Vec4d& p1, const Vec4d& p2, const Vec4d& p3, const uint32_t& triangleId);
+
+    template <typename Depth>
+    typename Depth::Type _interpolateDepth(const Vec3d& weights, const Vec4d& a, const Vec4d& b, const Vec4d& c);
+
+    template <typename Depth>
+    bool _depthTest(const typename Depth::Type& depth, const int& bufferIdx);
+
+    template <typename Depth>
+    uint64_t _coveredPixels();
+
+    template <typename Depth>
+    void _reciprocalW(const int& y, const int& x1, const int& x2, float* values);
+
+    // _depthData: the depth buffer seen as an array of values of the format
+    template <typename Depth>
+    typename Depth::Type* _depthData() { return reinterpret_cast<typename Depth::Type*>(_depthBuffer); }
+
+    // _fillDepth: write the clear value of the depth to count pixels of the depth buffer starting at offset
+    void _fillDepth(const size_t& offset, const size_t& count, const bool& stream);
+
+    uint32_t _sampleTexture(const Vec3d& weights,
+                            const Vec4d& a, const Vec4d& b, const Vec4d& c,
+                            const Tex2& a_uv, const Tex2& b_uv, const Tex2& c_uv,
+                            const uint32_t* texture, const int& textureWidth, const int& textureHeight,
+                            const bool& fixDistortion);
+
+    uint64_t _resolveRows(const int& yStart, const int& yEnd, const bool& fixDistortion);
+
+    void _freeBuffers();
+    bool _scissorEnabled();
+
+    void _touchTiles(int x1, int y1, int x2, int y2);
+    void _clearTile(const int& tileX, const int& tileY);
+
+    // VisTriangle: a triangle recorded by drawVisibilityTriangle() after the same setup done by drawTexturedTriangle()
+    struct VisTriangle
+    {
+        Vec4d a, b, c;
+        Tex2 a_uv, b_uv, c_uv;
+        const uint32_t* texture;
+        int textureWidth;
+        int textureHeight;
+    };
+
+    uint32_t* _colorBuffer;
+    float* _depthBuffer;
+    uint32_t* _triangleIdBuffer;
+    std::vector<VisTriangle> _visTriangles;
+
+    DEPTH_FUNC _depthFunc;
+    DEPTH_FORMAT _depthFormat;
+    float _zNear;
+
+    // scissor rectangle: [x1, x2) x [y1, y2)
+    int _scissorX1;
+    int _scissorY1;
+    int _scissorX2;
+    int _scissorY2;
+
+    // lazy clears: each tile stores flags telling whether its color/depth are still waiting for the clear values
+    bool _lazyClear;
+    int _tilesX;
+    int _tilesY;
+    std::vector<uint8_t> _tileFlags;
+    uint32_t _clearColor;
+    float _clearDepth;
+    bool _clearGrid;
+
+    uint64_t _rasterizedPixels;
+    uint64_t _shadedPixels;
+    uint64_t _writtenPixels;
+
+    int _screenWidth;
+    int _screenHeight;
+    int _stride;
+    size_t _capacity;
+    int _allocations;
+    uint32_t _bkgColor;
+    float _fovFactor;
+};
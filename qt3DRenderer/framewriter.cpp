@@ -0,0 +1,239 @@
+#include "framewriter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+    #include <fcntl.h>
+    #include <io.h>
+#endif
+
+
+FrameWriter::FrameWriter()
+{
+    _file = nullptr;
+    _format = FRAME_FORMAT::Y4M;
+    _width = _height = 0;
+    _buffers = 0;
+    _queueFirst = _queueCount = 0;
+
+    // the queue and the free list never hold more than FRAME_QUEUE_SIZE buffers: their slots are allocated once here
+    _queue.resize(FRAME_QUEUE_SIZE);
+    _free.reserve(FRAME_QUEUE_SIZE);
+    _stop = false;
+    _failed = false;
+    _framesWritten = 0;
+    _stallMs = 0.0;
+}
+
+FrameWriter::~FrameWriter()
+{
+    close();
+}
+
+bool FrameWriter::open(const std::string& filename, const FRAME_FORMAT& format, const int& width, const int& height, const int& fps)
+{
+    if (format == FRAME_FORMAT::Y4M && (width % 2 || height % 2))
+    {
+        std::cerr << "FrameWriter::open: Y4M 4:2:0 needs an even width and height (" << width << "x" << height << ")" << std::endl;
+        return false;
+    }
+
+    if (filename == "-")
+    {
+#ifdef _WIN32
+        // the frames are binary: no \n -> \r\n translation on the pipe
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        _file = stdout;
+    }
+    else
+        _file = std::fopen(filename.c_str(), "wb");
+
+    if (!_file)
+    {
+        std::cerr << "FrameWriter::open: unable to write " << filename << std::endl;
+        return false;
+    }
+
+    _format = format;
+    _width = width;
+    _height = height;
+    _buffers = 0;
+    _queueFirst = _queueCount = 0;
+    _stop = false;
+    _failed = false;
+    _framesWritten = 0;
+    _stallMs = 0.0;
+
+    if (_format == FRAME_FORMAT::Y4M)
+        std::fprintf(_file, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", _width, _height, fps);
+
+    _thread = std::thread(&FrameWriter::_run, this);
+    return true;
+}
+
+void FrameWriter::push(const uint32_t* pixels, const int& stride)
+{
+    std::vector<uint32_t> frame;
+
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+
+        // a new buffer only until the queue is full, then wait for the writer to give one back
+        if (_free.empty() && _buffers < FRAME_QUEUE_SIZE)
+        {
+            _buffers++;
+            frame.resize((size_t)_width * _height);
+        }
+        else
+        {
+            auto start = std::chrono::steady_clock::now();
+            _released.wait(lock, [this]() { return !_free.empty(); });
+            _stallMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            frame.swap(_free.back());
+            _free.pop_back();
+        }
+    }
+
+    // the copy drops the padding of the rows, the writer works with tight frames
+    for (int y = 0; y < _height; ++y)
+        std::memcpy(&frame[(size_t)y * _width], &pixels[(size_t)y * stride], _width * sizeof(uint32_t));
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queue[(_queueFirst + _queueCount) % FRAME_QUEUE_SIZE].swap(frame);
+        _queueCount++;
+    }
+
+    _queued.notify_one();
+}
+
+bool FrameWriter::close()
+{
+    if (!_file)
+        return !_failed;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _queued.notify_one();
+
+    if (_thread.joinable())
+        _thread.join();
+
+    std::fflush(_file);
+    if (_file != stdout)
+        std::fclose(_file);
+    _file = nullptr;
+
+    _free.clear();
+    return !_failed;
+}
+
+int FrameWriter::framesWritten()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _framesWritten;
+}
+
+double FrameWriter::stallMs()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stallMs;
+}
+
+// _run: the writer thread. It drains the queue before stopping
+void FrameWriter::_run()
+{
+    while (true)
+    {
+        std::vector<uint32_t> frame;
+
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _queued.wait(lock, [this]() { return _stop || _queueCount > 0; });
+
+            if (_queueCount == 0)
+                return;
+
+            frame.swap(_queue[_queueFirst]);
+            _queueFirst = (_queueFirst + 1) % FRAME_QUEUE_SIZE;
+            _queueCount--;
+        }
+
+        if (_format == FRAME_FORMAT::Y4M)
+            _writeY4m(frame);
+        else
+            _writeRgba(frame);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _framesWritten++;
+            _free.push_back(std::vector<uint32_t>());
+            _free.back().swap(frame);
+        }
+
+        _released.notify_one();
+    }
+}
+
+void FrameWriter::_writeRgba(const std::vector<uint32_t>& frame)
+{
+    _bytes.resize(frame.size() * 4);
+
+    for (size_t i = 0; i < frame.size(); ++i)
+    {
+        uint32_t c = frame[i];
+        _bytes[i * 4 + 0] = (c >> 16) & 0xFF;
+        _bytes[i * 4 + 1] = (c >> 8) & 0xFF;
+        _bytes[i * 4 + 2] = c & 0xFF;
+        _bytes[i * 4 + 3] = (c >> 24) & 0xFF;
+    }
+
+    if (std::fwrite(_bytes.data(), 1, _bytes.size(), _file) != _bytes.size())
+        _failed = true;
+}
+
+/* _writeY4m: BT.601 full range (JPEG) in 16-bit fixed point. Y for every pixel, U and V for each 2x2 block from the
+ * average of its 4 pixels.
+ */
+void FrameWriter::_writeY4m(const std::vector<uint32_t>& frame)
+{
+    const int w = _width, h = _height;
+    _bytes.resize((size_t)w * h * 3 / 2);
+
+    uint8_t* yPlane = _bytes.data();
+    uint8_t* uPlane = yPlane + (size_t)w * h;
+    uint8_t* vPlane = uPlane + (size_t)(w / 2) * (h / 2);
+
+    for (int y = 0; y < h; y += 2)
+        for (int x = 0; x < w; x += 2)
+        {
+            int sumR = 0, sumG = 0, sumB = 0;
+
+            for (int dy = 0; dy < 2; ++dy)
+                for (int dx = 0; dx < 2; ++dx)
+                {
+                    uint32_t c = frame[(size_t)(y + dy) * w + x + dx];
+                    int r = (c >> 16) & 0xFF, g = (c >> 8) & 0xFF, b = c & 0xFF;
+
+                    yPlane[(size_t)(y + dy) * w + x + dx] = (uint8_t)((19595 * r + 38470 * g + 7471 * b + 32768) >> 16);
+                    sumR += r; sumG += g; sumB += b;
+                }
+
+            // the sums are 4x the average: the shift is 2 bits longer
+            int u = ((-11059 * sumR - 21709 * sumG + 32768 * sumB + (1 << 17)) >> 18) + 128;
+            int v = ((32768 * sumR - 27439 * sumG - 5329 * sumB + (1 << 17)) >> 18) + 128;
+
+            uPlane[(size_t)(y / 2) * (w / 2) + x / 2] = (uint8_t)std::min(std::max(u, 0), 255);
+            vPlane[(size_t)(y / 2) * (w / 2) + x / 2] = (uint8_t)std::min(std::max(v, 0), 255);
+        }
+
+    if (std::fwrite("FRAME\n", 1, 6, _file) != 6 || std::fwrite(_bytes.data(), 1, _bytes.size(), _file) != _bytes.size())
+        _failed = true;
+}
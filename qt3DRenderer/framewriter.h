@@ -0,0 +1,69 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define FRAME_QUEUE_SIZE 4          // frames waiting for the writer before the renderer has to wait for it
+
+
+enum FRAME_FORMAT
+{
+    RAW_RGBA,               // R G B A bytes per pixel, no header (ffmpeg -f rawvideo -pix_fmt rgba -s WxH)
+    Y4M                     // YUV4MPEG2, 4:2:0 (BT.601, full range), readable by ffmpeg/mpv/x264
+};
+
+/* FrameWriter: converts and writes rendered frames on its own thread, so the conversion and the IO of a frame overlap
+ * with the rendering of the next ones.
+ *
+ * The frames go through a bounded queue: when the writer falls FRAME_QUEUE_SIZE frames behind, push() blocks until
+ * it catches up (the memory used stays constant no matter how long the sequence is). The buffers of the frames are
+ * recycled, nothing is allocated per frame once the queue is full.
+ */
+class FrameWriter
+{
+public:
+    FrameWriter();
+    ~FrameWriter();
+
+    // open: "-" writes to stdout. width and height must be even for Y4M
+    bool open(const std::string& filename, const FRAME_FORMAT& format, const int& width, const int& height, const int& fps);
+
+    // push: copy an ARGB32 frame (stride in pixels) to the queue. Blocks while the queue is full
+    void push(const uint32_t* pixels, const int& stride);
+
+    // close: wait for the queued frames to be written and close the file. Returns false if a write failed
+    bool close();
+
+    int framesWritten();
+
+    // stallMs: time push() spent waiting for the writer (the writer is the bottleneck when it's significant)
+    double stallMs();
+
+private:
+    void _run();
+    void _writeRgba(const std::vector<uint32_t>& frame);
+    void _writeY4m(const std::vector<uint32_t>& frame);
+
+    FILE* _file;
+    FRAME_FORMAT _format;
+    int _width, _height;
+
+    std::thread _thread;
+    std::mutex _mutex;
+    std::condition_variable _queued;            // a frame was pushed (or the writer must stop)
+    std::condition_variable _released;          // a buffer went back to the free list
+    std::vector<std::vector<uint32_t>> _queue;  // ring of FRAME_QUEUE_SIZE slots, _queueCount frames from _queueFirst
+    int _queueFirst, _queueCount;
+    std::vector<std::vector<uint32_t>> _free;
+    int _buffers;                               // buffers allocated so far (at most FRAME_QUEUE_SIZE)
+    bool _stop;
+    bool _failed;
+
+    std::vector<uint8_t> _bytes;                // converted frame, owned by the writer thread
+    int _framesWritten;
+    double _stallMs;
+};
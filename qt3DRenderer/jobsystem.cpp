@@ -0,0 +1,288 @@
+#include "jobsystem.h"
+
+#include <QThread>
+
+#include <algorithm>
+
+#define SPIN_ROUNDS 256     // failed attempts to find a job before a worker goes to sleep
+
+
+// the JobSystem and the index of the worker that runs on this thread (index 0 is the thread that created it)
+static thread_local const JobSystem* t_jobSystem = nullptr;
+static thread_local int t_workerIndex = 0;
+
+
+JobSystem::JobSystem()
+    : _quit(false), _signal(0), _sleeping(0)
+{
+    _startWorkers(1);
+}
+
+JobSystem::~JobSystem()
+{
+    _stopWorkers();
+}
+
+void JobSystem::setThreadCount(const int& threads)
+{
+    int count = (threads > 0) ? threads : std::max(QThread::idealThreadCount(), 1);
+    if (count == (int)_workers.size())
+        return;
+
+    _stopWorkers();
+    _startWorkers(count);
+}
+
+int JobSystem::threadCount()
+{
+    return _workers.size();
+}
+
+void JobSystem::_startWorkers(const int& threads)
+{
+    for (int i = 0; i < threads; ++i)
+    {
+        Worker* worker = new Worker();
+        worker->top = 0;
+        worker->bottom = 0;
+        worker->stackTop = 0;
+        worker->executed = 0;
+        worker->stolen = 0;
+        worker->random = 2463534242u + i * 7919u;
+        _workers.push_back(worker);
+    }
+
+    _quit = false;
+    for (int i = 1; i < threads; ++i)
+        _workers[i]->thread = std::thread(&JobSystem::_workerLoop, this, i);
+}
+
+void JobSystem::_stopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _quit = true;
+    }
+    _wakeUp.notify_all();
+
+    for (unsigned int i = 1; i < _workers.size(); ++i)
+        _workers[i]->thread.join();
+
+    for (unsigned int i = 0; i < _workers.size(); ++i)
+        delete _workers[i];
+
+    _workers.clear();
+}
+
+int JobSystem::_currentWorker()
+{
+    return (t_jobSystem == this) ? t_workerIndex : 0;
+}
+
+void JobSystem::run(Job* jobs, const unsigned int& count, JobCounter& counter)
+{
+    counter.pending.fetch_add(count, std::memory_order_relaxed);
+
+    int index = _currentWorker();
+    Worker& worker = *_workers[index];
+
+    for (unsigned int j = 0; j < count; ++j)
+    {
+        jobs[j].counter = &counter;
+
+        // deque full: run it right away
+        if (!_push(worker, &jobs[j]))
+            _execute(index, &jobs[j]);
+    }
+
+    // wake up the sleeping workers. A worker that is about to sleep sees the new signal and doesn't
+    _signal.fetch_add(1, std::memory_order_seq_cst);
+    if (_sleeping.load(std::memory_order_seq_cst) > 0)
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _wakeUp.notify_all();
+    }
+}
+
+void JobSystem::wait(JobCounter& counter)
+{
+    int index = _currentWorker();
+
+    while (counter.pending.load(std::memory_order_acquire) > 0)
+    {
+        Job* job = _findJob(index);
+        if (job)
+            _execute(index, job);
+        else
+            std::this_thread::yield();
+    }
+}
+
+uint64_t JobSystem::executed()
+{
+    uint64_t total = 0;
+    for (unsigned int i = 0; i < _workers.size(); ++i)
+        total += _workers[i]->executed.load(std::memory_order_relaxed);
+
+    return total;
+}
+
+uint64_t JobSystem::stolen()
+{
+    uint64_t total = 0;
+    for (unsigned int i = 0; i < _workers.size(); ++i)
+        total += _workers[i]->stolen.load(std::memory_order_relaxed);
+
+    return total;
+}
+
+void JobSystem::resetStats()
+{
+    for (unsigned int i = 0; i < _workers.size(); ++i)
+    {
+        _workers[i]->executed.store(0, std::memory_order_relaxed);
+        _workers[i]->stolen.store(0, std::memory_order_relaxed);
+    }
+}
+
+/* _workerLoop: run jobs while there are any, spin for a little while when there are none (the next batch of the
+ * frame is usually a few microseconds away) and then sleep until run() is called again.
+ */
+void JobSystem::_workerLoop(const int& index)
+{
+    t_jobSystem = this;
+    t_workerIndex = index;
+
+    int idle = 0;
+    while (!_quit.load(std::memory_order_relaxed))
+    {
+        uint64_t signal = _signal.load(std::memory_order_seq_cst);
+
+        Job* job = _findJob(index);
+        if (job)
+        {
+            _execute(index, job);
+            idle = 0;
+            continue;
+        }
+
+        if (++idle < SPIN_ROUNDS)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(_sleepMutex);
+        _sleeping.fetch_add(1, std::memory_order_seq_cst);
+        _wakeUp.wait(lock, [&]() { return _quit.load() || _signal.load(std::memory_order_seq_cst) != signal; });
+        _sleeping.fetch_sub(1, std::memory_order_seq_cst);
+        idle = 0;
+    }
+}
+
+void JobSystem::_execute(const int& index, Job* job)
+{
+    job->function(job->data, job->begin, job->end);
+
+    Worker& worker = *_workers[index];
+    worker.executed.store(worker.executed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    job->counter->pending.fetch_sub(1, std::memory_order_release);
+}
+
+/* _findJob: the bottom of the own deque first, then steal from the top of the others, starting from a random one */
+Job* JobSystem::_findJob(const int& index)
+{
+    Worker& worker = *_workers[index];
+
+    Job* job = _pop(worker);
+    if (job)
+        return job;
+
+    int count = _workers.size();
+    if (count == 1)
+        return nullptr;
+
+    worker.random ^= worker.random << 13;
+    worker.random ^= worker.random >> 17;
+    worker.random ^= worker.random << 5;
+
+    int first = worker.random % count;
+    for (int i = 0; i < count; ++i)
+    {
+        int victim = (first + i) % count;
+        if (victim == index)
+            continue;
+
+        job = _steal(*_workers[victim]);
+        if (job)
+        {
+            worker.stolen.store(worker.stolen.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    return nullptr;
+}
+
+/* Chase-Lev deque with the memory orderings of "Correct and Efficient Work-Stealing for Weak Memory Models"
+ * (Le, Pop, Cohen, Zappa Nardelli, 2013). The capacity is fixed: when it is full, _push() fails and the caller
+ * runs the job itself. The slots are also written/read with release/acquire so that the contents of a stolen job
+ * are visible to the thief without relying on the fences alone (ThreadSanitizer doesn't understand them).
+ */
+
+bool JobSystem::_push(Worker& worker, Job* job)
+{
+    int64_t b = worker.bottom.load(std::memory_order_relaxed);
+    int64_t t = worker.top.load(std::memory_order_acquire);
+    if (b - t >= JOB_QUEUE_CAPACITY)
+        return false;
+
+    worker.deque[b & (JOB_QUEUE_CAPACITY - 1)].store(job, std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_release);
+    worker.bottom.store(b + 1, std::memory_order_relaxed);
+    return true;
+}
+
+Job* JobSystem::_pop(Worker& worker)
+{
+    int64_t b = worker.bottom.load(std::memory_order_relaxed) - 1;
+    worker.bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = worker.top.load(std::memory_order_relaxed);
+
+    if (t > b)
+    {
+        // empty
+        worker.bottom.store(b + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Job* job = worker.deque[b & (JOB_QUEUE_CAPACITY - 1)].load(std::memory_order_relaxed);
+    if (t == b)
+    {
+        // last job: race against the thieves for it
+        if (!worker.top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            job = nullptr;
+
+        worker.bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    return job;
+}
+
+Job* JobSystem::_steal(Worker& worker)
+{
+    int64_t t = worker.top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = worker.bottom.load(std::memory_order_acquire);
+
+    if (t >= b)
+        return nullptr;
+
+    Job* job = worker.deque[t & (JOB_QUEUE_CAPACITY - 1)].load(std::memory_order_acquire);
+    if (!worker.top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return nullptr;
+
+    return job;
+}
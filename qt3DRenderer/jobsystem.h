@@ -0,0 +1,164 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define JOB_QUEUE_CAPACITY 4096     // jobs per worker (power of 2): deque slots and stack of parallelFor() jobs
+
+
+// JobFunction: the work of a job, called with the range [begin, end) of items it owns
+typedef void (*JobFunction)(void* data, unsigned int begin, unsigned int end);
+
+// JobCounter: number of jobs of a batch that are still pending. wait() returns when it reaches zero
+struct JobCounter
+{
+    JobCounter() : pending(0) { }
+
+    std::atomic<int> pending;
+};
+
+// Job: a range of items to be processed by a function. The memory of a job belongs to whoever calls run() and must
+// stay valid until its counter reaches zero
+struct Job
+{
+    JobFunction function;
+    void* data;
+    unsigned int begin;
+    unsigned int end;
+    JobCounter* counter;
+};
+
+
+/* JobSystem: a pool of worker threads that is created once and reused by every stage of every frame.
+ *
+ * Each worker owns a Chase-Lev deque: jobs are pushed and popped at the bottom by the owner (LIFO, cache friendly)
+ * and stolen at the top by the other workers when they run out of work (FIFO, the biggest pieces of work first).
+ * The thread that created the JobSystem is worker 0: it submits the work of the frame and helps running it while it
+ * waits, so a JobSystem with a single thread runs everything inline without any synchronization.
+ *
+ * Dependencies are expressed with counters: a stage that needs the results of another one calls wait() on its counter
+ * before submitting its own jobs. Jobs can submit and wait for other jobs too (nested parallelFor()).
+ */
+class JobSystem
+{
+public:
+    JobSystem();
+    ~JobSystem();
+
+    // setThreadCount: number of threads including the caller (0 = QThread::idealThreadCount()). Restarts the workers
+    void setThreadCount(const int& threads);
+
+    // threadCount: number of threads running jobs, including the caller
+    int threadCount();
+
+    // run: submit count jobs that decrement counter when they are done. Must be called from the thread that created
+    // the JobSystem or from a job
+    void run(Job* jobs, const unsigned int& count, JobCounter& counter);
+
+    // wait: run jobs until the counter reaches zero
+    void wait(JobCounter& counter);
+
+    // parallelFor: call func(begin, end) on ranges of at most grain items that cover [0, count), and wait for them
+    template <typename Func>
+    void parallelFor(const unsigned int& count, const unsigned int& grain, const Func& func);
+
+    // executed/stolen: number of jobs run (and how many of them were stolen from another worker) since resetStats()
+    uint64_t executed();
+    uint64_t stolen();
+    void resetStats();
+
+private:
+    // Worker: the deque and the job stack of a thread, aligned so that two workers never share a cache line
+    struct alignas(64) Worker
+    {
+        alignas(64) std::atomic<int64_t> top;      // written by the thieves
+        alignas(64) std::atomic<int64_t> bottom;   // written by the owner
+        std::atomic<Job*> deque[JOB_QUEUE_CAPACITY];
+
+        Job stack[JOB_QUEUE_CAPACITY];             // jobs of the parallelFor() calls of this worker, released in LIFO order
+        unsigned int stackTop;
+
+        std::atomic<uint64_t> executed;
+        std::atomic<uint64_t> stolen;
+        uint32_t random;                           // xorshift state to pick the victims of the steals
+
+        std::thread thread;
+    };
+
+    void _startWorkers(const int& threads);
+    void _stopWorkers();
+    void _workerLoop(const int& index);
+    int _currentWorker();
+
+    bool _push(Worker& worker, Job* job);
+    Job* _pop(Worker& worker);
+    Job* _steal(Worker& worker);
+    Job* _findJob(const int& index);
+    void _execute(const int& index, Job* job);
+
+    template <typename Func>
+    static void _invoke(void* data, unsigned int begin, unsigned int end);
+
+    std::vector<Worker*> _workers;
+
+    std::atomic<bool> _quit;
+    std::atomic<uint64_t> _signal;     // incremented on every run(): sleeping workers wake up when it changes
+    std::atomic<int> _sleeping;
+    std::mutex _sleepMutex;
+    std::condition_variable _wakeUp;
+};
+
+
+template <typename Func>
+void JobSystem::_invoke(void* data, unsigned int begin, unsigned int end)
+{
+    (*static_cast<const Func*>(data))(begin, end);
+}
+
+template <typename Func>
+void JobSystem::parallelFor(const unsigned int& count, const unsigned int& grain, const Func& func)
+{
+    if (count == 0)
+        return;
+
+    unsigned int step = std::max(grain, 1u);
+    unsigned int numJobs = (count + step - 1) / step;
+
+    Worker& worker = *_workers[_currentWorker()];
+    unsigned int available = JOB_QUEUE_CAPACITY - worker.stackTop;
+
+    // a single job, or no threads to share it with: no need to go through the deques
+    if (numJobs == 1 || _workers.size() == 1 || available == 0)
+    {
+        func(0, count);
+        return;
+    }
+
+    // not enough room on the stack of this worker: bigger jobs
+    if (numJobs > available)
+    {
+        step = (count + available - 1) / available;
+        numJobs = (count + step - 1) / step;
+    }
+
+    Job* jobs = &worker.stack[worker.stackTop];
+    worker.stackTop += numJobs;
+
+    for (unsigned int j = 0; j < numJobs; ++j)
+    {
+        jobs[j].function = &JobSystem::_invoke<Func>;
+        jobs[j].data = const_cast<Func*>(&func);
+        jobs[j].begin = j * step;
+        jobs[j].end = std::min(count, (j + 1) * step);
+    }
+
+    JobCounter counter;
+    run(jobs, numJobs, counter);
+    wait(counter);
+
+    worker.stackTop -= numJobs;
+}
@@ -1,13 +1,29 @@
-#pragma once
-#include "vec3d.h"
-
-class Light
-{
-public:
-    Light();
-
-    // calculate new color value based on a percentage factor that represents the light intensity
-    static uint32_t calcIntensity(const uint32_t& color, float intensityPercent);
-
-    Vec3d direction;
-};
+#pragma once
+#include "vec3d.h"
+
+#include <stdint.h>
+
+enum LIGHT_TYPE
+{
+    DIRECTIONAL,            // parallel rays going towards direction (the sun)
+    POINT                   // rays leaving position in every direction, fading with the distance
+};
+
+class Light
+{
+public:
+    Light();
+    Light(const LIGHT_TYPE& type, const Vec3d& vector, const uint32_t& color = 0xFFFFFFFF, const float& intensity = 1.f);
+
+    // calculate new color value based on a percentage factor that represents the light intensity
+    static uint32_t calcIntensity(const uint32_t& color, float intensityPercent);
+
+    LIGHT_TYPE type;
+    Vec3d direction;        // DIRECTIONAL: where the rays go to
+    Vec3d position;         // POINT: where the rays come from
+    uint32_t color;         // RGB of the light (alpha is ignored)
+    float intensity;
+    float range;            // POINT: distance at which the light falls to half of its intensity
+    bool cameraSpace;       // direction/position are in Camera Space (the light moves with the camera) instead of World Space
+    bool castShadows;       // DIRECTIONAL: the Renderer draws its shadows (see ShadowMap)
+};
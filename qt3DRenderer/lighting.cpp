@@ -0,0 +1,233 @@
+#include "lighting.h"
+#include "vec4d.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define HAS_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define HAS_SSE2 0
+#endif
+
+#define MAX_INTENSITY 127.f         // higher intensities would overflow the 8.8 fixed point factors
+#define MIN_DISTANCE2 1e-12f        // a sample right on top of a point light
+
+
+// the variant of shade() bound by Lighting::bindKernels(), SSE2 until then when it's compiled in
+typedef void (Lighting::*ShadeKernel)(Lighting::Batch& batch, std::vector<uint32_t>& colors) const;
+static ShadeKernel g_shade = HAS_SSE2 ? &Lighting::shadeSse2 : &Lighting::shadeScalar;
+
+
+void Lighting::Batch::clear()
+{
+    count = 0;
+    nx.clear(); ny.clear(); nz.clear();
+    px.clear(); py.clear(); pz.clear();
+    colors.clear();
+}
+
+unsigned int Lighting::Batch::add(const Vec3d& normal, const Vec3d& position, const uint32_t& color)
+{
+    // the padding of a previous shade() is overwritten
+    if (nx.size() > count)
+    {
+        nx.resize(count); ny.resize(count); nz.resize(count);
+        px.resize(count); py.resize(count); pz.resize(count);
+        colors.resize(count);
+    }
+
+    nx.push_back(normal.x); ny.push_back(normal.y); nz.push_back(normal.z);
+    px.push_back(position.x); py.push_back(position.y); pz.push_back(position.z);
+    colors.push_back(color);
+
+    return count++;
+}
+
+unsigned int Lighting::Batch::size() const
+{
+    return count;
+}
+
+
+Lighting::Lighting()
+{
+    _count = 0;
+    _ambient = 0.f;
+}
+
+void Lighting::setLights(const std::vector<Light>& lights, const Mat4& viewMatrix)
+{
+    _count = std::min((int)lights.size(), MAX_LIGHTS);
+
+    for (int l = 0; l < _count; ++l)
+    {
+        const Light& light = lights[l];
+
+        if (light.type == LIGHT_TYPE::DIRECTIONAL)
+        {
+            // the vector to the light is the same for every sample: the opposite of the direction of the rays
+            Vec4d direction(light.direction.x, light.direction.y, light.direction.z, 0.f);
+            if (!light.cameraSpace)
+                direction = direction * viewMatrix;
+
+            Vec3d toLight = Vec3d(-direction.x, -direction.y, -direction.z);
+            toLight.norm();
+
+            _x[l] = toLight.x; _y[l] = toLight.y; _z[l] = toLight.z;
+            _w[l] = 0.f;
+            _invRange2[l] = 0.f;
+        }
+        else
+        {
+            Vec4d position = Vec3d::toVec4d(light.position);
+            if (!light.cameraSpace)
+                position = position * viewMatrix;
+
+            _x[l] = position.x; _y[l] = position.y; _z[l] = position.z;
+            _w[l] = 1.f;
+            _invRange2[l] = (light.range > 0.f) ? 1.f / (light.range * light.range) : 0.f;
+        }
+
+        _r[l] = ((light.color >> 16) & 0xFF) / 255.f * light.intensity;
+        _g[l] = ((light.color >> 8) & 0xFF) / 255.f * light.intensity;
+        _b[l] = (light.color & 0xFF) / 255.f * light.intensity;
+    }
+}
+
+void Lighting::setAmbient(const float& ambient)
+{
+    _ambient = ambient;
+}
+
+int Lighting::lightCount() const
+{
+    return _count;
+}
+
+void Lighting::bindKernels(const CPU_LEVEL& level)
+{
+    CPU_LEVEL variant = (HAS_SSE2 && level >= CPU_SSE2) ? CPU_SSE2 : CPU_SCALAR;
+    g_shade = (variant == CPU_SSE2) ? &Lighting::shadeSse2 : &Lighting::shadeScalar;
+
+    CpuDispatch::setKernel("lighting", variant);
+}
+
+void Lighting::shade(Batch& batch, std::vector<uint32_t>& colors) const
+{
+    (this->*g_shade)(batch, colors);
+}
+
+/* shadeSse2: for each group of 4 samples and for each light:
+ *      L = light - w * position                (w = 0 for directional lights, so L is their constant direction)
+ *      diffuse = max(N.L, 0) / |L| / (1 + |L|^2 / range^2)
+ *      intensity += diffuse * color of the light
+ * then color * intensity in 8.8 fixed point, saturated to 255 by the packs.
+ */
+void Lighting::shadeSse2(Batch& batch, std::vector<uint32_t>& colors) const
+{
+#if HAS_SSE2
+    unsigned int padded = (batch.count + 3) & ~3u;
+    batch.nx.resize(padded); batch.ny.resize(padded); batch.nz.resize(padded);
+    batch.px.resize(padded); batch.py.resize(padded); batch.pz.resize(padded);
+    batch.colors.resize(padded);
+    colors.resize(padded);
+
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 minDistance2 = _mm_set1_ps(MIN_DISTANCE2);
+    const __m128 maxIntensity = _mm_set1_ps(MAX_INTENSITY);
+    const __m128 fixedOne = _mm_set1_ps(256.f);
+    const __m128i alphaFactor = _mm_set1_epi32(256);
+    const __m128i zeroi = _mm_setzero_si128();
+
+    for (unsigned int i = 0; i < padded; i += 4)
+    {
+        __m128 nx = _mm_loadu_ps(&batch.nx[i]), ny = _mm_loadu_ps(&batch.ny[i]), nz = _mm_loadu_ps(&batch.nz[i]);
+        __m128 px = _mm_loadu_ps(&batch.px[i]), py = _mm_loadu_ps(&batch.py[i]), pz = _mm_loadu_ps(&batch.pz[i]);
+
+        __m128 r = _mm_set1_ps(_ambient), g = r, b = r;
+
+        for (int l = 0; l < _count; ++l)
+        {
+            __m128 w = _mm_set1_ps(_w[l]);
+            __m128 lx = _mm_sub_ps(_mm_set1_ps(_x[l]), _mm_mul_ps(w, px));
+            __m128 ly = _mm_sub_ps(_mm_set1_ps(_y[l]), _mm_mul_ps(w, py));
+            __m128 lz = _mm_sub_ps(_mm_set1_ps(_z[l]), _mm_mul_ps(w, pz));
+
+            __m128 distance2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(lx, lx), _mm_mul_ps(ly, ly)), _mm_mul_ps(lz, lz));
+            distance2 = _mm_max_ps(distance2, minDistance2);
+            __m128 invDistance = _mm_div_ps(one, _mm_sqrt_ps(distance2));
+
+            __m128 nDotL = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, lx), _mm_mul_ps(ny, ly)), _mm_mul_ps(nz, lz));
+            nDotL = _mm_max_ps(_mm_mul_ps(nDotL, invDistance), zero);
+
+            __m128 attenuation = _mm_div_ps(one, _mm_add_ps(one, _mm_mul_ps(distance2, _mm_set1_ps(_invRange2[l]))));
+            __m128 diffuse = _mm_mul_ps(nDotL, attenuation);
+
+            r = _mm_add_ps(r, _mm_mul_ps(diffuse, _mm_set1_ps(_r[l])));
+            g = _mm_add_ps(g, _mm_mul_ps(diffuse, _mm_set1_ps(_g[l])));
+            b = _mm_add_ps(b, _mm_mul_ps(diffuse, _mm_set1_ps(_b[l])));
+        }
+
+        // 8.8 fixed point factors, interleaved as B G R A like the bytes of the ARGB colors
+        __m128i ir = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(r, maxIntensity), fixedOne));
+        __m128i ig = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(g, maxIntensity), fixedOne));
+        __m128i ib = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(b, maxIntensity), fixedOne));
+
+        __m128i bg = _mm_packs_epi32(ib, ig);                   // b0 b1 b2 b3 g0 g1 g2 g3
+        __m128i ra = _mm_packs_epi32(ir, alphaFactor);          // r0 r1 r2 r3 a  a  a  a
+        __m128i brbr = _mm_unpacklo_epi16(bg, ra);              // b0 r0 b1 r1 b2 r2 b3 r3
+        __m128i gaga = _mm_unpackhi_epi16(bg, ra);              // g0 a  g1 a  g2 a  g3 a
+        __m128i factorsLo = _mm_unpacklo_epi16(brbr, gaga);     // b0 g0 r0 a  b1 g1 r1 a
+        __m128i factorsHi = _mm_unpackhi_epi16(brbr, gaga);     // b2 g2 r2 a  b3 g3 r3 a
+
+        // (channel << 8) * factor >> 16 == channel * factor / 256, saturated to 255 when packed back to bytes
+        __m128i base = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&batch.colors[i]));
+        __m128i lo = _mm_mulhi_epu16(_mm_unpacklo_epi8(zeroi, base), factorsLo);
+        __m128i hi = _mm_mulhi_epu16(_mm_unpackhi_epi8(zeroi, base), factorsHi);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&colors[i]), _mm_packus_epi16(lo, hi));
+    }
+#else
+    shadeScalar(batch, colors);
+#endif
+}
+
+void Lighting::shadeScalar(Batch& batch, std::vector<uint32_t>& colors) const
+{
+    colors.resize(batch.count);
+
+    for (unsigned int i = 0; i < batch.count; ++i)
+    {
+        float intensity[3] = { _ambient, _ambient, _ambient };
+
+        for (int l = 0; l < _count; ++l)
+        {
+            float lx = _x[l] - _w[l] * batch.px[i];
+            float ly = _y[l] - _w[l] * batch.py[i];
+            float lz = _z[l] - _w[l] * batch.pz[i];
+
+            float distance2 = std::max(lx * lx + ly * ly + lz * lz, MIN_DISTANCE2);
+            float invDistance = 1.f / std::sqrt(distance2);
+
+            float nDotL = std::max((batch.nx[i] * lx + batch.ny[i] * ly + batch.nz[i] * lz) * invDistance, 0.f);
+            float diffuse = nDotL * (1.f / (1.f + distance2 * _invRange2[l]));
+
+            intensity[0] += diffuse * _r[l];
+            intensity[1] += diffuse * _g[l];
+            intensity[2] += diffuse * _b[l];
+        }
+
+        uint32_t color = batch.colors[i] & 0xFF000000;
+        for (int c = 0; c < 3; ++c)
+        {
+            uint32_t factor = (uint32_t)(std::min(intensity[c], MAX_INTENSITY) * 256.f);
+            uint32_t channel = (batch.colors[i] >> (16 - 8 * c)) & 0xFF;
+            color |= std::min((channel * factor) >> 8, 255u) << (16 - 8 * c);
+        }
+
+        colors[i] = color;
+    }
+}
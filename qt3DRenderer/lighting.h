@@ -0,0 +1,72 @@
+#pragma once
+#include <stdint.h>
+
+#include <vector>
+
+#include "cpudispatch.h"
+#include "light.h"
+#include "mat4.h"
+#include "vec3d.h"
+
+#define MAX_LIGHTS 8            // lights evaluated by the lighting stage (the others are ignored)
+
+
+/* Lighting: evaluates all the lights for a batch of surface samples (a normal, a position and a base color, all in
+ * Camera Space) at once. The geometry stage collects one sample per face (flat shading) or one per triangle vertex
+ * (Gouraud shading) and shades the whole batch after the faces are transformed.
+ *
+ * The samples are stored as Structure of Arrays, so 4 samples are lit together with SSE2 and every light costs the
+ * same handful of vector instructions (directional and point lights go through the same code: a directional light
+ * is a point light at infinity). The intensities of the 3 channels are converted to 8.8 fixed point and multiplied
+ * with the base colors using saturating 16-bit integer math, which also packs them back to ARGB.
+ */
+class Lighting
+{
+public:
+    // Batch: the samples waiting to be shaded. The arrays are padded to a multiple of 4 by Lighting::shade()
+    struct Batch
+    {
+        void clear();
+
+        // add: a sample with a unit normal. Returns its index in the colors produced by shade()
+        unsigned int add(const Vec3d& normal, const Vec3d& position, const uint32_t& color);
+
+        unsigned int size() const;
+
+        std::vector<float> nx, ny, nz;
+        std::vector<float> px, py, pz;
+        std::vector<uint32_t> colors;
+        unsigned int count = 0;
+    };
+
+    Lighting();
+
+    // bindKernels: the variant of shade() used by every Lighting (see CpuDispatch)
+    static void bindKernels(const CPU_LEVEL& level);
+
+    // setLights: brings the lights to Camera Space. Only the first MAX_LIGHTS are used
+    void setLights(const std::vector<Light>& lights, const Mat4& viewMatrix);
+
+    // setAmbient: intensity added to every sample, lit or not (0 = the sides facing away from the lights are black)
+    void setAmbient(const float& ambient);
+
+    int lightCount() const;
+
+    // shade: the lit ARGB color of each sample of the batch (alpha is kept), with the variant bound by bindKernels()
+    void shade(Batch& batch, std::vector<uint32_t>& colors) const;
+
+    // shadeScalar: same result of shade() one sample at a time, without SIMD
+    void shadeScalar(Batch& batch, std::vector<uint32_t>& colors) const;
+
+    // shadeSse2: same result of shade() 4 samples at a time (shadeScalar() when SSE2 isn't compiled in)
+    void shadeSse2(Batch& batch, std::vector<uint32_t>& colors) const;
+
+private:
+    // lights in Camera Space, as Structure of Arrays: L = _x,_y,_z - _w * position of the sample
+    float _x[MAX_LIGHTS], _y[MAX_LIGHTS], _z[MAX_LIGHTS], _w[MAX_LIGHTS];
+    float _invRange2[MAX_LIGHTS];
+    float _r[MAX_LIGHTS], _g[MAX_LIGHTS], _b[MAX_LIGHTS];
+
+    int _count;
+    float _ambient;
+};
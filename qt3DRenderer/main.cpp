@@ -1,16 +1,126 @@
-#include "window.h"
-#include <QApplication>
-
-int main(int argc, char* argv[])
-{
-    QApplication app(argc, argv);
-
-    Window win;
-    //win.resize(1280, 900);
-
-    win.show();
-    //win.showFullScreen();
-    //win.showMaximized();
-
-    return app.exec();
-}
+#include "window.h"
+#include "benchmark.h"
+#include "cpudispatch.h"
+#include "meshoptimizer.h"
+#include "objloader.h"
+#include "offlinerenderer.h"
+#include "pagedmesh.h"
+#include "regression.h"
+#include <QApplication>
+#include <QDir>
+#include <QFileInfo>
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#define DEFAULT_SCENE "scene.json"     // in the assets directory
+
+
+/* assetsDir: the assets directory of the source tree, looked up from the working directory and from the directory of
+ * the executable and its parents (a qmake shadow build is a sibling of the sources, with debug/release subdirectories
+ * on Windows). The headless modes run before QApplication exists, so the executable comes from argv[0].
+ */
+static std::string assetsDir(const char* argv0)
+{
+    QStringList candidates;
+    candidates << QDir::current().absoluteFilePath("assets");
+
+    QDir dir(QFileInfo(QString::fromLocal8Bit(argv0)).absolutePath());
+    for (int up = 0; up < 3; ++up)
+    {
+        candidates << dir.absoluteFilePath("assets") << dir.absoluteFilePath("qt3DRenderer/assets");
+        if (!dir.cdUp())
+            break;
+    }
+
+    for (const QString& candidate : candidates)
+        if (QFileInfo(candidate + "/" + DEFAULT_SCENE).exists())
+            return candidate.toStdString();
+
+    return std::string();
+}
+
+// defaultAssets: assetsDir(), only called by the modes that load the default assets (the warning is for them alone)
+static std::string defaultAssets(const char* argv0, const char* option)
+{
+    std::string assets = assetsDir(argv0);
+    if (!assets.empty())
+        return assets;
+
+    std::cerr << "main: assets directory not found, use " << option << std::endl;
+    return "assets";
+}
+
+// hasOption: one of the arguments is option (the defaults it replaces don't need to be looked up)
+static bool hasOption(const std::vector<std::string>& args, const std::string& option)
+{
+    return std::find(args.begin(), args.end(), option) != args.end();
+}
+
+int main(int argc, char* argv[])
+{
+    // the kernels of the CPU we're running on (QT3D_KERNELS=scalar|sse2|avx2 forces a lower level)
+    CpuDispatch::init();
+
+    std::vector<std::string> args(argv + 1, argv + argc);
+
+    // headless benchmarks don't need a window: qt3DRenderer --bench
+    if (!args.empty() && args[0] == "--bench")
+        return Benchmark::run(args);
+
+    // render a flythrough to a video stream: qt3DRenderer --render out.y4m [--scene scene.json] [--frames 300] ...
+    if (!args.empty() && args[0] == "--render")
+        return OfflineRenderer::run(args, hasOption(args, "--scene") ? std::string() :
+                                          defaultAssets(argv[0], "--scene") + "/" + DEFAULT_SCENE);
+
+    // golden images and frame time budgets of the rasterizer: qt3DRenderer --check [--update]
+    if (!args.empty() && args[0] == "--check")
+        return Regression::run(args, hasOption(args, "--assets") ? std::string() : defaultAssets(argv[0], "--assets"));
+
+    // split a huge .obj in pages for streaming: qt3DRenderer --build-pages mesh.obj mesh.pages
+    if (args.size() == 3 && args[0] == "--build-pages")
+    {
+        Mesh mesh = OBJLoader(args[1]).mesh();
+        MeshOptimizer::weldVertices(mesh);
+
+        if (!PagedMesh::build(mesh, args[2]))
+            return 1;
+
+        std::cout << "main: " << mesh.faces.size() << " faces written to " << args[2] << std::endl;
+        return 0;
+    }
+
+    QApplication app(argc, argv);
+
+    // qt3DRenderer [--scene scene.json] [--pages mesh.pages]
+    std::string sceneFile;
+    std::string pagesFile;
+    for (unsigned int i = 0; i + 1 < args.size(); i += 2)
+    {
+        if (args[i] == "--scene")
+            sceneFile = args[i + 1];
+        else if (args[i] == "--pages")
+            pagesFile = args[i + 1];
+    }
+
+    if (sceneFile.empty())
+        sceneFile = defaultAssets(argv[0], "--scene") + "/" + DEFAULT_SCENE;
+
+    Window win;
+
+    if (!win.openScene(sceneFile))
+        return 1;
+
+    // stream a page file written by --build-pages
+    if (!pagesFile.empty() && !win.openPagedMesh(pagesFile))
+        return 1;
+    //win.resize(1280, 900);
+
+    win.show();
+    //win.showFullScreen();
+    //win.showMaximized();
+
+    return app.exec();
+}
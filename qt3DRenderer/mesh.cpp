@@ -1,34 +1,133 @@
-#include "mesh.h"
-
-#include <cstring>
-
-
-Mesh::Mesh()
-{
-    scale       = Vec3d(1.f, 1.f, 1.f);
-    rotation    = Vec3d(0.f, 0.f, 0.f);
-    translation = Vec3d(0.f, 0.f, 0.f);
-
-    textureWidth = textureHeight = 0;
-}
-
-Mesh::Mesh(const uint32_t* texData, const int& texWidth, const int& texHeight)
-{
-    scale       = Vec3d(1.f, 1.f, 1.f);
-    rotation    = Vec3d(0.f, 0.f, 0.f);
-    translation = Vec3d(0.f, 0.f, 0.f);
-
-    setTexture(texData, texWidth, texHeight);
-}
-
-void Mesh::setTexture(const uint32_t* texData, const int& texWidth, const int& texHeight)
-{
-    // deep copy texture data
-    int texSize = texWidth * texHeight;
-    texture = std::shared_ptr<uint32_t[]>(new uint32_t[texSize]);
-    std::memcpy(texture.get(), (uint32_t*)texData, texSize * sizeof(uint32_t));
-
-    // initialize texture dimensions
-    textureWidth = texWidth;
-    textureHeight = texHeight;
-}
+#include "mesh.h"
+#include "meshoptimizer.h"
+#include "meshsimplifier.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+
+Mesh::Mesh()
+{
+    generation = newGeneration();
+    scale       = Vec3d(1.f, 1.f, 1.f);
+    rotation    = Vec3d(0.f, 0.f, 0.f);
+    translation = Vec3d(0.f, 0.f, 0.f);
+
+    textureWidth = textureHeight = 0;
+    boundsRadius = 0.f;
+}
+
+Mesh::Mesh(const uint32_t* texData, const int& texWidth, const int& texHeight)
+{
+    generation = newGeneration();
+    scale       = Vec3d(1.f, 1.f, 1.f);
+    rotation    = Vec3d(0.f, 0.f, 0.f);
+    translation = Vec3d(0.f, 0.f, 0.f);
+    boundsRadius = 0.f;
+
+    setTexture(texData, texWidth, texHeight);
+}
+
+void Mesh::setTexture(const uint32_t* texData, const int& texWidth, const int& texHeight)
+{
+    // deep copy texture data
+    int texSize = texWidth * texHeight;
+    texture = std::shared_ptr<uint32_t[]>(new uint32_t[texSize]);
+    std::memcpy(texture.get(), (uint32_t*)texData, texSize * sizeof(uint32_t));
+
+    // initialize texture dimensions
+    textureWidth = texWidth;
+    textureHeight = texHeight;
+}
+
+void Mesh::setTexture(const std::shared_ptr<uint32_t[]>& texData, const int& texWidth, const int& texHeight)
+{
+    texture = texData;
+    textureWidth = texWidth;
+    textureHeight = texHeight;
+}
+
+uint64_t Mesh::newGeneration()
+{
+    static std::atomic<uint64_t> next(1);
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+const Mesh* Mesh::geometry() const
+{
+    return (asset) ? asset.get() : this;
+}
+
+void Mesh::computeFacePlanes()
+{
+    faceNormals.resize(faces.size());
+    facePlaneOffsets.resize(faces.size());
+
+    for (unsigned int f = 0; f < faces.size(); ++f)
+    {
+        Vec3d a = vertices[faces[f].a];
+        Vec3d b = vertices[faces[f].b];
+        Vec3d c = vertices[faces[f].c];
+
+        // cross product of B-A and C-A: this order for Left-Handed Coordinate System
+        Vec3d normal = (b - a).cross(c - a);
+        normal.norm();
+
+        faceNormals[f] = normal;
+        facePlaneOffsets[f] = normal.dot(a);
+    }
+}
+
+void Mesh::computeBounds()
+{
+    boundsCenter = Vec3d(0.f, 0.f, 0.f);
+    boundsRadius = 0.f;
+    if (vertices.empty())
+        return;
+
+    // center of the axis-aligned box, then the farthest vertex from it
+    Vec3d minP = vertices[0], maxP = vertices[0];
+    for (unsigned int v = 1; v < vertices.size(); ++v)
+    {
+        minP = Vec3d(std::min(minP.x, vertices[v].x), std::min(minP.y, vertices[v].y), std::min(minP.z, vertices[v].z));
+        maxP = Vec3d(std::max(maxP.x, vertices[v].x), std::max(maxP.y, vertices[v].y), std::max(maxP.z, vertices[v].z));
+    }
+
+    boundsCenter = (minP + maxP) * 0.5f;
+    for (unsigned int v = 0; v < vertices.size(); ++v)
+        boundsRadius = std::max(boundsRadius, (vertices[v] - boundsCenter).mag());
+}
+
+void Mesh::generateLods(const int& levels, const bool& lockBorders)
+{
+    lods.clear();
+    lodErrors.clear();
+    computeBounds();
+
+    if (faces.size() < LOD_MIN_FACES)
+        return;
+
+    // each level is simplified from the previous one, so the errors add up
+    float error = 0.f;
+    for (int level = 0; level < levels; ++level)
+    {
+        const Mesh& previous = (level == 0) ? *this : lods.back();
+        unsigned int target = previous.faces.size() / 2;
+
+        float levelError = 0.f;
+        Mesh lod = MeshSimplifier::simplify(previous, target, &levelError, lockBorders);
+
+        // stop when the seams/borders don't allow the mesh to shrink anymore
+        if (lod.faces.size() > previous.faces.size() * 9 / 10)
+            break;
+
+        // the collapses leave the faces out of order for the vertex cache
+        MeshOptimizer::optimizeFaceOrder(lod);
+        MeshOptimizer::optimizeVertexOrder(lod);
+
+        error += levelError;
+        lods.push_back(lod);
+        lodErrors.push_back(error);
+    }
+}
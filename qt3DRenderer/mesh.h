@@ -1,25 +1,67 @@
-#pragma once
-#include "vec3d.h"
-#include "face.h"
-
-#include <vector>
-
-
-class Mesh
-{
-public:
-    Mesh();
-    Mesh(const uint32_t* texData, const int& texWidth, const int& texHeight);
-    void setTexture(const uint32_t* texData, const int& texWidth, const int& texHeight);
-
-    std::vector<Vec3d> vertices;
-    std::vector<Face> faces;
-
-    std::shared_ptr<uint32_t[]> texture;
-    int textureWidth;
-    int textureHeight;
-
-    Vec3d rotation;                     // current rotation of the mesh
-    Vec3d scale;                        // current scale
-    Vec3d translation;                  // current translation
-};
+#pragma once
+#include "vec3d.h"
+#include "face.h"
+
+#include <cstdint>
+#include <vector>
+
+#define LOD_MIN_FACES 64     // smaller meshes are not worth simplifying
+
+
+class Mesh
+{
+public:
+    Mesh();
+    Mesh(const uint32_t* texData, const int& texWidth, const int& texHeight);
+    void setTexture(const uint32_t* texData, const int& texWidth, const int& texHeight);
+
+    // setTexture: share the pixels of a texture (e.g. one loaded by AssetManager) instead of copying them
+    void setTexture(const std::shared_ptr<uint32_t[]>& texData, const int& texWidth, const int& texHeight);
+
+    // newGeneration: a number no other mesh got, from any thread
+    static uint64_t newGeneration();
+
+    // geometry: the mesh whose vertices, faces, normals and LODs are drawn (asset when there's one, otherwise itself)
+    const Mesh* geometry() const;
+
+    // computeFacePlanes: precompute the plane of each face in Model Space for object-space backface culling
+    void computeFacePlanes();
+
+    // computeBounds: the sphere (in Model Space) that contains all the vertices
+    void computeBounds();
+
+    // generateLods: simplified versions of the mesh (each one with half of the faces of the previous level) to be used
+    // when the mesh is far from the camera. Meshes with less than LOD_MIN_FACES faces don't get any. lockBorders keeps
+    // the borders of the mesh the same on every level (see MeshSimplifier::simplify())
+    void generateLods(const int& levels = 3, const bool& lockBorders = false);
+
+    // generation: identifies the geometry of the mesh for the caches, which can't rely on its address (a mesh freed and
+    // another one allocated at the same place). Every new mesh gets one, a copy keeps it
+    uint64_t generation;
+
+    std::vector<Vec3d> vertices;
+    std::vector<Face> faces;
+    std::vector<Vec3d> normals;             // vertex normals (vn) of the .obj, used by Gouraud shading. Shared by the LODs
+
+    std::vector<Vec3d> faceNormals;         // normal of each face in Model Space (same winding as Vec4d::normal)
+    std::vector<float> facePlaneOffsets;    // the plane of a face is: faceNormals[f].dot(p) == facePlaneOffsets[f]
+
+    Vec3d boundsCenter;                     // bounding sphere in Model Space
+    float boundsRadius;
+
+    std::vector<Mesh> lods;                 // lods[i] is level i+1: only vertices, faces and texture are used
+    std::vector<float> lodErrors;           // estimated distance (Model Space units) of lods[i] from this mesh: the
+                                            // sum of the largest RMS quadric distances of the levels, not a bound
+
+    // asset: an immutable mesh shared by several meshes of the scene. When set, only the transforms and the texture
+    // of this mesh are used, its own vertices and faces are ignored
+    std::shared_ptr<const Mesh> asset;
+
+    std::shared_ptr<uint32_t[]> texture;
+    int textureWidth;
+    int textureHeight;
+
+    Vec3d rotation;                     // current rotation of the mesh
+    Vec3d scale;                        // current scale
+    Vec3d translation;                  // current translation
+};
@@ -0,0 +1,226 @@
+#include "meshoptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#define CACHE_DECAY_POWER 1.5f
+#define LAST_FACE_SCORE 0.75f
+#define VALENCE_BOOST_SCALE 2.0f
+#define VALENCE_BOOST_POWER 0.5f
+
+
+// vertexScore: how much the faces that use a vertex are worth drawing next (Forsyth)
+static float vertexScore(const int& cachePosition, const int& remainingFaces, const int& cacheSize)
+{
+    // no faces left: the vertex doesn't matter anymore
+    if (remainingFaces == 0)
+        return -1.f;
+
+    float score = 0.f;
+    if (cachePosition >= 0)
+    {
+        // the vertices of the last face get a fixed score, so that the next face doesn't just reuse the same edge
+        if (cachePosition < 3)
+            score = LAST_FACE_SCORE;
+        else
+            score = std::pow(1.f - (cachePosition - 3) / (float)(cacheSize - 3), CACHE_DECAY_POWER);
+    }
+
+    // vertices with few faces left go first
+    score += VALENCE_BOOST_SCALE * std::pow((float)remainingFaces, -VALENCE_BOOST_POWER);
+    return score;
+}
+
+
+void MeshOptimizer::optimize(Mesh& mesh)
+{
+    weldVertices(mesh);
+    optimizeFaceOrder(mesh);
+    optimizeVertexOrder(mesh);
+}
+
+void MeshOptimizer::weldVertices(Mesh& mesh)
+{
+    // sort the vertices by position: the duplicates end up next to each other
+    std::vector<unsigned int> sorted(mesh.vertices.size());
+    for (unsigned int v = 0; v < sorted.size(); ++v)
+        sorted[v] = v;
+
+    const std::vector<Vec3d>& vertices = mesh.vertices;
+    std::sort(sorted.begin(), sorted.end(), [&vertices](const unsigned int& a, const unsigned int& b)
+    {
+        if (vertices[a].x != vertices[b].x) return vertices[a].x < vertices[b].x;
+        if (vertices[a].y != vertices[b].y) return vertices[a].y < vertices[b].y;
+        if (vertices[a].z != vertices[b].z) return vertices[a].z < vertices[b].z;
+        return a < b;
+    });
+
+    // each vertex points to the first one (lowest index) with the same position
+    std::vector<int> remap(mesh.vertices.size());
+    for (unsigned int i = 0; i < sorted.size(); ++i)
+    {
+        const Vec3d& p = vertices[sorted[i]];
+        bool duplicate = (i > 0) && p.x == vertices[sorted[i-1]].x && p.y == vertices[sorted[i-1]].y && p.z == vertices[sorted[i-1]].z;
+        remap[sorted[i]] = duplicate ? remap[sorted[i-1]] : sorted[i];
+    }
+
+    for (unsigned int f = 0; f < mesh.faces.size(); ++f)
+    {
+        mesh.faces[f].a = remap[mesh.faces[f].a];
+        mesh.faces[f].b = remap[mesh.faces[f].b];
+        mesh.faces[f].c = remap[mesh.faces[f].c];
+    }
+
+    // the duplicates are not used anymore and are dropped by optimizeVertexOrder()
+    optimizeVertexOrder(mesh);
+}
+
+void MeshOptimizer::optimizeFaceOrder(Mesh& mesh, const int& cacheSize)
+{
+    const unsigned int numFaces = mesh.faces.size();
+    const unsigned int numVertices = mesh.vertices.size();
+    if (numFaces == 0)
+        return;
+
+    // the faces not drawn yet that use each vertex
+    std::vector<std::vector<unsigned int>> vertexFaces(numVertices);
+    for (unsigned int f = 0; f < numFaces; ++f)
+    {
+        vertexFaces[mesh.faces[f].a].push_back(f);
+        vertexFaces[mesh.faces[f].b].push_back(f);
+        vertexFaces[mesh.faces[f].c].push_back(f);
+    }
+
+    std::vector<int> cachePosition(numVertices, -1);
+    std::vector<float> scores(numVertices);
+    for (unsigned int v = 0; v < numVertices; ++v)
+        scores[v] = vertexScore(-1, vertexFaces[v].size(), cacheSize);
+
+    std::vector<float> faceScores(numFaces);
+    std::vector<bool> added(numFaces, false);
+    for (unsigned int f = 0; f < numFaces; ++f)
+        faceScores[f] = scores[mesh.faces[f].a] + scores[mesh.faces[f].b] + scores[mesh.faces[f].c];
+
+    std::vector<unsigned int> order;
+    std::vector<unsigned int> cache, newCache;     // most recently used first
+    unsigned int cursor = 0;                        // the faces before it are all added
+    int best = -1;
+
+    while (order.size() < numFaces)
+    {
+        // nothing left around the cached vertices: start again from the next face that isn't added. The cursor only
+        // moves forward, so a restart doesn't scan all the faces again (quadratic on meshes made of many pieces)
+        if (best < 0)
+        {
+            while (added[cursor])
+                ++cursor;
+            best = cursor;
+        }
+
+        order.push_back(best);
+        added[best] = true;
+
+        const Face& face = mesh.faces[best];
+        unsigned int faceVertices[3] = { (unsigned int)face.a, (unsigned int)face.b, (unsigned int)face.c };
+
+        // the vertices of the face go to the front of the cache
+        newCache.clear();
+        for (int i = 0; i < 3; ++i)
+        {
+            std::vector<unsigned int>& faces = vertexFaces[faceVertices[i]];
+            std::vector<unsigned int>::iterator it = std::find(faces.begin(), faces.end(), (unsigned int)best);
+            if (it != faces.end())
+                faces.erase(it);
+
+            if (std::find(newCache.begin(), newCache.end(), faceVertices[i]) == newCache.end())
+                newCache.push_back(faceVertices[i]);
+        }
+
+        for (unsigned int i = 0; i < cache.size(); ++i)
+            if (std::find(newCache.begin(), newCache.end(), cache[i]) == newCache.end())
+                newCache.push_back(cache[i]);
+
+        // update the scores of the vertices that moved in the cache (or left it) and of their faces
+        best = -1;
+        for (unsigned int i = 0; i < newCache.size(); ++i)
+        {
+            unsigned int v = newCache[i];
+            cachePosition[v] = (i < (unsigned int)cacheSize) ? i : -1;
+            scores[v] = vertexScore(cachePosition[v], vertexFaces[v].size(), cacheSize);
+        }
+
+        for (unsigned int i = 0; i < newCache.size(); ++i)
+            for (unsigned int f : vertexFaces[newCache[i]])
+            {
+                faceScores[f] = scores[mesh.faces[f].a] + scores[mesh.faces[f].b] + scores[mesh.faces[f].c];
+                if (best < 0 || faceScores[f] > faceScores[best])
+                    best = f;
+            }
+
+        if (newCache.size() > (unsigned int)cacheSize)
+            newCache.resize(cacheSize);
+
+        cache.swap(newCache);
+    }
+
+    std::vector<Face> faces;
+    faces.reserve(numFaces);
+    for (unsigned int f = 0; f < numFaces; ++f)
+        faces.push_back(mesh.faces[order[f]]);
+
+    mesh.faces.swap(faces);
+
+    // the planes of the faces follow the order of the faces
+    mesh.faceNormals.clear();
+    mesh.facePlaneOffsets.clear();
+}
+
+void MeshOptimizer::optimizeVertexOrder(Mesh& mesh)
+{
+    std::vector<int> remap(mesh.vertices.size(), -1);
+    std::vector<Vec3d> vertices;
+    vertices.reserve(mesh.vertices.size());
+
+    for (unsigned int f = 0; f < mesh.faces.size(); ++f)
+    {
+        int* indexes[3] = { &mesh.faces[f].a, &mesh.faces[f].b, &mesh.faces[f].c };
+        for (int i = 0; i < 3; ++i)
+        {
+            int& index = *indexes[i];
+            if (remap[index] < 0)
+            {
+                remap[index] = vertices.size();
+                vertices.push_back(mesh.vertices[index]);
+            }
+            index = remap[index];
+        }
+    }
+
+    mesh.vertices.swap(vertices);
+}
+
+float MeshOptimizer::cacheHitRate(const Mesh& mesh)
+{
+    if (mesh.faces.empty())
+        return 0.f;
+
+    // the same direct mapped cache of Renderer::_processGraphicsPipeline()
+    int tags[VERTEX_CACHE_SIZE];
+    std::fill(tags, tags + VERTEX_CACHE_SIZE, -1);
+
+    unsigned int hits = 0;
+    for (unsigned int f = 0; f < mesh.faces.size(); ++f)
+    {
+        int indexes[3] = { mesh.faces[f].a, mesh.faces[f].b, mesh.faces[f].c };
+        for (int i = 0; i < 3; ++i)
+        {
+            int slot = indexes[i] & (VERTEX_CACHE_SIZE - 1);
+            if (tags[slot] == indexes[i])
+                ++hits;
+            else
+                tags[slot] = indexes[i];
+        }
+    }
+
+    return hits / (3.f * mesh.faces.size());
+}
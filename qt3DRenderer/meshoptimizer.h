@@ -0,0 +1,32 @@
+#pragma once
+#include "mesh.h"
+
+#define VERTEX_CACHE_SIZE 64     // entries of the post-transform vertex cache of the geometry stage (power of 2)
+
+
+/* MeshOptimizer: load time passes that make the geometry stage reuse the vertices it has just transformed.
+ *
+ * The geometry stage keeps the last transformed vertices in a small cache indexed by the vertex index (see
+ * Renderer::_processGraphicsPipeline), so a vertex shared by consecutive faces is transformed only once.
+ * That only pays off when the faces that share vertices are close to each other in the list of faces.
+ */
+class MeshOptimizer
+{
+public:
+    // optimize: weldVertices() + optimizeFaceOrder() + optimizeVertexOrder()
+    static void optimize(Mesh& mesh);
+
+    // weldVertices: vertices with the same position become a single one. The texture coordinates stay in the faces,
+    // so the vertices on a UV seam are merged too
+    static void weldVertices(Mesh& mesh);
+
+    // optimizeFaceOrder: Tom Forsyth's "Linear-Speed Vertex Cache Optimisation": the next face is the one whose
+    // vertices are most recently used (and have the fewest faces left, so that no lonely faces are left behind)
+    static void optimizeFaceOrder(Mesh& mesh, const int& cacheSize = 32);
+
+    // optimizeVertexOrder: vertices are renumbered in the order the faces use them (nearby indexes for nearby faces)
+    static void optimizeVertexOrder(Mesh& mesh);
+
+    // cacheHitRate: fraction of the vertex fetches of the faces that hit the post-transform cache of the renderer
+    static float cacheHitRate(const Mesh& mesh);
+};
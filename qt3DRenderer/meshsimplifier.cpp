@@ -0,0 +1,454 @@
+#include "meshsimplifier.h"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+#define SEAM_WEIGHT 10.0     // weight of the planes that keep the UV seams and the borders in place
+
+
+namespace
+{
+
+struct Point
+{
+    double x, y, z;
+};
+
+Point toPoint(const Vec3d& v)
+{
+    return { v.x, v.y, v.z };
+}
+
+Point sub(const Point& a, const Point& b)
+{
+    return { a.x - b.x, a.y - b.y, a.z - b.z };
+}
+
+Point cross(const Point& a, const Point& b)
+{
+    return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+}
+
+double dot(const Point& a, const Point& b)
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+// normalize: false when the vector is too short to have a direction
+bool normalize(Point& p)
+{
+    double length = std::sqrt(dot(p, p));
+    if (length < 1e-12)
+        return false;
+
+    p = { p.x / length, p.y / length, p.z / length };
+    return true;
+}
+
+// Quadric: the sum of the squared distances to a set of planes, as a symmetric 4x4 matrix (+ the sum of the weights)
+struct Quadric
+{
+    double a2, ab, ac, ad, b2, bc, bd, c2, cd, d2;
+    double weight;
+
+    Quadric() : a2(0), ab(0), ac(0), ad(0), b2(0), bc(0), bd(0), c2(0), cd(0), d2(0), weight(0) { }
+
+    // addPlane: the plane n.p + d = 0 (n must be normalized)
+    void addPlane(const Point& n, const double& d, const double& weight)
+    {
+        a2 += weight * n.x * n.x; ab += weight * n.x * n.y; ac += weight * n.x * n.z; ad += weight * n.x * d;
+        b2 += weight * n.y * n.y; bc += weight * n.y * n.z; bd += weight * n.y * d;
+        c2 += weight * n.z * n.z; cd += weight * n.z * d;
+        d2 += weight * d * d;
+        this->weight += weight;
+    }
+
+    void add(const Quadric& q)
+    {
+        a2 += q.a2; ab += q.ab; ac += q.ac; ad += q.ad; b2 += q.b2; bc += q.bc; bd += q.bd; c2 += q.c2; cd += q.cd; d2 += q.d2;
+        weight += q.weight;
+    }
+
+    double evaluate(const Point& p) const
+    {
+        return a2 * p.x * p.x + 2 * ab * p.x * p.y + 2 * ac * p.x * p.z + 2 * ad * p.x +
+               b2 * p.y * p.y + 2 * bc * p.y * p.z + 2 * bd * p.y +
+               c2 * p.z * p.z + 2 * cd * p.z + d2;
+    }
+};
+
+// Collapse: merge vertex "from" into vertex "to". version* detect candidates that became outdated
+struct Collapse
+{
+    double cost;
+    double distance;        // root mean square distance from the planes of the quadric
+    unsigned int from, to;
+    unsigned int versionFrom, versionTo;
+
+    bool operator>(const Collapse& c) const
+    {
+        return cost > c.cost;
+    }
+};
+
+int& corner(Face& face, const int& i)
+{
+    return (i == 0) ? face.a : (i == 1) ? face.b : face.c;
+}
+
+Tex2& cornerUV(Face& face, const int& i)
+{
+    return (i == 0) ? face.a_uv : (i == 1) ? face.b_uv : face.c_uv;
+}
+
+// cornerOf: which corner of the face is the vertex (-1 if none)
+int cornerOf(const Face& face, const unsigned int& vertex)
+{
+    if (face.a == (int)vertex) return 0;
+    if (face.b == (int)vertex) return 1;
+    if (face.c == (int)vertex) return 2;
+    return -1;
+}
+
+bool sameUV(const Tex2& a, const Tex2& b)
+{
+    return a.u == b.u && a.v == b.v;
+}
+
+
+class Simplifier
+{
+public:
+    Simplifier(const Mesh& mesh, const bool& lockBorders)
+        : _positions(mesh.vertices.size()), _faces(mesh.faces), _faceAlive(mesh.faces.size(), true),
+          _vertexFaces(mesh.vertices.size()), _constrained(mesh.vertices.size(), false),
+          _locked(mesh.vertices.size(), false), _versions(mesh.vertices.size(), 0), _quadrics(mesh.vertices.size())
+    {
+        _lockBorders = lockBorders;
+
+        for (unsigned int v = 0; v < mesh.vertices.size(); ++v)
+            _positions[v] = toPoint(mesh.vertices[v]);
+
+        for (unsigned int f = 0; f < _faces.size(); ++f)
+            for (int i = 0; i < 3; ++i)
+                _vertexFaces[corner(_faces[f], i)].push_back(f);
+
+        _aliveFaces = _faces.size();
+        _maxRmsDistance = 0;
+        _initQuadrics();
+    }
+
+    void run(const unsigned int& targetFaces)
+    {
+        for (unsigned int f = 0; f < _faces.size(); ++f)
+            for (int i = 0; i < 3; ++i)
+            {
+                unsigned int u = corner(_faces[f], i);
+                unsigned int v = corner(_faces[f], (i + 1) % 3);
+                _push(u, v);
+                _push(v, u);
+            }
+
+        while (_aliveFaces > targetFaces && !_heap.empty())
+        {
+            Collapse c = _heap.top();
+            _heap.pop();
+
+            if (c.versionFrom != _versions[c.from] || c.versionTo != _versions[c.to])
+                continue;
+
+            if (_collapse(c.from, c.to))
+                _maxRmsDistance = std::max(_maxRmsDistance, c.distance);
+        }
+    }
+
+    Mesh mesh(const Mesh& original)
+    {
+        Mesh result;
+        result.texture = original.texture;
+        result.textureWidth = original.textureWidth;
+        result.textureHeight = original.textureHeight;
+
+        std::vector<int> remap(_positions.size(), -1);
+        for (unsigned int f = 0; f < _faces.size(); ++f)
+        {
+            if (!_faceAlive[f])
+                continue;
+
+            Face face = _faces[f];
+            for (int i = 0; i < 3; ++i)
+            {
+                int& index = corner(face, i);
+                if (remap[index] < 0)
+                {
+                    remap[index] = result.vertices.size();
+                    result.vertices.push_back(Vec3d(_positions[index].x, _positions[index].y, _positions[index].z));
+                }
+                index = remap[index];
+            }
+            result.faces.push_back(face);
+        }
+
+        return result;
+    }
+
+    // error: the RMS distance from its planes of the worst collapse (an estimate of the distance from the original
+    // surface, not a bound)
+    float error()
+    {
+        return _maxRmsDistance;
+    }
+
+private:
+    /* _initQuadrics: the plane of each face goes to its 3 vertices. The edges on a UV seam (the faces on each side use
+     * different texture coordinates) or on a border (a single face) also add a plane perpendicular to the face, so
+     * that moving a vertex away from the seam costs a lot. Their vertices are constrained to collapse along them.
+     * With lockBorders, the vertices of the borders don't move at all.
+     */
+    void _initQuadrics()
+    {
+        for (unsigned int f = 0; f < _faces.size(); ++f)
+        {
+            const Face& face = _faces[f];
+            Point a = _positions[face.a], b = _positions[face.b], c = _positions[face.c];
+
+            // same winding of Mesh::computeFacePlanes(). Degenerate faces have no plane but still have seams
+            Point normal = cross(sub(b, a), sub(c, a));
+            bool hasPlane = normalize(normal);
+
+            if (hasPlane)
+            {
+                double d = -dot(normal, a);
+                for (int i = 0; i < 3; ++i)
+                    _quadrics[corner(_faces[f], i)].addPlane(normal, d, 1.0);
+            }
+
+            for (int i = 0; i < 3; ++i)
+            {
+                unsigned int u = corner(_faces[f], i);
+                unsigned int v = corner(_faces[f], (i + 1) % 3);
+                if (!_isSeam(u, v))
+                    continue;
+
+                _constrained[u] = _constrained[v] = true;
+                if (_lockBorders && _isBorder(u, v))
+                    _locked[u] = _locked[v] = true;
+
+                Point edgeNormal = cross(sub(_positions[v], _positions[u]), normal);
+                if (!hasPlane || !normalize(edgeNormal))
+                    continue;
+
+                double edgeD = -dot(edgeNormal, _positions[u]);
+                _quadrics[u].addPlane(edgeNormal, edgeD, SEAM_WEIGHT);
+                _quadrics[v].addPlane(edgeNormal, edgeD, SEAM_WEIGHT);
+            }
+        }
+    }
+
+    // _sharedFaces: the alive faces that have the edge u-v
+    void _sharedFaces(const unsigned int& u, const unsigned int& v, std::vector<unsigned int>& shared)
+    {
+        shared.clear();
+        for (unsigned int f : _vertexFaces[u])
+            if (cornerOf(_faces[f], v) >= 0)
+                shared.push_back(f);
+    }
+
+    // _isSeam: the edge u-v is on a border or the faces on each side map it to different texture coordinates
+    bool _isSeam(const unsigned int& u, const unsigned int& v)
+    {
+        std::vector<unsigned int> shared;
+        _sharedFaces(u, v, shared);
+
+        if (shared.size() != 2)
+            return true;
+
+        Face& f0 = _faces[shared[0]];
+        Face& f1 = _faces[shared[1]];
+        return !sameUV(cornerUV(f0, cornerOf(f0, u)), cornerUV(f1, cornerOf(f1, u))) ||
+               !sameUV(cornerUV(f0, cornerOf(f0, v)), cornerUV(f1, cornerOf(f1, v)));
+    }
+
+    // _isBorder: the edge u-v doesn't have a face on each side (a border, or an edge shared by more than 2 faces)
+    bool _isBorder(const unsigned int& u, const unsigned int& v)
+    {
+        std::vector<unsigned int> shared;
+        _sharedFaces(u, v, shared);
+        return shared.size() != 2;
+    }
+
+    void _push(const unsigned int& from, const unsigned int& to)
+    {
+        Quadric q = _quadrics[from];
+        q.add(_quadrics[to]);
+
+        Collapse c;
+        c.cost = std::max(q.evaluate(_positions[to]), 0.0);
+        c.distance = (q.weight > 0) ? std::sqrt(c.cost / q.weight) : 0.0;
+        c.from = from;
+        c.to = to;
+        c.versionFrom = _versions[from];
+        c.versionTo = _versions[to];
+        _heap.push(c);
+    }
+
+    // _neighbors: the vertices that share a face with v
+    void _neighbors(const unsigned int& v, std::vector<unsigned int>& neighbors)
+    {
+        neighbors.clear();
+        for (unsigned int f : _vertexFaces[v])
+            for (int i = 0; i < 3; ++i)
+            {
+                unsigned int w = corner(_faces[f], i);
+                if (w != v && std::find(neighbors.begin(), neighbors.end(), w) == neighbors.end())
+                    neighbors.push_back(w);
+            }
+    }
+
+    /* _collapse: merge u into v, unless it would damage the mesh:
+     *  - a constrained vertex (seam/border) only moves along a seam edge;
+     *  - with lockBorders, a border vertex never moves and the faces of the border edges never disappear, so the
+     *    border is exactly the same at every level;
+     *  - every texture coordinate of u must have a match on v, taken from the faces that disappear: this keeps each
+     *    side of a seam with its own mapping and rejects the collapses that would stretch the texture across a seam;
+     *  - the link condition (the only vertices shared by u and v are the ones of the faces that disappear) keeps
+     *    the mesh manifold;
+     *  - no face may flip.
+     */
+    bool _collapse(const unsigned int& u, const unsigned int& v)
+    {
+        std::vector<unsigned int> shared;
+        _sharedFaces(u, v, shared);
+        if (shared.empty() || shared.size() > 2)
+            return false;
+
+        if (_constrained[u] && !_isSeam(u, v))
+            return false;
+
+        if (_locked[u])
+            return false;
+
+        if (_lockBorders)
+            for (unsigned int f : shared)
+                for (int i = 0; i < 3; ++i)
+                    if (_locked[corner(_faces[f], i)] && _locked[corner(_faces[f], (i + 1) % 3)] &&
+                        _isBorder(corner(_faces[f], i), corner(_faces[f], (i + 1) % 3)))
+                        return false;
+
+        // texture coordinates of u -> texture coordinates of v on the same side of the seams
+        std::vector<std::pair<Tex2, Tex2>> uvMap;
+        for (unsigned int f : shared)
+        {
+            Face& face = _faces[f];
+            uvMap.push_back(std::make_pair(cornerUV(face, cornerOf(face, u)), cornerUV(face, cornerOf(face, v))));
+        }
+
+        std::vector<unsigned int> neighborsU, neighborsV;
+        _neighbors(u, neighborsU);
+        _neighbors(v, neighborsV);
+
+        unsigned int common = 0;
+        for (unsigned int w : neighborsU)
+            if (std::find(neighborsV.begin(), neighborsV.end(), w) != neighborsV.end())
+                ++common;
+
+        if (common > shared.size())
+            return false;
+
+        std::vector<std::pair<unsigned int, Tex2>> moved;
+        for (unsigned int f : _vertexFaces[u])
+        {
+            Face& face = _faces[f];
+            if (cornerOf(face, v) >= 0)
+                continue;
+
+            int i = cornerOf(face, u);
+            const Tex2& uv = cornerUV(face, i);
+
+            int match = -1;
+            for (unsigned int m = 0; m < uvMap.size() && match < 0; ++m)
+                if (sameUV(uvMap[m].first, uv))
+                    match = m;
+
+            if (match < 0)
+                return false;
+
+            // the face must keep facing the same side
+            Point p1 = _positions[corner(face, (i + 1) % 3)];
+            Point p2 = _positions[corner(face, (i + 2) % 3)];
+            Point before = cross(sub(p1, _positions[u]), sub(p2, _positions[u]));
+            Point after = cross(sub(p1, _positions[v]), sub(p2, _positions[v]));
+            if (!normalize(after) || (normalize(before) && dot(before, after) < 0.2))
+                return false;
+
+            moved.push_back(std::make_pair(f, uvMap[match].second));
+        }
+
+        // the faces with the edge u-v disappear
+        for (unsigned int f : shared)
+        {
+            _faceAlive[f] = false;
+            --_aliveFaces;
+
+            for (int i = 0; i < 3; ++i)
+            {
+                std::vector<unsigned int>& faces = _vertexFaces[corner(_faces[f], i)];
+                faces.erase(std::find(faces.begin(), faces.end(), f));
+            }
+        }
+
+        // the rest of the faces of u now use v
+        for (const std::pair<unsigned int, Tex2>& m : moved)
+        {
+            Face& face = _faces[m.first];
+            int i = cornerOf(face, u);
+            corner(face, i) = v;
+            cornerUV(face, i) = m.second;
+            _vertexFaces[v].push_back(m.first);
+        }
+
+        _vertexFaces[u].clear();
+        _quadrics[v].add(_quadrics[u]);
+        ++_versions[u];
+        ++_versions[v];
+
+        std::vector<unsigned int> neighbors;
+        _neighbors(v, neighbors);
+        for (unsigned int w : neighbors)
+        {
+            _push(v, w);
+            _push(w, v);
+        }
+
+        return true;
+    }
+
+    std::vector<Point> _positions;
+    std::vector<Face> _faces;
+    std::vector<bool> _faceAlive;
+    std::vector<std::vector<unsigned int>> _vertexFaces;
+    std::vector<bool> _constrained;
+    std::vector<bool> _locked;              // border vertices that never move (lockBorders)
+    std::vector<unsigned int> _versions;
+    std::vector<Quadric> _quadrics;
+    std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> _heap;
+
+    unsigned int _aliveFaces;
+    double _maxRmsDistance;
+    bool _lockBorders;
+};
+
+}
+
+
+Mesh MeshSimplifier::simplify(const Mesh& mesh, const unsigned int& targetFaces, float* error, const bool& lockBorders)
+{
+    Simplifier simplifier(mesh, lockBorders);
+    simplifier.run(targetFaces);
+
+    if (error)
+        *error = simplifier.error();
+
+    return simplifier.mesh(mesh);
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include "mesh.h"
+
+
+/* MeshSimplifier: reduces the number of faces of a mesh with the Quadric Error Metric of Garland & Heckbert
+ * ("Surface Simplification Using Quadric Error Metrics", 1997).
+ *
+ * Every vertex accumulates the planes of the faces around it in a quadric, and the edge whose collapse moves the
+ * surface the least is collapsed first (one vertex is merged into the other, so no new vertices are created).
+ * The UV seams and the borders of the mesh are preserved: a vertex on a seam only slides along the seam, extra
+ * planes keep the seams straight, and a collapse that would flip a face or tear the texture mapping is skipped.
+ */
+class MeshSimplifier
+{
+public:
+    // simplify: a copy of mesh with at most targetFaces faces (or as close as possible without damaging the seams).
+    // error receives the largest RMS distance (Model Space units) of a collapsed vertex from the planes of its quadric:
+    // an estimate of how far the new surface is from the original one, not a bound (a point of the surface can be
+    // farther). lockBorders keeps the vertices and edges of the borders exactly as they are (pieces of a bigger mesh
+    // simplified on their own)
+    static Mesh simplify(const Mesh& mesh, const unsigned int& targetFaces, float* error = nullptr, const bool& lockBorders = false);
+};
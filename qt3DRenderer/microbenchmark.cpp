@@ -0,0 +1,369 @@
+#include "microbenchmark.h"
+#include "clipping.h"
+#include "cpudispatch.h"
+#include "display.h"
+#include "jobsystem.h"
+#include "mat4.h"
+#include "postprocess.h"
+#include "vec4d.h"
+
+#include <QDateTime>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QThread>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+#define MICRO_MIN_TIME_MS 50.0      // a repetition runs at least this long
+#define MICRO_REPETITIONS 5         // the median of the repetitions is reported
+
+
+// the results are written here so that the compiler can't drop the computations being measured
+static volatile float g_sink;
+
+/* frustumPlanes: 90º horizontal and vertical field of view, near = 1 and far = 100 (Camera Space, normals inside) */
+static void frustumPlanes(Plane planes[6])
+{
+    const float c = std::sqrt(0.5f);
+    Vec3d normals[6] = { Vec3d(c, 0, c), Vec3d(-c, 0, c), Vec3d(0, -c, c), Vec3d(0, c, c), Vec3d(0, 0, 1), Vec3d(0, 0, -1) };
+    Vec3d points[6] = { Vec3d(0, 0, 0), Vec3d(0, 0, 0), Vec3d(0, 0, 0), Vec3d(0, 0, 0), Vec3d(0, 0, 1), Vec3d(0, 0, 100) };
+
+    for (int p = 0; p < 6; ++p)
+    {
+        planes[p].normal = normals[p];
+        planes[p].point = points[p];
+    }
+}
+
+
+int MicroBenchmark::run(const std::string& jsonFile, const std::string& filter)
+{
+    std::vector<Result> results;
+    auto add = [&](const std::string& name, const double& items, const std::function<void(const long long&)>& op)
+    {
+        if (!filter.empty() && name.find(filter) == std::string::npos)
+            return;
+
+        results.push_back(_measure(name, items, op));
+        const Result& r = results.back();
+
+        std::cout << std::left << std::setw(44) << r.name << std::right << std::fixed << std::setprecision(1) << std::setw(14)
+                  << r.nsPerOp << " ns" << std::setw(14) << r.iterations;
+        if (r.itemsPerSecond > 0.0)
+            std::cout << std::setprecision(2) << std::setw(12) << r.itemsPerSecond / 1e6 << " M items/s";
+        std::cout << std::endl;
+    };
+
+    std::cout << "MicroBenchmark::run: median of " << MICRO_REPETITIONS << " repetitions of at least " << MICRO_MIN_TIME_MS << " ms" << std::endl;
+    std::cout << std::left << std::setw(44) << "benchmark" << std::right << std::setw(17) << "time/op" << std::setw(14) << "iterations" << std::endl;
+
+    /* math: the products are chained (each one uses the previous result) like the transforms of a vertex are */
+
+    Mat4 rotation = Mat4::rotateY(0.01f) * Mat4::rotateX(0.02f);
+
+    add("mat4_mul", 0.0, [&](const long long& n)
+    {
+        Mat4 m = Mat4::eye();
+        for (long long i = 0; i < n; ++i)
+            m = m * rotation;
+        g_sink = m.m[0][0];
+    });
+
+    add("vec4d_mul", 1.0, [&](const long long& n)
+    {
+        Vec4d v(1.f, 2.f, 3.f, 1.f);
+        for (long long i = 0; i < n; ++i)
+            v = v * rotation;
+        g_sink = v.x;
+    });
+
+    /* clipping: the same triangle with 0, 1 and 2 vertices behind the near plane */
+
+    Plane planes[6];
+    frustumPlanes(planes);
+
+    struct ClipCase { const char* name; Vec3d a, b, c; };
+    ClipCase clipCases[] = {
+        { "polygon_clip/0_outside", Vec3d(-1.f, -1.f, 5.f), Vec3d(0.f, 1.f, 5.f), Vec3d(1.f, -1.f, 5.f) },
+        { "polygon_clip/1_outside", Vec3d(-1.f, -1.f, 5.f), Vec3d(0.f, 0.2f, 0.5f), Vec3d(1.f, -1.f, 5.f) },
+        { "polygon_clip/2_outside", Vec3d(-0.2f, -0.2f, 0.5f), Vec3d(0.f, 1.f, 5.f), Vec3d(0.2f, -0.2f, 0.5f) }
+    };
+
+    for (const ClipCase& clip : clipCases)
+        add(clip.name, 0.0, [&](const long long& n)
+        {
+            size_t vertices = 0;
+            for (long long i = 0; i < n; ++i)
+            {
+                Polygon polygon(clip.a, clip.b, clip.c, Tex2(0.f, 1.f), Tex2(0.5f, 0.f), Tex2(1.f, 1.f));
+                polygon.clip(planes);
+                vertices += polygon.vertexCount;
+            }
+            g_sink = (float)vertices;
+        });
+
+    /* triangles: right triangles with legs of 8, 64 and 512 pixels at 1080p. After the first one is drawn the depth test
+     * is switched to DEPTH_EQUAL, so every following draw passes the test and writes all its pixels
+     */
+
+    Display gfx;
+    gfx.setSize(1920, 1080);
+    gfx.setLazyClear(false);
+
+    const int TEXTURE_SIZE = 64;
+    std::vector<uint32_t> texture(TEXTURE_SIZE * TEXTURE_SIZE);
+    for (int y = 0; y < TEXTURE_SIZE; ++y)
+        for (int x = 0; x < TEXTURE_SIZE; ++x)
+            texture[y * TEXTURE_SIZE + x] = (((x / 8) + (y / 8)) & 1) ? 0xFFFFFFFF : 0xFF4080C0;
+
+    struct Size { const char* name; int legs; };
+    Size sizes[] = { { "small", 8 }, { "medium", 64 }, { "large", 512 } };
+
+    for (const Size& size : sizes)
+    {
+        Vec4d p1(100.f, 100.f, 0.5f, 2.f), p2(100.f, 100.f + size.legs, 0.5f, 2.f), p3(100.f + size.legs, 100.f, 0.5f, 2.f);
+        double pixels = size.legs * size.legs / 2.0;
+
+        add(std::string("fill_triangle/") + size.name, pixels, [&](const long long& n)
+        {
+            gfx.clearDepthBuffer(1.f);
+            gfx.setDepthFunc(DEPTH_FUNC::DEPTH_LESS);
+            gfx.fillTriangle(p1, p2, p3, 0xFFFF8000);
+
+            gfx.setDepthFunc(DEPTH_FUNC::DEPTH_EQUAL);
+            for (long long i = 0; i < n; ++i)
+                gfx.fillTriangle(p1, p2, p3, 0xFFFF8000);
+            gfx.setDepthFunc(DEPTH_FUNC::DEPTH_LESS);
+        });
+
+        add(std::string("draw_textured_triangle/") + size.name, pixels, [&](const long long& n)
+        {
+            Tex2 uv1(0.f, 0.f), uv2(0.f, 1.f), uv3(1.f, 0.f);
+
+            gfx.clearDepthBuffer(1.f);
+            gfx.setDepthFunc(DEPTH_FUNC::DEPTH_LESS);
+            gfx.drawTexturedTriangle(p1, p2, p3, uv1, uv2, uv3, texture.data(), TEXTURE_SIZE, TEXTURE_SIZE);
+
+            gfx.setDepthFunc(DEPTH_FUNC::DEPTH_EQUAL);
+            for (long long i = 0; i < n; ++i)
+                gfx.drawTexturedTriangle(p1, p2, p3, uv1, uv2, uv3, texture.data(), TEXTURE_SIZE, TEXTURE_SIZE);
+            gfx.setDepthFunc(DEPTH_FUNC::DEPTH_LESS);
+        });
+
+        add(std::string("draw_line/") + size.name, size.legs, [&](const long long& n)
+        {
+            for (long long i = 0; i < n; ++i)
+                gfx.drawLine(100, 100, 100 + size.legs, 100 + size.legs, 0xFFFFFFFF);
+        });
+    }
+
+    /* clears of the whole 1080p buffers */
+
+    add("clear_color/1080p", 1920.0 * 1080.0, [&](const long long& n)
+    {
+        for (long long i = 0; i < n; ++i)
+            gfx.clearColorBuffer(0xFF000000);
+    });
+
+    add("clear_depth/1080p", 1920.0 * 1080.0, [&](const long long& n)
+    {
+        for (long long i = 0; i < n; ++i)
+            gfx.clearDepthBuffer(1.f);
+    });
+
+    // the fill of each level supported by the CPU (see CpuDispatch), then back to the level of the other benchmarks
+    CPU_LEVEL boundLevel = CpuDispatch::level();
+    for (int level = CPU_SCALAR; level <= CpuDispatch::detectedLevel(); ++level)
+    {
+        CpuDispatch::setLevel((CPU_LEVEL)level);
+
+        add(std::string("clear_color/1080p/") + CpuDispatch::levelName((CPU_LEVEL)level), 1920.0 * 1080.0, [&](const long long& n)
+        {
+            for (long long i = 0; i < n; ++i)
+                gfx.clearColorBuffer(0xFF000000);
+        });
+    }
+    CpuDispatch::setLevel(boundLevel);
+
+    /* depth formats: the depth-only kernel over the whole screen (2 triangles, every pixel is depth tested against the
+     * first draw), the large triangle of the color kernels and the clear, in each format of the depth buffer
+     */
+
+    struct Format { const char* name; DEPTH_FORMAT format; };
+    Format formats[] = { { "float", DEPTH_FORMAT::DEPTH_FLOAT }, { "unorm16", DEPTH_FORMAT::DEPTH_UNORM16 },
+                         { "reversed", DEPTH_FORMAT::DEPTH_REVERSED_FLOAT } };
+
+    Vec4d s1(0.f, 0.f, 0.5f, 2.f), s2(0.f, 1080.f, 0.5f, 2.f), s3(1920.f, 0.f, 0.5f, 2.f), s4(1920.f, 1080.f, 0.5f, 2.f);
+    Vec4d p1(100.f, 100.f, 0.5f, 2.f), p2(100.f, 612.f, 0.5f, 2.f), p3(612.f, 100.f, 0.5f, 2.f);
+
+    for (const Format& format : formats)
+    {
+        gfx.setDepthFormat(format.format);
+
+        add(std::string("draw_triangle_depth/fullscreen/") + format.name, 1920.0 * 1080.0, [&](const long long& n)
+        {
+            gfx.clearDepthBuffer(1.f);
+            for (long long i = 0; i < n; ++i)
+            {
+                gfx.drawTriangleDepth(s1, s2, s3);
+                gfx.drawTriangleDepth(s2, s4, s3);
+            }
+        });
+
+        add(std::string("fill_triangle/large/") + format.name, 512.0 * 512.0 / 2.0, [&](const long long& n)
+        {
+            gfx.clearDepthBuffer(1.f);
+            gfx.setDepthFunc(DEPTH_FUNC::DEPTH_LESS);
+            gfx.fillTriangle(p1, p2, p3, 0xFFFF8000);
+
+            gfx.setDepthFunc(DEPTH_FUNC::DEPTH_EQUAL);
+            for (long long i = 0; i < n; ++i)
+                gfx.fillTriangle(p1, p2, p3, 0xFFFF8000);
+            gfx.setDepthFunc(DEPTH_FUNC::DEPTH_LESS);
+        });
+
+        add(std::string("clear_depth/1080p/") + format.name, 1920.0 * 1080.0, [&](const long long& n)
+        {
+            for (long long i = 0; i < n; ++i)
+                gfx.clearDepthBuffer(1.f);
+        });
+    }
+
+    gfx.setDepthFormat(DEPTH_FORMAT::DEPTH_FLOAT);
+
+    /* post-processing: each filter over a 1080p frame on a single thread. The frame is a fullscreen pair of triangles
+     * (every pixel has a depth for the fog) with a grid of lines on top of it (edges for FXAA). The filters run on the
+     * same frame again and again: FXAA goes first, before fog and tonemap wash the edges out
+     */
+
+    JobSystem jobSystem;
+    jobSystem.setThreadCount(1);
+    PostProcess post;
+    post.setFog(1.f, 4.f, 0xFF808080);
+
+    gfx.clearColorBuffer(0xFF000000);
+    gfx.clearDepthBuffer(1.f);
+    gfx.fillTriangle(s1, s2, s3, 0xFF4080C0);
+    gfx.fillTriangle(s2, s4, s3, 0xFF4080C0);
+    for (int x = 0; x < 1920; x += 16)
+        gfx.drawLine(x, 0, x + 540, 1079, 0xFFFFFFFF);
+
+    add("post/fxaa/1080p", 1920.0 * 1080.0, [&](const long long& n)
+    {
+        for (long long i = 0; i < n; ++i)
+            post.fxaa(gfx, jobSystem);
+    });
+
+    add("post/tonemap/1080p", 1920.0 * 1080.0, [&](const long long& n)
+    {
+        for (long long i = 0; i < n; ++i)
+            post.tonemap(gfx, jobSystem);
+    });
+
+    add("post/fog/1080p", 1920.0 * 1080.0, [&](const long long& n)
+    {
+        for (long long i = 0; i < n; ++i)
+            post.fog(gfx, jobSystem);
+    });
+
+    if (!jsonFile.empty())
+    {
+        if (!_writeJson(jsonFile, results))
+            return 1;
+
+        std::cout << "MicroBenchmark::run: results written to " << jsonFile << std::endl;
+    }
+
+    return 0;
+}
+
+MicroBenchmark::Result MicroBenchmark::_measure(const std::string& name, const double& items,
+                                                const std::function<void(const long long&)>& op)
+{
+    // calibration: grow the batch until it's long enough to be timed reliably
+    long long iterations = 1;
+    while (true)
+    {
+        auto start = std::chrono::steady_clock::now();
+        op(iterations);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        if (ms >= MICRO_MIN_TIME_MS)
+            break;
+
+        // aim a little above the minimum time, at most 10x more iterations per step
+        double factor = (ms > 0.0) ? std::min(MICRO_MIN_TIME_MS * 1.2 / ms, 10.0) : 10.0;
+        iterations = std::max(iterations + 1, (long long)(iterations * factor));
+    }
+
+    std::vector<double> nsPerOp;
+    for (int r = 0; r < MICRO_REPETITIONS; ++r)
+    {
+        auto start = std::chrono::steady_clock::now();
+        op(iterations);
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        nsPerOp.push_back(elapsed.count() / iterations);
+    }
+
+    std::sort(nsPerOp.begin(), nsPerOp.end());
+
+    Result result;
+    result.name = name;
+    result.iterations = iterations;
+    result.nsPerOp = nsPerOp[MICRO_REPETITIONS / 2];
+    result.itemsPerSecond = (items > 0.0) ? items * 1e9 / result.nsPerOp : 0.0;
+    return result;
+}
+
+/* _writeJson: the layout of Google Benchmark's --benchmark_format=json:
+ *  { "context": { "date": ..., "num_cpus": ... }, "benchmarks": [ { "name": ..., "real_time": ..., "time_unit": "ns" } ] }
+ */
+bool MicroBenchmark::_writeJson(const std::string& filename, const std::vector<Result>& results)
+{
+    QJsonObject context;
+    context.insert("date", QDateTime::currentDateTime().toString(Qt::ISODate));
+    context.insert("num_cpus", QThread::idealThreadCount());
+    context.insert("executable", "qt3DRenderer");
+#ifdef NDEBUG
+    context.insert("library_build_type", "release");
+#else
+    context.insert("library_build_type", "debug");
+#endif
+
+    QJsonArray benchmarks;
+    for (unsigned int r = 0; r < results.size(); ++r)
+    {
+        QJsonObject benchmark;
+        benchmark.insert("name", QString::fromStdString(results[r].name));
+        benchmark.insert("run_type", "iteration");
+        benchmark.insert("repetitions", MICRO_REPETITIONS);
+        benchmark.insert("iterations", (qint64)results[r].iterations);
+        benchmark.insert("real_time", results[r].nsPerOp);
+        benchmark.insert("cpu_time", results[r].nsPerOp);
+        benchmark.insert("time_unit", "ns");
+        if (results[r].itemsPerSecond > 0.0)
+            benchmark.insert("items_per_second", results[r].itemsPerSecond);
+
+        benchmarks.append(benchmark);
+    }
+
+    QJsonObject root;
+    root.insert("context", context);
+    root.insert("benchmarks", benchmarks);
+
+    QFile file(QString::fromStdString(filename));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        std::cout << "MicroBenchmark::_writeJson: unable to write " << filename << std::endl;
+        return false;
+    }
+
+    file.write(QJsonDocument(root).toJson());
+    return true;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <functional>
+#include <string>
+#include <vector>
+
+
+/* MicroBenchmark: isolated measurements of the primitives the frame is built from (matrix/vector products, clipping,
+ * the triangle and line kernels of the Display and the buffer clears), to see which one an optimization moved.
+ *
+ * Each benchmark is calibrated to run for at least MICRO_MIN_TIME_MS and repeated MICRO_REPETITIONS times; the median
+ * time per operation is reported. The results can be written as JSON (same field names of Google Benchmark, so its
+ * compare tools can read them) to compare commits and machines.
+ *
+ * Usage: qt3DRenderer --bench --micro [--json results.json] [--filter name]
+ */
+class MicroBenchmark
+{
+public:
+    // run: execute the micro benchmarks whose name contains filter (all when empty) and return the exit code
+    static int run(const std::string& jsonFile, const std::string& filter);
+
+private:
+    // Result: median time per operation of one benchmark
+    struct Result
+    {
+        std::string name;
+        long long iterations;           // per repetition
+        double nsPerOp;
+        double itemsPerSecond;          // pixels, vertices, ... per second (0 when it doesn't apply)
+    };
+
+    /* _measure: op() runs batches of iterations until a repetition lasts at least MICRO_MIN_TIME_MS.
+     * items is the number of pixels/vertices/... processed by a single call of op()
+     */
+    static Result _measure(const std::string& name, const double& items, const std::function<void(const long long&)>& op);
+
+    static bool _writeJson(const std::string& filename, const std::vector<Result>& results);
+};
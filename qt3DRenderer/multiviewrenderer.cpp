@@ -0,0 +1,157 @@
+#include "multiviewrenderer.h"
+
+#define PI 3.14159265358979323846
+
+
+MultiViewRenderer::MultiViewRenderer(JobSystem* jobSystem)
+{
+    _jobSystem = (jobSystem) ? jobSystem : &_ownJobSystem;
+    if (!jobSystem)
+        _ownJobSystem.setThreadCount(0);
+}
+
+void MultiViewRenderer::setThreadCount(const int& threads)
+{
+    _jobSystem->setThreadCount(threads);
+}
+
+int MultiViewRenderer::addView(const int& width, const int& height, const float& fovY, const float& zNear, const float& zFar)
+{
+    View view;
+    view.renderer.reset(new Renderer(_jobSystem));
+    view.renderer->display().setSize(width, height);
+    view.renderer->display().setup();
+    view.renderer->setProjection(fovY, width / (float)height, zNear, zFar);
+    view.viewMatrix = Mat4::eye();
+
+    _views.push_back(std::move(view));
+    return (int)_views.size() - 1;
+}
+
+int MultiViewRenderer::addCubeMap(const int& size, const float& zNear, const float& zFar)
+{
+    int first = (int)_views.size();
+    for (int face = 0; face < 6; ++face)
+        addView(size, size, (float)PI / 2.f, zNear, zFar);
+
+    return first;
+}
+
+void MultiViewRenderer::setCamera(const int& view, const Vec3d& position, const Mat4& viewMatrix)
+{
+    _views[view].position = position;
+    _views[view].viewMatrix = viewMatrix;
+}
+
+/* setCubeMapCamera: each face looks down one axis. The up vector of the faces that look up or down can't be +Y (it
+ * would be parallel to the direction of the camera), they use -Z and +Z instead.
+ */
+void MultiViewRenderer::setCubeMapCamera(const int& firstView, const Vec3d& position)
+{
+    static const Vec3d directions[6] = { Vec3d(1.f, 0.f, 0.f), Vec3d(-1.f, 0.f, 0.f), Vec3d(0.f, 1.f, 0.f),
+                                         Vec3d(0.f, -1.f, 0.f), Vec3d(0.f, 0.f, 1.f), Vec3d(0.f, 0.f, -1.f) };
+    static const Vec3d ups[6] = { Vec3d(0.f, 1.f, 0.f), Vec3d(0.f, 1.f, 0.f), Vec3d(0.f, 0.f, -1.f),
+                                  Vec3d(0.f, 0.f, 1.f), Vec3d(0.f, 1.f, 0.f), Vec3d(0.f, 1.f, 0.f) };
+
+    for (int face = 0; face < 6; ++face)
+    {
+        Vec3d eye = position;
+        setCamera(firstView + face, position, Mat4::lookAt(eye, eye + directions[face], ups[face]));
+    }
+}
+
+void MultiViewRenderer::setLights(const std::vector<Light>& lights)
+{
+    for (unsigned int v = 0; v < _views.size(); ++v)
+        _views[v].renderer->setLights(lights);
+}
+
+void MultiViewRenderer::render(std::vector<Mesh>& meshes, const RENDER_MODE& renderMode)
+{
+    _meshes.resize(meshes.size());
+    for (unsigned int m = 0; m < meshes.size(); ++m)
+        _meshes[m] = &meshes[m];
+
+    render(_meshes, renderMode);
+}
+
+void MultiViewRenderer::render(const std::vector<Mesh*>& meshes, const RENDER_MODE& renderMode)
+{
+    _profiler.begin("world");
+
+    /* shared part: the transforms of the meshes. The bounds and the face planes of a mesh are computed here the first
+     * time, the views would race to compute them while running in parallel
+     */
+    _transforms.resize(meshes.size());
+
+    for (unsigned int m = 0; m < meshes.size(); ++m)
+    {
+        Mesh* mesh = meshes[m];
+        if (!mesh->asset)
+        {
+            if (mesh->boundsRadius == 0.f && !mesh->vertices.empty())
+                mesh->computeBounds();
+
+            if (ENABLE_FACE_CULL && OBJECT_SPACE_CULL)
+            {
+                if (mesh->faceNormals.size() != mesh->faces.size())
+                    mesh->computeFacePlanes();
+
+                for (unsigned int l = 0; l < mesh->lods.size(); ++l)
+                    if (mesh->lods[l].faceNormals.size() != mesh->lods[l].faces.size())
+                        mesh->lods[l].computeFacePlanes();
+            }
+        }
+
+        Renderer::worldTransform(mesh, _transforms[m]);
+    }
+
+    _profiler.end("world");
+
+    // the shadow map, unless its light moves with the camera: every view has the lights of setLights()
+    const Light* light = (_views.empty()) ? nullptr : _views[0].renderer->shadowLight();
+    bool sharedShadows = light && !light->cameraSpace;
+    if (sharedShadows)
+    {
+        _profiler.begin("shadowmap");
+        _shadowMap.update(meshes, light->direction, CACHE_SHADOW_MAP);
+        _profiler.end("shadowmap");
+    }
+
+    for (unsigned int v = 0; v < _views.size(); ++v)
+        _views[v].renderer->setSharedShadowMap((sharedShadows) ? &_shadowMap : nullptr);
+
+    // per view part: culling, geometry stage and rasterization of each view run as jobs
+    _profiler.begin("views");
+
+    _meshPointers = meshes;
+    _jobSystem->parallelFor(_views.size(), 1, [this, &renderMode](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int v = begin; v < end; ++v)
+        {
+            Renderer& renderer = *_views[v].renderer;
+            renderer.processGeometry(_meshPointers, _views[v].position, _views[v].viewMatrix, &_transforms);
+            renderer.render(renderMode);
+            renderer.display().resolveClears();
+            renderer.profiler().frameDone();
+        }
+    });
+
+    _profiler.end("views");
+    _profiler.frameDone();
+}
+
+int MultiViewRenderer::viewCount()
+{
+    return (int)_views.size();
+}
+
+Renderer& MultiViewRenderer::view(const int& view)
+{
+    return *_views[view].renderer;
+}
+
+Profiler& MultiViewRenderer::profiler()
+{
+    return _profiler;
+}
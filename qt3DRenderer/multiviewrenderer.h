@@ -0,0 +1,86 @@
+#pragma once
+#include <memory>
+#include <vector>
+
+#include "mat4.h"
+#include "vec3d.h"
+#include "light.h"
+#include "mesh.h"
+#include "profiler.h"
+#include "jobsystem.h"
+#include "renderer.h"
+#include "shadowmap.h"
+
+
+enum CUBE_FACE
+{
+    POSITIVE_X, NEGATIVE_X, POSITIVE_Y, NEGATIVE_Y, POSITIVE_Z, NEGATIVE_Z
+};
+
+
+/* MultiViewRenderer: renders the same meshes from several cameras per frame (split screen views, the 6 faces of a
+ * cube map, ...), each view to its own Display.
+ *
+ * The work that doesn't depend on the camera is done once per frame for all the views: the World matrix of each mesh,
+ * its inverse (object-space backface culling), its bounding sphere in World Space and the shadow map (unless its light
+ * moves with the camera, then each view renders its own). Then every view runs its own
+ * Renderer in parallel: the meshes outside its frustum are skipped, the others go through the geometry stage with the
+ * World and View matrices concatenated and are rasterized to the Display of the view. The Renderers of the views share
+ * a single JobSystem, the chunks of faces of a view are stolen by the threads that finished their own view.
+ */
+class MultiViewRenderer
+{
+public:
+    // MultiViewRenderer: jobSystem runs the views (null: the MultiViewRenderer starts its own threads). Pass the
+    // JobSystem of the main Renderer when both draw the same frames, two pools would oversubscribe the cores
+    MultiViewRenderer(JobSystem* jobSystem = nullptr);
+
+    // setThreadCount: threads shared by all the views (0 = QThread::idealThreadCount())
+    void setThreadCount(const int& threads);
+
+    // addView: a view rendered to a Display of width x height (fovY in radians). Returns its index
+    int addView(const int& width, const int& height, const float& fovY, const float& zNear, const float& zFar);
+
+    // addCubeMap: 6 square views of 90 degrees, in the order of CUBE_FACE. Returns the index of the first one
+    int addCubeMap(const int& size, const float& zNear, const float& zFar);
+
+    // setCamera: the camera of a view for the next frames
+    void setCamera(const int& view, const Vec3d& position, const Mat4& viewMatrix);
+
+    // setCubeMapCamera: place the 6 views of a cube map at position
+    void setCubeMapCamera(const int& firstView, const Vec3d& position);
+
+    // setLights: the lights of the scene, for all the views
+    void setLights(const std::vector<Light>& lights);
+
+    // render: one frame of all the views
+    void render(std::vector<Mesh>& meshes, const RENDER_MODE& renderMode);
+    void render(const std::vector<Mesh*>& meshes, const RENDER_MODE& renderMode);
+
+    // viewCount: number of views, including the 6 of each cube map
+    int viewCount();
+
+    // view: the Renderer of a view, with its Display and its Profiler
+    Renderer& view(const int& view);
+
+    // profiler: "world" and "shadowmap" (the shared part) and "views" (all the views, in parallel)
+    Profiler& profiler();
+
+private:
+    // View: a camera and the Renderer that draws what it sees
+    struct View
+    {
+        std::unique_ptr<Renderer> renderer;
+        Vec3d position;
+        Mat4 viewMatrix;
+    };
+
+    JobSystem _ownJobSystem;            // single threaded when the JobSystem comes from outside
+    JobSystem* _jobSystem;
+    std::vector<View> _views;
+    std::vector<Mesh*> _meshes;             // render(std::vector<Mesh>&): the pointers, kept between frames
+    std::vector<Mesh*> _meshPointers;
+    std::vector<WorldTransform> _transforms;
+    ShadowMap _shadowMap;                   // shared by all the views
+    Profiler _profiler;
+};
@@ -0,0 +1,147 @@
+#include "offlinerenderer.h"
+#include "assetmanager.h"
+#include "framewriter.h"
+#include "renderer.h"
+#include "scene.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#define PI 3.14159265358979323846
+
+
+// positiveInt: value is a whole number above 0 (std::stoi throws on garbage and accepts "12abc")
+static bool positiveInt(const std::string& value, int& result)
+{
+    char* end = nullptr;
+    errno = 0;
+    long number = std::strtol(value.c_str(), &end, 10);
+    if (end == value.c_str() || *end != '\0' || errno == ERANGE || number <= 0 || number > 0x7FFFFFFF)
+        return false;
+
+    result = (int)number;
+    return true;
+}
+
+int OfflineRenderer::run(const std::vector<std::string>& args, const std::string& defaultScene)
+{
+    std::string output, sceneFile = defaultScene;
+    int frames = 300, fps = 30, width = 1280, height = 720;
+    FRAME_FORMAT format = FRAME_FORMAT::Y4M;
+    RENDER_MODE mode = RENDER_MODE::TEXTURED;
+
+    for (unsigned int i = 0; i + 1 < args.size(); i += 2)
+    {
+        const std::string& value = args[i + 1];
+
+        if (args[i] == "--render")
+            output = value;
+        else if (args[i] == "--scene")
+            sceneFile = value;
+        else if (args[i] == "--frames" && !positiveInt(value, frames))
+        {
+            std::cerr << "OfflineRenderer::run: --frames must be a number above 0" << std::endl;
+            return 1;
+        }
+        else if (args[i] == "--fps" && !positiveInt(value, fps))
+        {
+            std::cerr << "OfflineRenderer::run: --fps must be a number above 0" << std::endl;
+            return 1;
+        }
+        else if (args[i] == "--size" && std::sscanf(value.c_str(), "%dx%d", &width, &height) != 2)
+        {
+            std::cerr << "OfflineRenderer::run: --size must be WIDTHxHEIGHT" << std::endl;
+            return 1;
+        }
+        else if (args[i] == "--format")
+            format = (value == "rgba") ? FRAME_FORMAT::RAW_RGBA : FRAME_FORMAT::Y4M;
+        else if (args[i] == "--mode")
+        {
+            if (value == "flat")
+                mode = RENDER_MODE::TRIANGLES;
+            else if (value == "wireframe")
+                mode = RENDER_MODE::WIREFRAME;
+            else if (value == "deferred")
+                mode = RENDER_MODE::TEXTURED_DEFERRED;
+        }
+    }
+
+    if (width <= 0 || height <= 0)
+    {
+        std::cerr << "OfflineRenderer::run: --size must be WIDTHxHEIGHT" << std::endl;
+        return 1;
+    }
+
+    // the log goes to stderr: stdout may be the video stream, the messages of the Display & co. must not end up in it
+    std::streambuf* coutBuffer = std::cout.rdbuf();
+    if (output == "-")
+        std::cout.rdbuf(std::cerr.rdbuf());
+
+    int exitCode = _render(output, sceneFile, frames, fps, width, height, format, mode);
+
+    std::cout.rdbuf(coutBuffer);
+    return exitCode;
+}
+
+int OfflineRenderer::_render(const std::string& output, const std::string& sceneFile, const int& frames, const int& fps,
+                             const int& width, const int& height, const FRAME_FORMAT& format, const RENDER_MODE& mode)
+{
+    Scene scene;
+    if (output.empty() || width <= 0 || height <= 0 || !scene.load(sceneFile))
+    {
+        std::cerr << "OfflineRenderer::run: nothing to render (output=\"" << output << "\" scene=\"" << sceneFile << "\")" << std::endl;
+        return 1;
+    }
+
+    AssetManager assets;
+    std::vector<Mesh> meshes;
+    scene.loadMeshes(assets, meshes);
+
+    Renderer renderer;
+    renderer.display().setSize(width, height);
+    renderer.display().setup();
+    renderer.setProjection(scene.camera.fovY * (float)PI / 180.f, width / (float)height, scene.camera.zNear, scene.camera.zFar);
+    if (!scene.lights.empty())
+        renderer.setLights(scene.lights);
+
+    FrameWriter writer;
+    if (!writer.open(output, format, width, height, fps))
+        return 1;
+
+    auto start = std::chrono::steady_clock::now();
+    double renderMs = 0.0;
+
+    for (int f = 0; f < frames; ++f)
+    {
+        auto frameStart = std::chrono::steady_clock::now();
+
+        // fixed timestep: the time of the animation only depends on the number of the frame
+        Vec3d position, target;
+        scene.cameraAt(f / (float)fps, position, target);
+        Mat4 viewMatrix = Mat4::lookAt(position, target, Vec3d(0.f, 1.f, 0.f));
+
+        renderer.processGeometry(meshes, position, viewMatrix);
+        renderer.render(mode);
+        renderer.display().resolveClears();
+        renderer.profiler().frameDone();
+
+        renderMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+
+        writer.push(renderer.display().colorBuffer(), renderer.display().stride());
+    }
+
+    bool written = writer.close();
+    double totalMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cerr << "OfflineRenderer::run: " << writer.framesWritten() << " frames " << width << "x" << height << " in "
+              << std::fixed << std::setprecision(1) << totalMs << " ms: " << frames * 1000.0 / totalMs << " fps overall, "
+              << frames * 1000.0 / renderMs << " fps rendering, writer stalls " << writer.stallMs() << " ms" << std::endl;
+    std::cerr << "OfflineRenderer::run: " << renderer.profiler().report() << std::endl;
+
+    return written ? 0 : 1;
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <string>
+#include <vector>
+
+#include "framewriter.h"
+#include "renderer.h"
+
+
+/* OfflineRenderer: renders the camera path of a scene (or its orbit) to a video stream, without a window.
+ *
+ * The time of each frame is frame / fps: the animation is the same no matter how long a frame takes to render, and the
+ * frames are rendered as fast as the CPU allows. A FrameWriter converts and writes them on another thread.
+ *
+ * Usage: qt3DRenderer --render out.y4m [--scene scene.json] [--frames 300] [--fps 30] [--size 1280x720]
+ *                                      [--format y4m|rgba] [--mode textured|flat|wireframe|deferred]
+ *
+ *        "-" writes to stdout: qt3DRenderer --render - | ffmpeg -i - flythrough.mp4
+ */
+class OfflineRenderer
+{
+public:
+    // run: render the sequence and return the exit code of the application
+    static int run(const std::vector<std::string>& args, const std::string& defaultScene);
+
+private:
+    static int _render(const std::string& output, const std::string& sceneFile, const int& frames, const int& fps,
+                       const int& width, const int& height, const FRAME_FORMAT& format, const RENDER_MODE& mode);
+};
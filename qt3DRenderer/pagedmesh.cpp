@@ -0,0 +1,613 @@
+#include "pagedmesh.h"
+#include "meshoptimizer.h"
+#include "renderer.h"
+
+#include <QDebug>
+#include <QRunnable>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+
+#define PAGE_FILE_MAGIC "QT3DPAGE"
+#define PAGE_FILE_VERSION 1
+
+
+// the records of the page file
+struct PageFileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t pageCount;
+};
+
+struct PageFileLevel
+{
+    uint64_t offset;
+    uint32_t vertexCount;
+    uint32_t faceCount;
+    float error;
+    uint32_t reserved;
+};
+
+struct PageFilePage
+{
+    float center[3];
+    float radius;
+    uint32_t levelCount;
+    uint32_t reserved;
+    PageFileLevel levels[PAGE_LEVELS];
+};
+
+struct PageFileVertex
+{
+    float x, y, z;
+};
+
+struct PageFileFace
+{
+    int32_t a, b, c;
+    float uv[6];
+    uint32_t color;
+};
+
+
+// PageJob: runs a function on the loader threads
+class PageJob : public QRunnable
+{
+public:
+    PageJob(const std::function<void()>& func) : _func(func) {}
+    void run() override { _func(); }
+
+private:
+    std::function<void()> _func;
+};
+
+// mortonCode: interleaves the bits of 3 coordinates in [0, 1023] so that points close in space get close codes
+static uint32_t mortonCode(uint32_t x, uint32_t y, uint32_t z)
+{
+    auto spread = [](uint32_t v)
+    {
+        v = (v | (v << 16)) & 0x030000FF;
+        v = (v | (v << 8)) & 0x0300F00F;
+        v = (v | (v << 4)) & 0x030C30C3;
+        v = (v | (v << 2)) & 0x09249249;
+        return v;
+    };
+
+    return spread(x) | (spread(y) << 1) | (spread(z) << 2);
+}
+
+
+PagedMesh::PagedMesh()
+{
+    _data = nullptr;
+    _size = 0;
+    _budget = PAGE_DEFAULT_BUDGET;
+    _residentBytes = 0;
+    _frame = _loads = _evictions = 0;
+    _queued = 0;
+    _visiblePages = 0;
+    _loader.setMaxThreadCount(PAGE_LOADER_THREADS);
+    _pending = false;
+
+    boundsRadius = 0.f;
+    scale       = Vec3d(1.f, 1.f, 1.f);
+    rotation    = Vec3d(0.f, 0.f, 0.f);
+    translation = Vec3d(0.f, 0.f, 0.f);
+    textureWidth = textureHeight = 0;
+}
+
+PagedMesh::~PagedMesh()
+{
+    close();
+}
+
+/* build: the faces are sorted by the Morton code of their centroids and cut in pages of facesPerPage faces.
+ * Each page gets its own vertices, is sorted for the vertex cache and simplified on its own.
+ */
+bool PagedMesh::build(const Mesh& mesh, const std::string& filename, const unsigned int& facesPerPage)
+{
+    if (mesh.faces.empty() || facesPerPage == 0)
+        return false;
+
+    QFile file(QString::fromStdString(filename));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qDebug() << "PagedMesh::build !!! unable to create" << QString::fromStdString(filename);
+        return false;
+    }
+
+    // centroids of the faces and their bounding box
+    std::vector<Vec3d> centroids(mesh.faces.size());
+    Vec3d minP(1e30f, 1e30f, 1e30f), maxP(-1e30f, -1e30f, -1e30f);
+    for (unsigned int f = 0; f < mesh.faces.size(); ++f)
+    {
+        Vec3d a = mesh.vertices[mesh.faces[f].a], b = mesh.vertices[mesh.faces[f].b], c = mesh.vertices[mesh.faces[f].c];
+        centroids[f] = Vec3d((a.x + b.x + c.x) / 3.f, (a.y + b.y + c.y) / 3.f, (a.z + b.z + c.z) / 3.f);
+
+        minP = Vec3d(std::min(minP.x, centroids[f].x), std::min(minP.y, centroids[f].y), std::min(minP.z, centroids[f].z));
+        maxP = Vec3d(std::max(maxP.x, centroids[f].x), std::max(maxP.y, centroids[f].y), std::max(maxP.z, centroids[f].z));
+    }
+
+    float extent = std::max(maxP.x - minP.x, std::max(maxP.y - minP.y, maxP.z - minP.z));
+    float quantize = (extent > 0.f) ? 1023.f / extent : 0.f;
+
+    std::vector<std::pair<uint32_t, unsigned int>> order(mesh.faces.size());
+    for (unsigned int f = 0; f < mesh.faces.size(); ++f)
+    {
+        uint32_t x = (uint32_t)((centroids[f].x - minP.x) * quantize);
+        uint32_t y = (uint32_t)((centroids[f].y - minP.y) * quantize);
+        uint32_t z = (uint32_t)((centroids[f].z - minP.z) * quantize);
+        order[f] = std::make_pair(mortonCode(x, y, z), f);
+    }
+    std::sort(order.begin(), order.end());
+
+    unsigned int pageCount = (mesh.faces.size() + facesPerPage - 1) / facesPerPage;
+
+    PageFileHeader header;
+    std::memcpy(header.magic, PAGE_FILE_MAGIC, sizeof(header.magic));
+    header.version = PAGE_FILE_VERSION;
+    header.pageCount = pageCount;
+
+    // the table is written at the end, when the offsets are known
+    std::vector<PageFilePage> table(pageCount);
+    std::memset(table.data(), 0, table.size() * sizeof(PageFilePage));
+
+    uint64_t offset = sizeof(PageFileHeader) + table.size() * sizeof(PageFilePage);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(table.data()), table.size() * sizeof(PageFilePage));
+
+    std::vector<int> remap(mesh.vertices.size(), -1);
+    std::vector<PageFileVertex> vertices;
+    std::vector<PageFileFace> faces;
+
+    for (unsigned int p = 0; p < pageCount; ++p)
+    {
+        unsigned int first = p * facesPerPage;
+        unsigned int last = std::min(first + facesPerPage, (unsigned int)mesh.faces.size());
+
+        // the faces of the page with its own vertices
+        Mesh page;
+        for (unsigned int i = first; i < last; ++i)
+        {
+            Face face = mesh.faces[order[i].second];
+            int* indexes[3] = { &face.a, &face.b, &face.c };
+            for (int v = 0; v < 3; ++v)
+            {
+                int& index = *indexes[v];
+                if (remap[index] < 0)
+                {
+                    remap[index] = page.vertices.size();
+                    page.vertices.push_back(mesh.vertices[index]);
+                }
+                index = remap[index];
+            }
+            page.faces.push_back(face);
+        }
+
+        for (unsigned int i = first; i < last; ++i)
+        {
+            const Face& face = mesh.faces[order[i].second];
+            remap[face.a] = remap[face.b] = remap[face.c] = -1;
+        }
+
+        MeshOptimizer::optimizeFaceOrder(page);
+        MeshOptimizer::optimizeVertexOrder(page);
+
+        // the borders are shared with the neighbouring pages, which may be drawn at another level
+        page.generateLods(PAGE_LEVELS - 1, true);
+
+        PageFilePage& record = table[p];
+        record.center[0] = page.boundsCenter.x;
+        record.center[1] = page.boundsCenter.y;
+        record.center[2] = page.boundsCenter.z;
+        record.radius = page.boundsRadius;
+        record.levelCount = 1 + page.lods.size();
+
+        for (unsigned int l = 0; l < record.levelCount; ++l)
+        {
+            const Mesh& level = (l == 0) ? page : page.lods[l - 1];
+
+            vertices.resize(level.vertices.size());
+            for (unsigned int v = 0; v < level.vertices.size(); ++v)
+                vertices[v] = { level.vertices[v].x, level.vertices[v].y, level.vertices[v].z };
+
+            faces.resize(level.faces.size());
+            for (unsigned int f = 0; f < level.faces.size(); ++f)
+            {
+                const Face& face = level.faces[f];
+                faces[f] = { face.a, face.b, face.c,
+                             { face.a_uv.u, face.a_uv.v, face.b_uv.u, face.b_uv.v, face.c_uv.u, face.c_uv.v }, face.color };
+            }
+
+            record.levels[l].offset = offset;
+            record.levels[l].vertexCount = vertices.size();
+            record.levels[l].faceCount = faces.size();
+            record.levels[l].error = (l == 0) ? 0.f : page.lodErrors[l - 1];
+
+            file.write(reinterpret_cast<const char*>(vertices.data()), vertices.size() * sizeof(PageFileVertex));
+            file.write(reinterpret_cast<const char*>(faces.data()), faces.size() * sizeof(PageFileFace));
+            offset += vertices.size() * sizeof(PageFileVertex) + faces.size() * sizeof(PageFileFace);
+        }
+    }
+
+    file.seek(sizeof(PageFileHeader));
+    file.write(reinterpret_cast<const char*>(table.data()), table.size() * sizeof(PageFilePage));
+    file.close();
+
+    return true;
+}
+
+bool PagedMesh::open(const std::string& filename)
+{
+    close();
+
+    _file.setFileName(QString::fromStdString(filename));
+    if (!_file.open(QIODevice::ReadOnly))
+    {
+        qDebug() << "PagedMesh::open !!! unable to open" << QString::fromStdString(filename);
+        return false;
+    }
+
+    _size = _file.size();
+    _data = (_size >= sizeof(PageFileHeader)) ? _file.map(0, _size) : nullptr;
+
+    const PageFileHeader* header = reinterpret_cast<const PageFileHeader*>(_data);
+    if (!_data || std::memcmp(header->magic, PAGE_FILE_MAGIC, sizeof(header->magic)) != 0 || header->version != PAGE_FILE_VERSION ||
+        sizeof(PageFileHeader) + (uint64_t)header->pageCount * sizeof(PageFilePage) > _size)
+    {
+        qDebug() << "PagedMesh::open !!! not a page file:" << QString::fromStdString(filename);
+        close();
+        return false;
+    }
+
+    const PageFilePage* table = reinterpret_cast<const PageFilePage*>(_data + sizeof(PageFileHeader));
+    uint64_t dataStart = sizeof(PageFileHeader) + (uint64_t)header->pageCount * sizeof(PageFilePage);
+    _pages.resize(header->pageCount);
+
+    Vec3d minP(1e30f, 1e30f, 1e30f), maxP(-1e30f, -1e30f, -1e30f);
+    for (unsigned int p = 0; p < _pages.size(); ++p)
+    {
+        Page& page = _pages[p];
+        page.center = Vec3d(table[p].center[0], table[p].center[1], table[p].center[2]);
+        page.radius = table[p].radius;
+
+        if (table[p].levelCount > PAGE_LEVELS || !std::isfinite(page.radius) || page.radius < 0.f)
+        {
+            qDebug() << "PagedMesh::open !!! corrupted page table:" << QString::fromStdString(filename);
+            close();
+            return false;
+        }
+
+        for (unsigned int l = 0; l < table[p].levelCount; ++l)
+        {
+            const PageFileLevel& record = table[p].levels[l];
+            Level level = { record.offset, record.vertexCount, record.faceCount, record.error };
+
+            // the offset is checked first: the end of a level far past the file could overflow
+            uint64_t bytes = (uint64_t)level.vertexCount * sizeof(PageFileVertex) + (uint64_t)level.faceCount * sizeof(PageFileFace);
+            if (level.offset < dataStart || level.offset > _size || bytes > _size - level.offset)
+            {
+                qDebug() << "PagedMesh::open !!! truncated page file:" << QString::fromStdString(filename);
+                close();
+                return false;
+            }
+
+            page.levels.push_back(level);
+        }
+
+        minP = Vec3d(std::min(minP.x, page.center.x - page.radius), std::min(minP.y, page.center.y - page.radius), std::min(minP.z, page.center.z - page.radius));
+        maxP = Vec3d(std::max(maxP.x, page.center.x + page.radius), std::max(maxP.y, page.center.y + page.radius), std::max(maxP.z, page.center.z + page.radius));
+    }
+
+    boundsCenter = (minP + maxP) * 0.5f;
+    boundsRadius = (maxP - minP).mag() * 0.5f;
+
+    _chunkIndex.assign(_pages.size() * PAGE_LEVELS, _chunks.end());
+    return true;
+}
+
+void PagedMesh::close()
+{
+    // the loads still running write to the chunks and read the mapping
+    _loader.waitForDone();
+
+    _meshes.clear();
+    _generations.clear();
+    _previousGenerations.clear();
+    _chunks.clear();
+    _chunkIndex.clear();
+    _pages.clear();
+    _residentBytes = 0;
+
+    if (_data)
+        _file.unmap(const_cast<uchar*>(_data));
+
+    _file.close();
+    _data = nullptr;
+    _size = 0;
+}
+
+bool PagedMesh::isOpen()
+{
+    return _data != nullptr;
+}
+
+void PagedMesh::setBudget(const uint64_t& bytes)
+{
+    _budget = bytes;
+
+    // shrink right away: the chunks in use are released first by the next update() anyway
+    _loader.waitForDone();
+    while (_residentBytes > _budget && !_chunks.empty())
+        _evict(std::prev(_chunks.end()));
+}
+
+/* update: the visible pages ask for their level from the closest to the farthest, so when the budget (or the loads
+ * per frame) runs out, the pages that are left behind are the ones that matter the least.
+ */
+void PagedMesh::update(Renderer& renderer)
+{
+    ++_frame;
+    _previousGenerations.swap(_generations);
+    _generations.clear();
+    _meshes.clear();
+    _visiblePages = 0;
+    _pending = false;
+
+    if (!isOpen())
+        return;
+
+    Mat4 world = Renderer::worldMatrix(scale, rotation, translation);
+    float maxScale = std::max(std::fabs(scale.x), std::max(std::fabs(scale.y), std::fabs(scale.z)));
+
+    struct Request
+    {
+        unsigned int page;
+        unsigned int level;
+        float pixelsPerUnit;
+        Chunk* chunk;           // drawn on this frame (nullptr when no level of the page is loaded)
+    };
+
+    std::vector<Request> requests;
+    for (unsigned int p = 0; p < _pages.size(); ++p)
+    {
+        const Page& page = _pages[p];
+        if (page.levels.empty())
+            continue;
+
+        Vec3d center = Vec4d::toVec3d(Vec3d::toVec4d(page.center) * world);
+        float radius = page.radius * maxScale;
+        if (!renderer.sphereVisible(center, radius))
+            continue;
+
+        // the coarsest level with an error under LOD_PIXEL_ERROR (the camera inside the page needs full detail)
+        float pixels = renderer.pixelsPerUnit(center, radius);
+        unsigned int level = 0;
+        while (ENABLE_LOD && pixels >= 0.f && level + 1 < page.levels.size() &&
+               page.levels[level + 1].error * maxScale * pixels <= LOD_PIXEL_ERROR)
+            ++level;
+
+        requests.push_back({ p, level, (pixels < 0.f) ? 1e30f : pixels, nullptr });
+    }
+
+    _visiblePages = requests.size();
+    std::stable_sort(requests.begin(), requests.end(), [](const Request& a, const Request& b)
+    {
+        return a.pixelsPerUnit > b.pixelsPerUnit;
+    });
+
+    // 1st pass: the chunk drawn for each page, the level requested or else the closest one already loaded. They are
+    // all stamped before any load is queued: the evictions of _queue() skip the chunks drawn on this frame
+    for (Request& request : requests)
+    {
+        Chunk* chunk = _ready(request.page, request.level);
+
+        for (unsigned int d = 1; !chunk && d < PAGE_LEVELS; ++d)
+        {
+            if (request.level + d < PAGE_LEVELS)
+                chunk = _ready(request.page, request.level + d);
+            if (!chunk && request.level >= d)
+                chunk = _ready(request.page, request.level - d);
+        }
+
+        if (!chunk)
+            continue;
+
+        request.chunk = chunk;
+        chunk->lastFrame = _frame;
+        _chunks.splice(_chunks.begin(), _chunks, _chunkIndex[chunk->page * PAGE_LEVELS + chunk->level]);
+        _meshes.push_back(&chunk->mesh);
+        _generations.push_back(chunk->mesh.generation);
+    }
+
+    // 2nd pass: the levels not loaded yet, and the coarsest level of the pages that have none to be drawn with
+    _queued = 0;
+    for (const Request& request : requests)
+    {
+        if (request.chunk && request.chunk->level == request.level)
+            continue;
+
+        _pending = true;
+        _queue(request.page, request.level);
+        if (!request.chunk)
+            _queue(request.page, _pages[request.page].levels.size() - 1);
+    }
+
+    // a face pointing outside of its page: the file can't be trusted anymore
+    for (const Chunk& chunk : _chunks)
+        if (chunk.state.load(std::memory_order_acquire) == CHUNK_CORRUPTED)
+        {
+            qDebug() << "PagedMesh::update !!! corrupted page file:" << _file.fileName();
+            close();
+            _pending = false;
+            return;
+        }
+
+    for (unsigned int m = 0; m < _meshes.size(); ++m)
+    {
+        _meshes[m]->rotation = rotation;
+        _meshes[m]->scale = scale;
+        _meshes[m]->translation = translation;
+        _meshes[m]->texture = texture;
+        _meshes[m]->textureWidth = textureWidth;
+        _meshes[m]->textureHeight = textureHeight;
+    }
+}
+
+void PagedMesh::waitForLoads()
+{
+    _loader.waitForDone();
+}
+
+const std::vector<Mesh*>& PagedMesh::meshes()
+{
+    return _meshes;
+}
+
+bool PagedMesh::pending()
+{
+    return _pending;
+}
+
+bool PagedMesh::changed()
+{
+    return _generations != _previousGenerations;
+}
+
+unsigned int PagedMesh::pageCount()
+{
+    return _pages.size();
+}
+
+unsigned int PagedMesh::visiblePages()
+{
+    return _visiblePages;
+}
+
+unsigned int PagedMesh::residentChunks()
+{
+    return _chunks.size();
+}
+
+uint64_t PagedMesh::residentBytes()
+{
+    return _residentBytes;
+}
+
+uint64_t PagedMesh::loads()
+{
+    return _loads;
+}
+
+uint64_t PagedMesh::evictions()
+{
+    return _evictions;
+}
+
+uint64_t PagedMesh::totalFaces()
+{
+    uint64_t faces = 0;
+    for (unsigned int p = 0; p < _pages.size(); ++p)
+        if (!_pages[p].levels.empty())
+            faces += _pages[p].levels[0].faceCount;
+
+    return faces;
+}
+
+// _chunkBytes: memory of a resident level, including the face planes the renderer adds for object-space culling
+uint64_t PagedMesh::_chunkBytes(const Level& level)
+{
+    return sizeof(Chunk) + level.vertexCount * sizeof(Vec3d) + level.faceCount * (sizeof(Face) + sizeof(Vec3d) + sizeof(float));
+}
+
+/* _queue: a level of a page to be loaded in the background, if it's not resident or on its way already. The least
+ * recently used chunks are evicted to make room, but never one that is drawn on this frame or still loading.
+ */
+void PagedMesh::_queue(const unsigned int& page, const unsigned int& level)
+{
+    if (_resident(page, level) || _queued >= PAGE_LOADS_PER_FRAME)
+        return;
+
+    uint64_t bytes = _chunkBytes(_pages[page].levels[level]);
+    while (_residentBytes + bytes > _budget && !_chunks.empty() && _chunks.back().lastFrame != _frame &&
+           _chunks.back().state.load(std::memory_order_acquire) != CHUNK_LOADING)
+        _evict(std::prev(_chunks.end()));
+
+    if (_residentBytes + bytes > _budget)
+        return;
+
+    _chunks.emplace_front();
+    Chunk* chunk = &_chunks.front();
+    chunk->page = page;
+    chunk->level = level;
+    chunk->bytes = bytes;
+    chunk->lastFrame = _frame;
+    chunk->state = CHUNK_LOADING;
+    _chunkIndex[page * PAGE_LEVELS + level] = _chunks.begin();
+    _residentBytes += bytes;
+    _queued++;
+    _loads++;
+
+    // the first touch of the mapping reads the disk
+    _loader.start(new PageJob([this, chunk]()
+    {
+        bool loaded = _load(*chunk);
+        chunk->state.store(loaded ? CHUNK_READY : CHUNK_CORRUPTED, std::memory_order_release);
+    }));
+}
+
+// _load: false when a face of the level uses a vertex that is not in the level
+bool PagedMesh::_load(Chunk& chunk)
+{
+    const Level& level = _pages[chunk.page].levels[chunk.level];
+    const PageFileVertex* vertices = reinterpret_cast<const PageFileVertex*>(_data + level.offset);
+    const PageFileFace* faces = reinterpret_cast<const PageFileFace*>(_data + level.offset + level.vertexCount * sizeof(PageFileVertex));
+
+    chunk.mesh.vertices.resize(level.vertexCount);
+    for (unsigned int v = 0; v < level.vertexCount; ++v)
+        chunk.mesh.vertices[v] = Vec3d(vertices[v].x, vertices[v].y, vertices[v].z);
+
+    chunk.mesh.faces.reserve(level.faceCount);
+    for (unsigned int f = 0; f < level.faceCount; ++f)
+    {
+        const PageFileFace& face = faces[f];
+        if ((uint32_t)face.a >= level.vertexCount || (uint32_t)face.b >= level.vertexCount || (uint32_t)face.c >= level.vertexCount)
+        {
+            chunk.mesh.vertices.clear();
+            chunk.mesh.faces.clear();
+            return false;
+        }
+
+        chunk.mesh.faces.push_back(Face(face.a, face.b, face.c, Tex2(face.uv[0], face.uv[1]), Tex2(face.uv[2], face.uv[3]),
+                                        Tex2(face.uv[4], face.uv[5]), face.color));
+    }
+
+    return true;
+}
+
+void PagedMesh::_evict(std::list<Chunk>::iterator chunk)
+{
+    _residentBytes -= chunk->bytes;
+    _chunkIndex[chunk->page * PAGE_LEVELS + chunk->level] = _chunks.end();
+    _chunks.erase(chunk);
+    _evictions++;
+}
+
+PagedMesh::Chunk* PagedMesh::_resident(const unsigned int& page, const unsigned int& level)
+{
+    if (level >= PAGE_LEVELS)
+        return nullptr;
+
+    std::list<Chunk>::iterator it = _chunkIndex[page * PAGE_LEVELS + level];
+    return (it == _chunks.end()) ? nullptr : &(*it);
+}
+
+// _ready: the chunk of a level that has finished loading (null when it's not resident or still loading)
+PagedMesh::Chunk* PagedMesh::_ready(const unsigned int& page, const unsigned int& level)
+{
+    Chunk* chunk = _resident(page, level);
+    return (chunk && chunk->state.load(std::memory_order_acquire) == CHUNK_READY) ? chunk : nullptr;
+}
@@ -0,0 +1,152 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <QFile>
+#include <QThreadPool>
+
+#include "mesh.h"
+#include "vec3d.h"
+
+#define PAGE_FACES 4096                     // faces of a page at full detail
+#define PAGE_LEVELS 4                       // full detail + up to 3 simplified levels per page
+#define PAGE_LOADS_PER_FRAME 64             // pages queued for loading on a single frame
+#define PAGE_LOADER_THREADS 2               // threads that copy the pages from the file (they mostly wait for the disk)
+#define PAGE_DEFAULT_BUDGET (256u << 20)    // bytes of resident pages
+
+class Renderer;
+
+
+/* PagedMesh: a mesh too big to live in a single Mesh. It's split offline by build() in pages of PAGE_FACES faces
+ * that are close to each other in space (the faces are sorted along a Morton curve), each one with its bounding
+ * sphere and its own simplified levels. The border vertices of a page are locked by MeshSimplifier, so every level
+ * of a page has the same border as its neighbours and pages at different levels don't crack.
+ *
+ * The page file is memory mapped by open(). Every frame update() picks the pages inside the viewing frustum and the
+ * level each one needs for its projected error, queues the missing ones to be copied from the mapping into resident
+ * Meshes by a pool of background threads (the frame never waits for the disk) and evicts the least recently used ones
+ * to keep the resident memory under the budget. Until its level is loaded, a page is drawn with any other level
+ * already loaded: a page with none gets its coarsest level queued as well, it's the smallest and arrives first.
+ *
+ * Page file: a header, a table with the bounding sphere and the levels of each page, then the vertices and faces of
+ * every level (native byte order, it's a cache of the source mesh rather than an exchange format).
+ */
+class PagedMesh
+{
+public:
+    PagedMesh();
+    ~PagedMesh();
+
+    // build: writes the page file of a mesh
+    static bool build(const Mesh& mesh, const std::string& filename, const unsigned int& facesPerPage = PAGE_FACES);
+
+    // open: maps a page file and checks its table. Nothing is resident until update() is called, the faces of a page
+    // are checked when it's loaded (update() closes the file if one of them is corrupted)
+    bool open(const std::string& filename);
+    void close();
+    bool isOpen();
+
+    // setBudget: maximum bytes of resident pages
+    void setBudget(const uint64_t& bytes);
+
+    // update: streams the pages for the current view of the renderer (Renderer::setView() must have been called)
+    void update(Renderer& renderer);
+
+    // waitForLoads: block until the loads queued by update() are done (they show up on the next update())
+    void waitForLoads();
+
+    // meshes: the resident pages to be drawn on this frame, for Renderer::processGeometry()
+    const std::vector<Mesh*>& meshes();
+
+    // pending: some visible pages are not loaded at the level they need yet
+    bool pending();
+
+    // changed: the chunks drawn on this frame are not the same of the previous one (compared by generation, not by
+    // address: a new chunk may be allocated where an evicted one was)
+    bool changed();
+
+    // stats
+    unsigned int pageCount();
+    unsigned int visiblePages();
+    unsigned int residentChunks();
+    uint64_t residentBytes();
+    uint64_t loads();
+    uint64_t evictions();
+    uint64_t totalFaces();
+
+    // bounding sphere of the whole mesh in Model Space
+    Vec3d boundsCenter;
+    float boundsRadius;
+
+    // transforms and texture of the whole mesh, applied to every page
+    Vec3d rotation;
+    Vec3d scale;
+    Vec3d translation;
+
+    std::shared_ptr<uint32_t[]> texture;
+    int textureWidth;
+    int textureHeight;
+
+private:
+    struct Level
+    {
+        uint64_t offset;        // position of the vertices in the file, followed by the faces
+        uint32_t vertexCount;
+        uint32_t faceCount;
+        float error;            // estimated distance (Model Space units) from the full detail page (Mesh::lodErrors)
+    };
+
+    struct Page
+    {
+        Vec3d center;
+        float radius;
+        std::vector<Level> levels;
+    };
+
+    enum CHUNK_STATE { CHUNK_LOADING, CHUNK_READY, CHUNK_CORRUPTED };
+
+    // Chunk: a level of a page copied from the file. The loader thread writes the mesh before the state leaves
+    // CHUNK_LOADING, the chunk can't be evicted until then
+    struct Chunk
+    {
+        unsigned int page;
+        unsigned int level;
+        uint64_t bytes;
+        uint64_t lastFrame;     // last frame it was drawn (or queued)
+        std::atomic<int> state;
+        Mesh mesh;              // a new chunk has a new Mesh::generation, even at the address of an evicted one
+    };
+
+    static uint64_t _chunkBytes(const Level& level);
+    bool _load(Chunk& chunk);
+    void _queue(const unsigned int& page, const unsigned int& level);
+    void _evict(std::list<Chunk>::iterator chunk);
+    Chunk* _resident(const unsigned int& page, const unsigned int& level);
+    Chunk* _ready(const unsigned int& page, const unsigned int& level);
+
+    QThreadPool _loader;
+    QFile _file;
+    const uchar* _data;
+    uint64_t _size;
+
+    std::vector<Page> _pages;
+
+    std::list<Chunk> _chunks;                                   // resident chunks, most recently used first
+    std::vector<std::list<Chunk>::iterator> _chunkIndex;       // page * PAGE_LEVELS + level -> chunk (or _chunks.end())
+
+    std::vector<Mesh*> _meshes;
+    std::vector<uint64_t> _generations;                         // Mesh::generation of each mesh drawn on this frame
+    std::vector<uint64_t> _previousGenerations;
+    uint64_t _budget;
+    uint64_t _residentBytes;
+    uint64_t _frame;
+    uint64_t _loads;
+    uint64_t _evictions;
+    unsigned int _queued;                                       // loads queued on this frame
+    unsigned int _visiblePages;
+    bool _pending;
+};
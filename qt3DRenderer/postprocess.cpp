@@ -0,0 +1,483 @@
+#include "postprocess.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define HAS_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define HAS_SSE2 0
+#endif
+
+#if HAS_SSE2 && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+    #define HAS_AVX2 1
+    #include <immintrin.h>
+    #ifdef _MSC_VER
+        #define TARGET_AVX2
+    #else
+        #define TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#else
+    #define HAS_AVX2 0
+#endif
+
+#define POST_SPAN 256                   // pixels of a row whose depth is read back at once (fog)
+#define FXAA_EDGE_THRESHOLD_SHIFT 3     // an edge has a luma contrast above 1/8 of the brightest neighbor...
+#define FXAA_EDGE_THRESHOLD_MIN 16      // ...and above this (dark areas are left alone)
+#define FXAA_SUBPIXEL 0.75f             // how much of the blend comes from the isolation of the pixel (FXAA's subpix)
+#define FXAA_EDGE_BLEND 0.25f           // the least blend of a pixel on an edge
+
+
+/* luma and lumaRow: the luma of a pixel, (R + 2G + B) / 4. The rows of lumas are padded by 16 bytes: the SSE2 loads
+ * of the FXAA test read up to the pixel at width
+ */
+static inline uint8_t luma(const uint32_t& color)
+{
+    return (uint8_t)((((color >> 16) & 0xFF) + 2 * ((color >> 8) & 0xFF) + (color & 0xFF)) >> 2);
+}
+
+static void lumaRowScalar(const uint32_t* colors, uint8_t* lumas, const int& width)
+{
+    for (int x = 0; x < width; ++x)
+        lumas[x] = luma(colors[x]);
+}
+
+#if HAS_SSE2
+static void lumaRowSse2(const uint32_t* colors, uint8_t* lumas, const int& width)
+{
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    int x = 0;
+
+    for (; x + 16 <= width; x += 16)
+    {
+        __m128i l[4];
+        for (int i = 0; i < 4; ++i)
+        {
+            __m128i p = _mm_loadu_si128((const __m128i*)(colors + x + 4 * i));
+            __m128i r = _mm_and_si128(_mm_srli_epi32(p, 16), mask);
+            __m128i g = _mm_and_si128(_mm_srli_epi32(p, 8), mask);
+            __m128i b = _mm_and_si128(p, mask);
+            l[i] = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(r, b), _mm_slli_epi32(g, 1)), 2);
+        }
+
+        __m128i l01 = _mm_packs_epi32(l[0], l[1]);
+        __m128i l23 = _mm_packs_epi32(l[2], l[3]);
+        _mm_storeu_si128((__m128i*)(lumas + x), _mm_packus_epi16(l01, l23));
+    }
+
+    for (; x < width; ++x)
+        lumas[x] = luma(colors[x]);
+}
+#endif
+
+// isEdge: the luma contrast of the pixel with its 4 neighbors is high enough to be worth antialiasing
+static inline bool isEdge(const uint8_t* above, const uint8_t* row, const uint8_t* below, const int& x)
+{
+    int maxLuma = std::max(std::max(std::max(above[x], below[x]), std::max(row[x - 1], row[x + 1])), row[x]);
+    int minLuma = std::min(std::min(std::min(above[x], below[x]), std::min(row[x - 1], row[x + 1])), row[x]);
+
+    return maxLuma - minLuma > std::max(maxLuma >> FXAA_EDGE_THRESHOLD_SHIFT, FXAA_EDGE_THRESHOLD_MIN);
+}
+
+/* fxaaPixel: blend the pixel x with its neighbor across the edge. The direction of the edge comes from the second
+ * derivatives of the luma in the 3x3 neighborhood, the neighbor is the side with the highest gradient. The blend
+ * grows with how different the pixel is from the average of its neighborhood (a pixel alone on a staircase)
+ */
+static inline uint32_t fxaaPixel(const uint32_t* above, const uint32_t* row, const uint32_t* below,
+                                 const uint8_t* lumaAbove, const uint8_t* lumaRow, const uint8_t* lumaBelow, const int& x)
+{
+    float n = lumaAbove[x], s = lumaBelow[x], w = lumaRow[x - 1], e = lumaRow[x + 1], c = lumaRow[x];
+    float nw = lumaAbove[x - 1], ne = lumaAbove[x + 1], sw = lumaBelow[x - 1], se = lumaBelow[x + 1];
+
+    float horizontal = std::fabs(nw - 2.f * n + ne) + 2.f * std::fabs(w - 2.f * c + e) + std::fabs(sw - 2.f * s + se);
+    float vertical = std::fabs(nw - 2.f * w + sw) + 2.f * std::fabs(n - 2.f * c + s) + std::fabs(ne - 2.f * e + se);
+
+    uint32_t other;
+    if (horizontal >= vertical)
+        other = (std::fabs(n - c) >= std::fabs(s - c)) ? above[x] : below[x];
+    else
+        other = (std::fabs(w - c) >= std::fabs(e - c)) ? row[x - 1] : row[x + 1];
+
+    float maxLuma = std::max(std::max(std::max(n, s), std::max(w, e)), c);
+    float minLuma = std::min(std::min(std::min(n, s), std::min(w, e)), c);
+    float average = (2.f * (n + s + w + e) + nw + ne + sw + se) / 12.f;
+
+    float subpixel = std::min(std::fabs(average - c) / (maxLuma - minLuma), 1.f);
+    subpixel = (3.f - 2.f * subpixel) * subpixel * subpixel;
+    float blend = std::max(subpixel * subpixel * FXAA_SUBPIXEL, FXAA_EDGE_BLEND);
+
+    uint32_t weight = (uint32_t)(blend * 256.f + 0.5f);
+    uint32_t color = row[x], result = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        uint32_t channel = (((color >> shift) & 0xFF) * (256 - weight) + ((other >> shift) & 0xFF) * weight) >> 8;
+        result |= channel << shift;
+    }
+
+    return result;
+}
+
+
+// fogPixel: blend a pixel towards the color of the fog by its distance (1 / the 1/w of the depth buffer)
+static inline void fogPixel(uint32_t& color, const float& reciprocalW, const float& start, const float& invRange,
+                            const uint32_t& fogColor)
+{
+    if (reciprocalW <= 0.f)
+        return;
+
+    float factor = std::min(std::max((1.f / reciprocalW - start) * invRange, 0.f), 1.f);
+    int weight = (int)(factor * 128.f + 0.5f);
+
+    uint32_t result = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        int channel = (color >> shift) & 0xFF;
+        channel += (((int)((fogColor >> shift) & 0xFF) - channel) * weight) >> 7;
+        result |= (uint32_t)channel << shift;
+    }
+    color = result;
+}
+
+static void fogSpanScalar(uint32_t* row, const float* reciprocalW, const int& count, const float& start,
+                          const float& invRange, const uint32_t& fogColor)
+{
+    for (int x = 0; x < count; ++x)
+        fogPixel(row[x], reciprocalW[x], start, invRange, fogColor);
+}
+
+#if HAS_SSE2
+/* fogSpanSse2: 4 pixels at a time: the fog factors in 1.7 fixed point, each one repeated on the 4 channels of its pixel
+ * (16-bit lanes), and color + (fog - color) * factor for 2 pixels per register. The factors are rounded like
+ * fogPixel() does (+ 0.5 and truncated, not to the nearest even): both kernels give the same image
+ */
+static void fogSpanSse2(uint32_t* row, const float* reciprocalW, const int& count, const float& start,
+                        const float& invRange, const uint32_t& fogColor)
+{
+    const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.f), scale = _mm_set1_ps(128.f), half = _mm_set1_ps(0.5f);
+    const __m128 fogStart = _mm_set1_ps(start), range = _mm_set1_ps(invRange);
+    const __m128i zeroi = _mm_setzero_si128();
+    const __m128i fog = _mm_unpacklo_epi8(_mm_set1_epi32((int)fogColor), zeroi);
+
+    int x = 0;
+    for (; x + 4 <= count; x += 4)
+    {
+        __m128 rw = _mm_loadu_ps(reciprocalW + x);
+        __m128 distance = _mm_div_ps(one, _mm_max_ps(rw, _mm_set1_ps(1e-20f)));
+        __m128 factor = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(distance, fogStart), range), zero), one);
+        factor = _mm_and_ps(factor, _mm_cmpgt_ps(rw, zero));        // nothing drawn: no fog
+
+        __m128i weights = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(factor, scale), half));
+        weights = _mm_packs_epi32(weights, weights);
+        weights = _mm_unpacklo_epi16(weights, weights);
+        __m128i weightsLo = _mm_unpacklo_epi32(weights, weights);
+        __m128i weightsHi = _mm_unpackhi_epi32(weights, weights);
+
+        __m128i colors = _mm_loadu_si128((const __m128i*)(row + x));
+        __m128i lo = _mm_unpacklo_epi8(colors, zeroi);
+        __m128i hi = _mm_unpackhi_epi8(colors, zeroi);
+
+        lo = _mm_add_epi16(lo, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(fog, lo), weightsLo), 7));
+        hi = _mm_add_epi16(hi, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(fog, hi), weightsHi), 7));
+
+        _mm_storeu_si128((__m128i*)(row + x), _mm_packus_epi16(lo, hi));
+    }
+
+    for (; x < count; ++x)
+        fogPixel(row[x], reciprocalW[x], start, invRange, fogColor);
+}
+#endif
+
+// tonemapRowScalar: a table lookup per channel, the alpha is kept
+static void tonemapRowScalar(uint32_t* row, const int& width, const uint32_t* table)
+{
+    for (int x = 0; x < width; ++x)
+    {
+        uint32_t color = row[x];
+        row[x] = (color & 0xFF000000) | (table[(color >> 16) & 0xFF] << 16) | (table[(color >> 8) & 0xFF] << 8) |
+                 table[color & 0xFF];
+    }
+}
+
+#if HAS_AVX2
+/* tonemapRowAvx2: 8 pixels at a time, the 3 channels looked up with gathers from the 32-bit entries of the table
+ * (SSE2 has no gather: the SSE2 level keeps the scalar lookups)
+ */
+TARGET_AVX2 static void tonemapRowAvx2(uint32_t* row, const int& width, const uint32_t* table)
+{
+    const __m256i mask = _mm256_set1_epi32(0xFF), alphaMask = _mm256_set1_epi32((int)0xFF000000);
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8)
+    {
+        __m256i colors = _mm256_loadu_si256((const __m256i*)(row + x));
+        __m256i r = _mm256_i32gather_epi32((const int*)table, _mm256_and_si256(_mm256_srli_epi32(colors, 16), mask), 4);
+        __m256i g = _mm256_i32gather_epi32((const int*)table, _mm256_and_si256(_mm256_srli_epi32(colors, 8), mask), 4);
+        __m256i b = _mm256_i32gather_epi32((const int*)table, _mm256_and_si256(colors, mask), 4);
+
+        __m256i result = _mm256_or_si256(_mm256_and_si256(colors, alphaMask), _mm256_slli_epi32(r, 16));
+        result = _mm256_or_si256(result, _mm256_or_si256(_mm256_slli_epi32(g, 8), b));
+        _mm256_storeu_si256((__m256i*)(row + x), result);
+    }
+
+    tonemapRowScalar(row + x, width - x, table);
+}
+#endif
+
+/* fxaaRowScalar: antialias the pixels [1, width - 1) of row. above, current and below are the original colors of the
+ * rows around it (current is the original of row itself) and lumas their lumas
+ */
+static void fxaaRowScalar(const uint32_t* above, const uint32_t* current, const uint32_t* below, uint8_t* const lumas[3],
+                          uint32_t* row, const int& width)
+{
+    for (int x = 1; x < width - 1; ++x)
+        if (isEdge(lumas[0], lumas[1], lumas[2], x))
+            row[x] = fxaaPixel(above, current, below, lumas[0], lumas[1], lumas[2], x);
+}
+
+#if HAS_SSE2
+// fxaaRowSse2: the contrast test of 16 pixels at a time, only the edges go through fxaaPixel()
+static void fxaaRowSse2(const uint32_t* above, const uint32_t* current, const uint32_t* below, uint8_t* const lumas[3],
+                        uint32_t* row, const int& width)
+{
+    const __m128i minThreshold = _mm_set1_epi8(FXAA_EDGE_THRESHOLD_MIN);
+    const __m128i shiftMask = _mm_set1_epi8((char)(0xFF >> FXAA_EDGE_THRESHOLD_SHIFT));
+    const __m128i zero = _mm_setzero_si128();
+
+    int x = 1;
+    for (; x + 16 <= width - 1; x += 16)
+    {
+        __m128i n = _mm_loadu_si128((const __m128i*)(lumas[0] + x));
+        __m128i s = _mm_loadu_si128((const __m128i*)(lumas[2] + x));
+        __m128i w = _mm_loadu_si128((const __m128i*)(lumas[1] + x - 1));
+        __m128i e = _mm_loadu_si128((const __m128i*)(lumas[1] + x + 1));
+        __m128i c = _mm_loadu_si128((const __m128i*)(lumas[1] + x));
+
+        __m128i maxLuma = _mm_max_epu8(_mm_max_epu8(_mm_max_epu8(n, s), _mm_max_epu8(w, e)), c);
+        __m128i minLuma = _mm_min_epu8(_mm_min_epu8(_mm_min_epu8(n, s), _mm_min_epu8(w, e)), c);
+        __m128i range = _mm_subs_epu8(maxLuma, minLuma);
+
+        __m128i threshold = _mm_and_si128(_mm_srli_epi16(maxLuma, FXAA_EDGE_THRESHOLD_SHIFT), shiftMask);
+        threshold = _mm_max_epu8(threshold, minThreshold);
+
+        int edges = ~_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(range, threshold), zero)) & 0xFFFF;
+        for (int i = 0; edges; ++i, edges >>= 1)
+            if (edges & 1)
+                row[x + i] = fxaaPixel(above, current, below, lumas[0], lumas[1], lumas[2], x + i);
+    }
+
+    for (; x < width - 1; ++x)
+        if (isEdge(lumas[0], lumas[1], lumas[2], x))
+            row[x] = fxaaPixel(above, current, below, lumas[0], lumas[1], lumas[2], x);
+}
+#endif
+
+
+// the kernels bound by PostProcess::bindKernels(), SSE2 until then when it's compiled in
+typedef void (*FogSpanKernel)(uint32_t* row, const float* reciprocalW, const int& count, const float& start,
+                              const float& invRange, const uint32_t& fogColor);
+typedef void (*TonemapRowKernel)(uint32_t* row, const int& width, const uint32_t* table);
+typedef void (*LumaRowKernel)(const uint32_t* colors, uint8_t* lumas, const int& width);
+typedef void (*FxaaRowKernel)(const uint32_t* above, const uint32_t* current, const uint32_t* below,
+                              uint8_t* const lumas[3], uint32_t* row, const int& width);
+
+#if HAS_SSE2
+static FogSpanKernel g_fogSpan = fogSpanSse2;
+static TonemapRowKernel g_tonemapRow = tonemapRowScalar;
+static LumaRowKernel g_lumaRow = lumaRowSse2;
+static FxaaRowKernel g_fxaaRow = fxaaRowSse2;
+#else
+static FogSpanKernel g_fogSpan = fogSpanScalar;
+static TonemapRowKernel g_tonemapRow = tonemapRowScalar;
+static LumaRowKernel g_lumaRow = lumaRowScalar;
+static FxaaRowKernel g_fxaaRow = fxaaRowScalar;
+#endif
+
+
+void PostProcess::bindKernels(const CPU_LEVEL& level)
+{
+    CPU_LEVEL variant = (HAS_SSE2 && level >= CPU_SSE2) ? CPU_SSE2 : CPU_SCALAR;
+
+    g_fogSpan = fogSpanScalar;
+    g_tonemapRow = tonemapRowScalar;
+    g_lumaRow = lumaRowScalar;
+    g_fxaaRow = fxaaRowScalar;
+
+#if HAS_SSE2
+    if (variant == CPU_SSE2)
+    {
+        g_fogSpan = fogSpanSse2;
+        g_lumaRow = lumaRowSse2;
+        g_fxaaRow = fxaaRowSse2;
+    }
+#endif
+
+    // the tonemap only has a gather variant: scalar up to SSE2
+    CPU_LEVEL tonemapVariant = CPU_SCALAR;
+#if HAS_AVX2
+    if (level >= CPU_AVX2)
+    {
+        tonemapVariant = CPU_AVX2;
+        g_tonemapRow = tonemapRowAvx2;
+    }
+#endif
+
+    CpuDispatch::setKernel("fog", variant);
+    CpuDispatch::setKernel("tonemap", tonemapVariant);
+    CpuDispatch::setKernel("fxaa", variant);
+}
+
+PostProcess::PostProcess()
+{
+    setFog(20.f, 100.f, 0xFF000000);
+    setTonemap(1.f, 2.2f);
+}
+
+void PostProcess::setFog(const float& start, const float& end, const uint32_t& color)
+{
+    _fogStart = start;
+    _fogEnd = std::max(end, start + 1e-3f);
+    _fogColor = color;
+}
+
+/* setTonemap: the table maps an 8-bit channel to linear space, applies the exposure and the Reinhard curve (scaled
+ * so that white stays white) and encodes it back with the gamma
+ */
+void PostProcess::setTonemap(const float& exposure, const float& gamma)
+{
+    float e = std::max(exposure, 1e-3f);
+    float white = e / (1.f + e);
+
+    for (int i = 0; i < 256; ++i)
+    {
+        float linear = std::pow(i / 255.f, gamma) * e;
+        float mapped = linear / (1.f + linear) / white;
+        _tonemapTable[i] = (uint32_t)std::min(std::pow(mapped, 1.f / gamma) * 255.f + 0.5f, 255.f);
+    }
+}
+
+void PostProcess::fog(Display& gfx, JobSystem& jobSystem)
+{
+    jobSystem.parallelFor(gfx.height(), POST_ROWS_PER_JOB, [&](unsigned int begin, unsigned int end)
+    {
+        _fogRows(gfx, begin, end);
+    });
+}
+
+void PostProcess::_fogRows(Display& gfx, const int& yStart, const int& yEnd)
+{
+    const int width = gfx.width();
+    const float invRange = 1.f / (_fogEnd - _fogStart);
+    float reciprocalW[POST_SPAN];
+
+    for (int y = yStart; y < yEnd; ++y)
+    {
+        uint32_t* row = &gfx.colorBuffer()[gfx.stride() * y];
+
+        for (int x1 = 0; x1 < width; x1 += POST_SPAN)
+        {
+            int x2 = std::min(x1 + POST_SPAN, width);
+            gfx.reciprocalW(y, x1, x2, reciprocalW);
+            g_fogSpan(row + x1, reciprocalW, x2 - x1, _fogStart, invRange, _fogColor);
+        }
+    }
+}
+
+void PostProcess::tonemap(Display& gfx, JobSystem& jobSystem)
+{
+    jobSystem.parallelFor(gfx.height(), POST_ROWS_PER_JOB, [&](unsigned int begin, unsigned int end)
+    {
+        _tonemapRows(gfx, begin, end);
+    });
+}
+
+// _tonemapRows: a table lookup per channel (the table is faster than computing the curve, and exact)
+void PostProcess::_tonemapRows(Display& gfx, const int& yStart, const int& yEnd)
+{
+    for (int y = yStart; y < yEnd; ++y)
+        g_tonemapRow(&gfx.colorBuffer()[gfx.stride() * y], gfx.width(), _tonemapTable);
+}
+
+/* fxaa: the bands of rows are filtered in parallel, in place. A band reads the last row of the band above it and the
+ * first row of the band below it, which those bands are going to change: the 1st pass saves them before any band
+ * starts writing. The first and last rows and columns of the screen are not filtered.
+ */
+void PostProcess::fxaa(Display& gfx, JobSystem& jobSystem)
+{
+    const int width = gfx.width(), height = gfx.height();
+    if (width < 3 || height < 3)
+        return;
+
+    const int bands = (height + POST_ROWS_PER_JOB - 1) / POST_ROWS_PER_JOB;
+    _fxaaRows.resize((size_t)bands * 4 * width);
+    _fxaaLumas.resize((size_t)bands * 3 * (width + 16));
+
+    uint32_t* colorBuffer = gfx.colorBuffer();
+    const int stride = gfx.stride();
+
+    jobSystem.parallelFor(bands, 1, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int band = begin; band < end; ++band)
+        {
+            uint32_t* rows = &_fxaaRows[(size_t)band * 4 * width];
+            int yStart = band * POST_ROWS_PER_JOB;
+            int yEnd = std::min(yStart + POST_ROWS_PER_JOB, height);
+
+            if (yStart > 0)
+                std::memcpy(rows, &colorBuffer[stride * (yStart - 1)], width * sizeof(uint32_t));
+            if (yEnd < height)
+                std::memcpy(rows + width, &colorBuffer[stride * yEnd], width * sizeof(uint32_t));
+        }
+    });
+
+    jobSystem.parallelFor(bands, 1, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int band = begin; band < end; ++band)
+            _fxaaBand(gfx, band);
+    });
+}
+
+void PostProcess::_fxaaBand(Display& gfx, const int& band)
+{
+    const int width = gfx.width(), height = gfx.height(), stride = gfx.stride();
+    uint32_t* colorBuffer = gfx.colorBuffer();
+
+    const int yStart = band * POST_ROWS_PER_JOB;
+    const int yEnd = std::min(yStart + POST_ROWS_PER_JOB, height);
+    const int first = std::max(yStart, 1), last = std::min(yEnd, height - 1);
+    if (first >= last)
+        return;
+
+    uint32_t* rows = &_fxaaRows[(size_t)band * 4 * width];
+    const uint32_t* topBorder = rows;
+    const uint32_t* bottomBorder = rows + width;
+    uint32_t* saved[2] = { rows + 2 * width, rows + 3 * width };
+
+    const size_t lumaStride = width + 16;
+    uint8_t* lumas[3];      // above, current and below rows
+    for (int i = 0; i < 3; ++i)
+        lumas[i] = &_fxaaLumas[((size_t)band * 3 + i) * lumaStride];
+
+    // the row above the first one: the saved border, unless it's the first row of the screen (never written)
+    const uint32_t* above = (first == yStart) ? topBorder : &colorBuffer[stride * (first - 1)];
+    g_lumaRow(above, lumas[0], width);
+    g_lumaRow(&colorBuffer[stride * first], lumas[1], width);
+
+    for (int y = first; y < last; ++y)
+    {
+        uint32_t* row = &colorBuffer[stride * y];
+        const uint32_t* below = (y + 1 == yEnd) ? bottomBorder : &colorBuffer[stride * (y + 1)];
+        g_lumaRow(below, lumas[2], width);
+
+        // the original of the row: its pixels are written below, and read again as the row above the next one
+        uint32_t* current = saved[y & 1];
+        std::memcpy(current, row, width * sizeof(uint32_t));
+
+        g_fxaaRow(above, current, below, lumas, row, width);
+
+        above = current;
+        std::swap(lumas[0], lumas[1]);
+        std::swap(lumas[1], lumas[2]);
+    }
+}
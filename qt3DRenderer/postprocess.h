@@ -0,0 +1,59 @@
+#pragma once
+#include <stdint.h>
+
+#include <vector>
+
+#include "cpudispatch.h"
+#include "display.h"
+#include "jobsystem.h"
+
+#define POST_ROWS_PER_JOB 32        // rows of the screen filtered by a single job (a band)
+
+
+/* PostProcess: filters applied to the frame of a Display once it's rasterized, in place:
+ *  - fog: the color goes towards the color of the fog with the distance, read back from the depth buffer (linear fog
+ *    between a start and an end distance, the pixels where nothing was drawn are left alone);
+ *  - tonemap: exposure + Reinhard curve in linear space and gamma encoding, through a lookup table of 256 entries;
+ *  - fxaa: the edge antialiasing of FXAA without the search along the edges: pixels whose luma contrast with their
+ *    4 neighbors is high are blended with the neighbor across the edge, more so the more isolated they are.
+ *
+ * The filters work on bands of rows split among the threads of a JobSystem, with SSE2 kernels (16 pixels at a time
+ * for the contrast test of FXAA, 4 at a time for the fog) and AVX2 gathers for the tonemap (8 at a time). They can be
+ * chained in any order without a copy of the frame: fog and tonemap only touch their own pixel, FXAA keeps the original
+ * of the rows it's going to read (its own 2 rows plus the 2 rows on the borders of each band) and writes the result
+ * right over the color buffer.
+ */
+class PostProcess
+{
+public:
+    PostProcess();
+
+    // bindKernels: the variants of the fog, tonemap and FXAA kernels used by every PostProcess (see CpuDispatch)
+    static void bindKernels(const CPU_LEVEL& level);
+
+    // setFog: linear fog from start to end (Camera Space distances along the view direction)
+    void setFog(const float& start, const float& end, const uint32_t& color);
+
+    // setTonemap: exposure applied before the Reinhard curve and the gamma of the display (2.2 for sRGB)
+    void setTonemap(const float& exposure, const float& gamma);
+
+    // fog, tonemap and fxaa: apply a filter to the whole frame of gfx
+    void fog(Display& gfx, JobSystem& jobSystem);
+    void tonemap(Display& gfx, JobSystem& jobSystem);
+    void fxaa(Display& gfx, JobSystem& jobSystem);
+
+private:
+    void _fogRows(Display& gfx, const int& yStart, const int& yEnd);
+    void _tonemapRows(Display& gfx, const int& yStart, const int& yEnd);
+    void _fxaaBand(Display& gfx, const int& band);
+
+    float _fogStart;
+    float _fogEnd;
+    uint32_t _fogColor;
+
+    uint32_t _tonemapTable[256];    // 32-bit entries (0 to 255): the AVX2 kernel gathers them
+
+    // FXAA: the original rows kept by each band (top border, bottom border, previous, current) and their lumas
+    std::vector<uint32_t> _fxaaRows;
+    std::vector<uint8_t> _fxaaLumas;
+};
@@ -0,0 +1,176 @@
+#include "profiler.h"
+#include "allocationtracker.h"
+#include "cpudispatch.h"
+
+#include <iomanip>
+#include <sstream>
+
+
+Profiler::Profiler()
+{
+    _frames = 0;
+}
+
+void Profiler::begin(const std::string& stage)
+{
+    Stage* s = _stage(stage);
+    s->startAllocations = AllocationTracker::allocations();
+    s->startBytes = AllocationTracker::bytes();
+    s->start = std::chrono::steady_clock::now();
+}
+
+void Profiler::end(const std::string& stage)
+{
+    Stage* s = _stage(stage);
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - s->start;
+    s->totalMs += elapsed.count();
+    s->frameMs += elapsed.count();
+
+    uint64_t allocations = AllocationTracker::allocations() - s->startAllocations;
+    s->totalAllocations += allocations;
+    s->totalBytes += AllocationTracker::bytes() - s->startBytes;
+    s->frameAllocations += allocations;
+}
+
+void Profiler::frameDone()
+{
+    for (unsigned int i = 0; i < _stages.size(); ++i)
+    {
+        _stages[i].lastMs = _stages[i].frameMs;
+        _stages[i].frameMs = 0;
+        _stages[i].lastAllocations = _stages[i].frameAllocations;
+        _stages[i].frameAllocations = 0;
+    }
+
+    _frames++;
+}
+
+int Profiler::frames()
+{
+    return _frames;
+}
+
+double Profiler::average(const std::string& stage)
+{
+    if (!_frames)
+        return 0;
+
+    return _stage(stage)->totalMs / _frames;
+}
+
+double Profiler::frameTime()
+{
+    if (!_frames)
+        return 0;
+
+    double totalMs = 0;
+    for (unsigned int i = 0; i < _stages.size(); ++i)
+        totalMs += _stages[i].totalMs;
+
+    return totalMs / _frames;
+}
+
+double Profiler::last(const std::string& stage)
+{
+    return _stage(stage)->lastMs;
+}
+
+double Profiler::allocations(const std::string& stage)
+{
+    if (!_frames)
+        return 0;
+
+    return _stage(stage)->totalAllocations / (double)_frames;
+}
+
+uint64_t Profiler::lastAllocations(const std::string& stage)
+{
+    return _stage(stage)->lastAllocations;
+}
+
+double Profiler::frameAllocations()
+{
+    if (!_frames)
+        return 0;
+
+    uint64_t allocations = 0;
+    for (unsigned int i = 0; i < _stages.size(); ++i)
+        allocations += _stages[i].totalAllocations;
+
+    return allocations / (double)_frames;
+}
+
+double Profiler::frameBytes()
+{
+    if (!_frames)
+        return 0;
+
+    uint64_t bytes = 0;
+    for (unsigned int i = 0; i < _stages.size(); ++i)
+        bytes += _stages[i].totalBytes;
+
+    return bytes / (double)_frames;
+}
+
+void Profiler::reset()
+{
+    for (unsigned int i = 0; i < _stages.size(); ++i)
+    {
+        _stages[i].totalMs = 0;
+        _stages[i].totalAllocations = 0;
+        _stages[i].totalBytes = 0;
+    }
+
+    _frames = 0;
+}
+
+std::string Profiler::report()
+{
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(2) << "frame=" << frameTime() << " ms (";
+
+    for (unsigned int i = 0; i < _stages.size(); ++i)
+        ss << (i ? " " : "") << _stages[i].name << "=" << average(_stages[i].name);
+
+    ss << ")";
+
+    // only the stages that allocate
+    if (AllocationTracker::enabled())
+    {
+        ss << std::setprecision(1) << " allocs=" << frameAllocations() << "/frame " << frameBytes() / 1024.0 << " KB/frame (";
+        bool first = true;
+        for (unsigned int i = 0; i < _stages.size(); ++i)
+            if (_stages[i].totalAllocations)
+            {
+                ss << (first ? "" : " ") << _stages[i].name << "=" << allocations(_stages[i].name);
+                first = false;
+            }
+        ss << ")";
+    }
+
+    // the variants of the kernels the times were measured with
+    ss << " kernels(" << CpuDispatch::kernels() << ")";
+
+    return ss.str();
+}
+
+// _stage: find a stage by its name, stages that don't exist yet are created
+Profiler::Stage* Profiler::_stage(const std::string& name)
+{
+    for (unsigned int i = 0; i < _stages.size(); ++i)
+        if (_stages[i].name == name)
+            return &_stages[i];
+
+    Stage s;
+    s.name = name;
+    s.start = std::chrono::steady_clock::now();
+    s.totalMs = 0;
+    s.frameMs = 0;
+    s.lastMs = 0;
+    s.startAllocations = s.startBytes = 0;
+    s.totalAllocations = s.totalBytes = 0;
+    s.frameAllocations = s.lastAllocations = 0;
+    _stages.push_back(s);
+
+    return &_stages.back();
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+/* Profiler: accumulates how long each stage of a frame takes and averages it over the frames counted
+ * since the last reset(). Stages are reported in the order they were first used and must not overlap.
+ * The heap allocations made during each stage are counted too when AllocationTracker is enabled.
+ */
+class Profiler
+{
+public:
+    Profiler();
+
+    // begin: start timing a stage of the current frame
+    void begin(const std::string& stage);
+
+    // end: stop timing the stage and accumulate its duration
+    void end(const std::string& stage);
+
+    // frameDone: count one more frame
+    void frameDone();
+
+    // frames: number of frames counted since the last reset()
+    int frames();
+
+    // average: average time (ms) spent per frame on a stage
+    double average(const std::string& stage);
+
+    // frameTime: average time (ms) per frame spent on all the stages
+    double frameTime();
+
+    // last: time (ms) spent on a stage during the last frame (0 if the stage didn't run on that frame)
+    double last(const std::string& stage);
+
+    // allocations: average number of heap allocations per frame made during a stage (see AllocationTracker)
+    double allocations(const std::string& stage);
+
+    // lastAllocations: heap allocations made during a stage on the last frame
+    uint64_t lastAllocations(const std::string& stage);
+
+    // frameAllocations and frameBytes: average heap allocations (and bytes allocated) per frame on all the stages
+    double frameAllocations();
+    double frameBytes();
+
+    // reset: zero all the timers and the frame counter
+    void reset();
+
+    // report: a single line with the average frame time and the average time of each stage (+ the allocations)
+    std::string report();
+
+private:
+    struct Stage
+    {
+        std::string name;
+        std::chrono::steady_clock::time_point start;
+        double totalMs;
+        double frameMs;     // accumulated on the current frame
+        double lastMs;      // total of the previous frame
+
+        uint64_t startAllocations, startBytes;  // the counters of AllocationTracker at begin()
+        uint64_t totalAllocations, totalBytes;
+        uint64_t frameAllocations;
+        uint64_t lastAllocations;
+    };
+
+    Stage* _stage(const std::string& name);
+
+    std::vector<Stage> _stages;
+    int _frames;
+};
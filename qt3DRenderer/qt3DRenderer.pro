@@ -1,36 +1,83 @@
-QT += core widgets
-
-SOURCES += \
-    camera.cpp \
-    clipping.cpp \
-    cubemesh.cpp \
-    display.cpp \
-    face.cpp \
-    light.cpp \
-    main.cpp \
-    mat4.cpp \
-    mesh.cpp \
-    objloader.cpp \
-    tex2.cpp \
-    triangle.cpp \
-    vec2d.cpp \
-    vec3d.cpp \
-    vec4d.cpp \
-    window.cpp
-
-HEADERS += \
-    camera.h \
-    clipping.h \
-    cubemesh.h \
-    display.h \
-    face.h \
-    light.h \
-    mat4.h \
-    mesh.h \
-    objloader.h \
-    tex2.h \
-    triangle.h \
-    vec2d.h \
-    vec3d.h \
-    vec4d.h \
-    window.h
+QT += core widgets
+
+# count the heap allocations of every frame (qmake CONFIG+=bench for an optimized build that tracks them)
+CONFIG(debug, debug|release)|bench {
+    DEFINES += TRACK_ALLOCATIONS
+}
+
+SOURCES += \
+    allocationtracker.cpp \
+    assetmanager.cpp \
+    benchmark.cpp \
+    camera.cpp \
+    clipping.cpp \
+    cpudispatch.cpp \
+    cubemesh.cpp \
+    display.cpp \
+    face.cpp \
+    framewriter.cpp \
+    jobsystem.cpp \
+    light.cpp \
+    lighting.cpp \
+    main.cpp \
+    mat4.cpp \
+    mesh.cpp \
+    meshoptimizer.cpp \
+    meshsimplifier.cpp \
+    microbenchmark.cpp \
+    multiviewrenderer.cpp \
+    objloader.cpp \
+    offlinerenderer.cpp \
+    pagedmesh.cpp \
+    postprocess.cpp \
+    profiler.cpp \
+    regression.cpp \
+    renderer.cpp \
+    resolutionscaler.cpp \
+    scene.cpp \
+    shadowmap.cpp \
+    stressscene.cpp \
+    tex2.cpp \
+    triangle.cpp \
+    vec2d.cpp \
+    vec3d.cpp \
+    vec4d.cpp \
+    window.cpp
+
+HEADERS += \
+    allocationtracker.h \
+    assetmanager.h \
+    benchmark.h \
+    camera.h \
+    clipping.h \
+    cpudispatch.h \
+    cubemesh.h \
+    display.h \
+    face.h \
+    framewriter.h \
+    jobsystem.h \
+    light.h \
+    lighting.h \
+    mat4.h \
+    mesh.h \
+    meshoptimizer.h \
+    meshsimplifier.h \
+    microbenchmark.h \
+    multiviewrenderer.h \
+    objloader.h \
+    offlinerenderer.h \
+    pagedmesh.h \
+    postprocess.h \
+    profiler.h \
+    regression.h \
+    renderer.h \
+    resolutionscaler.h \
+    scene.h \
+    shadowmap.h \
+    stressscene.h \
+    tex2.h \
+    triangle.h \
+    vec2d.h \
+    vec3d.h \
+    vec4d.h \
+    window.h
@@ -0,0 +1,588 @@
+#include "regression.h"
+#include "allocationtracker.h"
+#include "assetmanager.h"
+#include "clipping.h"
+#include "mat4.h"
+#include "objloader.h"
+#include "scene.h"
+#include "vec4d.h"
+
+#include <QDir>
+#include <QFile>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+
+#define GOLDEN_WIDTH 320
+#define GOLDEN_HEIGHT 240
+#define PIXEL_TOLERANCE 16          // max difference of a channel before a pixel counts as different (rounding, FMA, ...)
+#define MAX_DIFF_PIXELS 0.005f      // fraction of the pixels of an image that may be different from the golden one
+#define PERF_TOLERANCE 25.f         // % above the budget of a scene before the frame time fails
+#define PERF_FRAMES 20              // frames averaged for the frame time (the best of 3 runs is kept)
+#define ALLOCATION_FRAMES 10        // frames whose heap allocations are counted once the scene is warmed up
+#define EPSILON 1e-4f
+#define DEPTH_NEAR 0.5f             // near plane of the depth precision check
+#define DEPTH_FAR 8192.f            // the farthest distance tried
+#define DEPTH_GAP 1e-4f             // the quads are 0.01% of their distance apart
+#define DEPTH_RESOLVE_FLOAT 1024.f  // distances each format must resolve at least (half of what they do on x86-64)
+#define DEPTH_RESOLVE_UNORM16 2.f
+#define DEPTH_RESOLVE_REVERSED 8192.f
+
+
+// SceneCase: one of the canonical scenes and the golden image it must match
+struct SceneCase
+{
+    std::string name;
+    std::string golden;             // file name of the golden image (several cases may share one)
+    RENDER_MODE mode;
+    Vec3d eye;
+    Vec3d target;
+    std::vector<Mesh> meshes;
+    std::vector<Light> lights;      // empty: the default light of the Renderer
+    DEPTH_FORMAT depthFormat = DEPTH_FORMAT::DEPTH_FLOAT;
+};
+
+static bool nearlyEqual(const float& a, const float& b)
+{
+    return std::fabs(a - b) < EPSILON;
+}
+
+static bool sameMat4(const Mat4& a, const Mat4& b)
+{
+    for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 4; ++j)
+            if (!nearlyEqual(a.m[i][j], b.m[i][j]))
+                return false;
+
+    return true;
+}
+
+static std::string path(const std::string& dir, const std::string& file)
+{
+    return QDir(QString::fromStdString(dir)).filePath(QString::fromStdString(file)).toStdString();
+}
+
+// loadBudgets: "name milliseconds" on each line
+static std::map<std::string, double> loadBudgets(const std::string& filename)
+{
+    std::map<std::string, double> budgets;
+    std::ifstream file(filename);
+
+    std::string name;
+    double ms;
+    while (file >> name >> ms)
+        budgets[name] = ms;
+
+    return budgets;
+}
+
+
+int Regression::run(const std::vector<std::string>& args, const std::string& assetsDir)
+{
+    std::string assets = assetsDir;
+    bool update = false;
+    float perfTolerance = PERF_TOLERANCE;
+
+    for (unsigned int i = 0; i < args.size(); ++i)
+    {
+        if (args[i] == "--update")
+            update = true;
+        else if (args[i] == "--assets" && i + 1 < args.size())
+            assets = args[++i];
+        else if (args[i] == "--perf-tolerance" && i + 1 < args.size())
+            perfTolerance = std::stof(args[++i]);
+    }
+
+    std::vector<Result> results;
+    _math(results);
+    _clipping(results);
+    _objLoader(results, assets);
+    _depthPrecision(results);
+    _scenes(results, assets, update, perfTolerance);
+
+    int failed = 0;
+    for (unsigned int r = 0; r < results.size(); ++r)
+    {
+        std::cout << (results[r].passed ? "  PASS  " : "  FAIL  ") << std::left << std::setw(24) << results[r].name << std::right
+                  << results[r].details << std::endl;
+
+        if (!results[r].passed)
+            failed++;
+    }
+
+    std::cout << "Regression::run: " << results.size() - failed << "/" << results.size() << " checks passed" << std::endl;
+    return failed;
+}
+
+void Regression::_math(std::vector<Result>& results)
+{
+    Mat4 transform = Mat4::translate(1.f, 2.f, 3.f) * Mat4::rotateY(0.7f) * Mat4::scale(2.f, 3.f, 4.f);
+
+    results.push_back({ "mat4 identity", sameMat4(Mat4::eye() * transform, transform) && sameMat4(transform * Mat4::eye(), transform), "" });
+
+    // the columns of the scale are applied first, then the rotation and the translation
+    Vec4d p = Vec4d(1.f, 1.f, 1.f, 1.f) * transform;
+    float x = 2.f * std::cos(0.7f) + 4.f * std::sin(0.7f) + 1.f;
+    float z = -2.f * std::sin(0.7f) + 4.f * std::cos(0.7f) + 3.f;
+    results.push_back({ "mat4 transform", nearlyEqual(p.x, x) && nearlyEqual(p.y, 5.f) && nearlyEqual(p.z, z) && nearlyEqual(p.w, 1.f), "" });
+}
+
+/* _clipping: the frustum is a box here, only the near (z = 1) and far (z = 10) planes are close enough to the
+ * triangles to cut them.
+ */
+void Regression::_clipping(std::vector<Result>& results)
+{
+    Plane planes[6];
+    Triangle triangles[MAX_POLYGON_TRIANGLES];
+    Vec3d normals[6] = { Vec3d(1, 0, 0), Vec3d(-1, 0, 0), Vec3d(0, -1, 0), Vec3d(0, 1, 0), Vec3d(0, 0, 1), Vec3d(0, 0, -1) };
+    Vec3d points[6] = { Vec3d(-100, 0, 0), Vec3d(100, 0, 0), Vec3d(0, 100, 0), Vec3d(0, -100, 0), Vec3d(0, 0, 1), Vec3d(0, 0, 10) };
+    for (int p = 0; p < 6; ++p)
+    {
+        planes[p].normal = normals[p];
+        planes[p].point = points[p];
+    }
+
+    Polygon inside(Vec3d(0, 0, 5), Vec3d(1, 0, 5), Vec3d(0, 1, 5), Tex2(0, 0), Tex2(1, 0), Tex2(0, 1));
+    inside.clip(planes);
+    results.push_back({ "clip inside", inside.vertexCount == 3 && inside.triangles(triangles) == 1, "" });
+
+    Polygon outside(Vec3d(0, 0, 0.5f), Vec3d(1, 0, 0.5f), Vec3d(0, 1, 0.5f), Tex2(0, 0), Tex2(1, 0), Tex2(0, 1));
+    outside.clip(planes);
+    results.push_back({ "clip outside", outside.triangles(triangles) == 0, "" });
+
+    // one vertex behind the near plane: the triangle becomes a quad whose new vertices lie on the plane, with their
+    // texture coordinates interpolated at the same point of the edges
+    Polygon across(Vec3d(0, 0, 0), Vec3d(2, 0, 2), Vec3d(0, 2, 2), Tex2(0, 0), Tex2(1, 0), Tex2(0, 1));
+    across.clip(planes);
+
+    bool onPlane = across.vertexCount == 4;
+    for (int v = 0; onPlane && v < across.vertexCount; ++v)
+    {
+        const Vec3d& vertex = across.vertices[v];
+        const Tex2& uv = across.texCoords[v];
+        onPlane = vertex.z > 1.f - EPSILON && nearlyEqual(uv.u, vertex.x / 2.f) && nearlyEqual(uv.v, vertex.y / 2.f);
+    }
+    results.push_back({ "clip near plane", onPlane && across.triangles(triangles) == 2, "" });
+}
+
+void Regression::_objLoader(std::vector<Result>& results, const std::string& assetsDir)
+{
+    std::string filename = path(assetsDir, "cube.obj");
+    if (!QFile::exists(QString::fromStdString(filename)))
+    {
+        results.push_back({ "objloader cube", false, filename + " not found" });
+        return;
+    }
+
+    Mesh mesh = OBJLoader(filename).mesh();
+
+    bool indexes = true;
+    for (unsigned int f = 0; f < mesh.faces.size(); ++f)
+    {
+        const Face& face = mesh.faces[f];
+        indexes = indexes && face.a >= 0 && face.b >= 0 && face.c >= 0 && face.a < (int)mesh.vertices.size() &&
+                  face.b < (int)mesh.vertices.size() && face.c < (int)mesh.vertices.size() &&
+                  face.a_n >= 0 && face.a_n < (int)mesh.normals.size();
+    }
+
+    bool passed = mesh.vertices.size() == 8 && mesh.faces.size() == 12 && mesh.normals.size() == 6 && indexes;
+    results.push_back({ "objloader cube", passed, std::to_string(mesh.vertices.size()) + " vertices, " +
+                        std::to_string(mesh.faces.size()) + " faces, " + std::to_string(mesh.normals.size()) + " normals" });
+}
+
+/* _depthPrecision: a blue quad is drawn across the whole screen and a red one DEPTH_GAP closer to the camera over it,
+ * at distances growing by 2x from the near plane. Any blue pixel left is z-fighting. The farthest distance where the red
+ * quad wins everywhere must reach the one expected of each format (16-bit fights first, reversed-Z never does).
+ */
+void Regression::_depthPrecision(std::vector<Result>& results)
+{
+    struct Format { const char* name; DEPTH_FORMAT format; float expected; };
+    Format formats[] = { { "depth float", DEPTH_FORMAT::DEPTH_FLOAT, DEPTH_RESOLVE_FLOAT },
+                         { "depth unorm16", DEPTH_FORMAT::DEPTH_UNORM16, DEPTH_RESOLVE_UNORM16 },
+                         { "depth reversed-z", DEPTH_FORMAT::DEPTH_REVERSED_FLOAT, DEPTH_RESOLVE_REVERSED } };
+
+    const int SIZE = 64;
+    Display gfx;
+    gfx.setSize(SIZE, SIZE);
+    gfx.setup();
+    gfx.setLazyClear(false);
+    gfx.setNearPlane(DEPTH_NEAR);
+
+    for (const Format& format : formats)
+    {
+        gfx.setDepthFormat(format.format);
+
+        float resolved = 0.f;
+        for (float distance = DEPTH_NEAR; distance <= DEPTH_FAR; distance *= 2.f)
+        {
+            gfx.clearColorBuffer(0xFF000000);
+            gfx.clearDepthBuffer(1.f);
+
+            float depths[2] = { distance * (1.f + DEPTH_GAP), distance };
+            uint32_t colors[2] = { 0xFF0000FF, 0xFFFF0000 };
+            for (int q = 0; q < 2; ++q)
+            {
+                Vec4d a(0.f, 0.f, 0.f, depths[q]), b(0.f, SIZE - 1.f, 0.f, depths[q]);
+                Vec4d c(SIZE - 1.f, 0.f, 0.f, depths[q]), d(SIZE - 1.f, SIZE - 1.f, 0.f, depths[q]);
+                gfx.fillTriangle(a, b, c, colors[q]);
+                gfx.fillTriangle(b, d, c, colors[q]);
+            }
+
+            int fighting = 0;
+            for (int y = 0; y < SIZE; ++y)
+                for (int x = 0; x < SIZE; ++x)
+                    if (gfx.colorBuffer()[gfx.stride() * y + x] == colors[0])
+                        fighting++;
+
+            if (fighting)
+                break;
+
+            resolved = distance;
+        }
+
+        std::ostringstream details;
+        details << "resolved up to " << resolved << " (expected " << format.expected << ")";
+        results.push_back({ format.name, resolved >= format.expected, details.str() });
+    }
+
+    gfx.setDepthFormat(DEPTH_FORMAT::DEPTH_FLOAT);
+}
+
+void Regression::_scenes(std::vector<Result>& results, const std::string& assetsDir, const bool& update, const float& perfTolerance)
+{
+    const float PI = 3.14159265358979323846f;
+    std::string goldenDir = path(assetsDir, "golden");
+    std::string budgetsFile = path(goldenDir, "budgets.txt");
+
+    /* assets: the scene file of the application + the cube */
+
+    Scene scene;
+    if (!scene.load(path(assetsDir, "scene.json")))
+    {
+        results.push_back({ "scenes", false, "unable to load " + path(assetsDir, "scene.json") });
+        return;
+    }
+
+    AssetManager assets;
+    MeshAsset cubeMesh = assets.loadMesh(path(assetsDir, "cube.obj"));
+    TextureAsset cubeTexture = assets.loadTexture(path(assetsDir, "cube.png"));
+
+    std::vector<MeshAsset> sceneMeshes;
+    std::vector<TextureAsset> sceneTextures;
+    for (unsigned int m = 0; m < scene.meshes.size(); ++m)
+    {
+        sceneMeshes.push_back(scene.meshes[m].enabled ? assets.loadMesh(scene.meshes[m].obj, scene.lodLevels) : MeshAsset());
+        sceneTextures.push_back(scene.meshes[m].enabled ? assets.loadTexture(scene.meshes[m].texture) : TextureAsset());
+    }
+
+    assets.waitForAll();
+
+    auto mesh = [](const MeshAsset& meshAsset, const TextureAsset& textureAsset, const Vec3d& scale, const Vec3d& rotation,
+                   const Vec3d& translation)
+    {
+        Mesh m;
+        m.asset = meshAsset->data();
+        m.setTexture(textureAsset->data()->pixels, textureAsset->data()->width, textureAsset->data()->height);
+        m.scale = scale;
+        m.rotation = rotation;
+        m.translation = translation;
+        return m;
+    };
+
+    if (!cubeMesh->ready() || !cubeTexture->ready())
+    {
+        results.push_back({ "scenes", false, "unable to load cube.obj/cube.png from " + assetsDir });
+        return;
+    }
+
+    /* the canonical scenes */
+
+    std::vector<SceneCase> cases;
+    Vec3d one(1.f, 1.f, 1.f);
+
+    SceneCase cube = { "cube textured", "cube.png", RENDER_MODE::TEXTURED, Vec3d(0, 0, 0), Vec3d(0, 0, 1), {}, {} };
+    cube.meshes.push_back(mesh(cubeMesh, cubeTexture, one, Vec3d(0.6f, 0.8f, 0.f), Vec3d(0.f, 0.f, 4.f)));
+    cases.push_back(cube);
+
+    SceneCase flat = cube;
+    flat.name = "cube flat";
+    flat.golden = "cube_flat.png";
+    flat.mode = RENDER_MODE::TRIANGLES;
+    cases.push_back(flat);
+
+    // the camera where the Window starts orbiting
+    float angle = scene.camera.orbitAngle * PI / 180.f;
+    Vec3d eye(scene.camera.target.x + scene.camera.orbitDistance * std::cos(angle), scene.camera.position.y,
+              scene.camera.target.z + scene.camera.orbitDistance * std::sin(angle));
+
+    SceneCase runway = { "runway", "runway.png", RENDER_MODE::TEXTURED, eye, scene.camera.target, {}, scene.lights };
+    for (unsigned int m = 0; m < scene.meshes.size(); ++m)
+        if (sceneMeshes[m] && sceneMeshes[m]->ready() && sceneTextures[m]->ready())
+            runway.meshes.push_back(mesh(sceneMeshes[m], sceneTextures[m], scene.meshes[m].scale, scene.meshes[m].rotation,
+                                         scene.meshes[m].translation));
+    cases.push_back(runway);
+
+    // the visibility buffer must produce the same image of the forward renderer
+    SceneCase deferred = runway;
+    deferred.name = "runway deferred";
+    deferred.mode = RENDER_MODE::TEXTURED_DEFERRED;
+    cases.push_back(deferred);
+
+    // the compact depth formats must resolve the same surfaces as the float one
+    SceneCase unorm16 = runway;
+    unorm16.name = "runway unorm16";
+    unorm16.depthFormat = DEPTH_FORMAT::DEPTH_UNORM16;
+    cases.push_back(unorm16);
+
+    SceneCase reversed = runway;
+    reversed.name = "runway reversed-z";
+    reversed.depthFormat = DEPTH_FORMAT::DEPTH_REVERSED_FLOAT;
+    cases.push_back(reversed);
+
+    // the cube crosses the near plane (z = 1)
+    SceneCase clipNear = { "clip near", "clip_near.png", RENDER_MODE::TEXTURED, Vec3d(0, 0, 0), Vec3d(0, 0, 1), {}, {} };
+    clipNear.meshes.push_back(mesh(cubeMesh, cubeTexture, one, Vec3d(0.6f, 0.8f, 0.f), Vec3d(0.3f, 0.f, 2.1f)));
+    cases.push_back(clipNear);
+
+    // one cube across each border of the screen
+    SceneCase clipBorders = { "clip borders", "clip_borders.png", RENDER_MODE::TRIANGLES_WIREFRAME, Vec3d(0, 0, 0), Vec3d(0, 0, 1), {}, {} };
+    Vec3d borders[4] = { Vec3d(-3.1f, 0.f, 4.f), Vec3d(3.1f, 0.f, 4.f), Vec3d(0.f, -2.3f, 4.f), Vec3d(0.f, 2.3f, 4.f) };
+    for (int b = 0; b < 4; ++b)
+        clipBorders.meshes.push_back(mesh(cubeMesh, cubeTexture, Vec3d(0.6f, 0.6f, 0.6f), Vec3d(0.5f, 0.5f * b, 0.f), borders[b]));
+    cases.push_back(clipBorders);
+
+    /* render, compare and time each scene */
+
+    std::map<std::string, double> budgets = loadBudgets(budgetsFile);
+    std::map<std::string, double> measured;
+    std::set<std::string> written;
+
+    if (update)
+        QDir().mkpath(QString::fromStdString(goldenDir));
+
+    for (unsigned int c = 0; c < cases.size(); ++c)
+    {
+        SceneCase& sc = cases[c];
+        DEPTH_BUFFER_FORMAT = sc.depthFormat;
+
+        Renderer renderer;
+        renderer.display().setSize(GOLDEN_WIDTH, GOLDEN_HEIGHT);
+        renderer.display().setup();
+        renderer.setProjection(scene.camera.fovY * PI / 180.f, GOLDEN_WIDTH / (float)GOLDEN_HEIGHT, scene.camera.zNear, scene.camera.zFar);
+        if (!sc.lights.empty())
+            renderer.setLights(sc.lights);
+
+        Mat4 viewMatrix = Mat4::lookAt(sc.eye, sc.target, Vec3d(0.f, 1.f, 0.f));
+        auto frame = [&]()
+        {
+            renderer.processGeometry(sc.meshes, sc.eye, viewMatrix);
+            renderer.render(sc.mode);
+            renderer.display().resolveClears();
+        };
+
+        frame();
+
+        Display& gfx = renderer.display();
+        QImage image = QImage((const uchar*)gfx.colorBuffer(), gfx.width(), gfx.height(), gfx.stride() * sizeof(uint32_t),
+                              QImage::Format_ARGB32).copy();
+
+        double best = 0.0;
+        for (int run = 0; run < 3; ++run)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (int f = 0; f < PERF_FRAMES; ++f)
+                frame();
+            std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+            double ms = elapsed.count() / PERF_FRAMES;
+            best = (run == 0) ? ms : std::min(best, ms);
+        }
+
+        std::string key = sc.name;
+        std::replace(key.begin(), key.end(), ' ', '_');
+        measured[key] = best;
+
+        std::ostringstream time;
+        time << std::fixed << std::setprecision(3) << best << " ms";
+
+        // the frames above warmed the scene up: from now on a frame must not allocate
+        uint64_t allocations = AllocationTracker::allocations();
+        for (int f = 0; f < ALLOCATION_FRAMES; ++f)
+            frame();
+        allocations = AllocationTracker::allocations() - allocations;
+
+        if (update)
+        {
+            // a golden image shared by several scenes is written by the first one
+            bool saved = written.count(sc.golden) || image.save(QString::fromStdString(path(goldenDir, sc.golden)));
+            written.insert(sc.golden);
+            results.push_back({ sc.name, saved, "golden " + sc.golden + ", " + time.str() });
+            continue;
+        }
+
+        /* image */
+
+        QImage golden = QImage(QString::fromStdString(path(goldenDir, sc.golden))).convertToFormat(QImage::Format_ARGB32);
+        if (golden.isNull() || golden.width() != image.width() || golden.height() != image.height())
+        {
+            results.push_back({ sc.name, false, "golden " + sc.golden + " missing or of a different size (run --check --update)" });
+            continue;
+        }
+
+        QImage diff;
+        int different = _compare(image, golden, diff);
+        float fraction = different / (float)(image.width() * image.height());
+        bool passed = fraction <= MAX_DIFF_PIXELS;
+
+        std::ostringstream details;
+        details << different << " pixels differ (" << std::setprecision(2) << fraction * 100.f << "%), " << time.str();
+
+        if (!passed)
+        {
+            std::string actual = path(QDir::tempPath().toStdString(), key + "_actual.png");
+            std::string marked = path(QDir::tempPath().toStdString(), key + "_diff.png");
+            image.save(QString::fromStdString(actual));
+            diff.save(QString::fromStdString(marked));
+            details << ", see " << actual << " and " << marked;
+        }
+
+        /* performance */
+
+        std::map<std::string, double>::iterator budget = budgets.find(key);
+        if (budget == budgets.end())
+            details << ", no budget";
+        else
+        {
+            double limit = budget->second * (1.0 + perfTolerance / 100.0);
+            details << " (budget " << std::fixed << std::setprecision(3) << budget->second << " ms +" << std::setprecision(0) << perfTolerance << "%)";
+
+            if (best > limit)
+            {
+                passed = false;
+                details << " TOO SLOW";
+            }
+        }
+
+        /* heap allocations */
+
+        if (AllocationTracker::enabled() && allocations)
+        {
+            passed = false;
+            details << ", " << allocations << " heap allocations in " << ALLOCATION_FRAMES << " frames";
+        }
+
+        results.push_back({ sc.name, passed, details.str() });
+    }
+
+    DEPTH_BUFFER_FORMAT = DEPTH_FORMAT::DEPTH_FLOAT;
+
+    _steadyState(results, runway, scene.camera);
+
+    if (update)
+    {
+        std::ofstream file(budgetsFile);
+        for (std::map<std::string, double>::iterator it = measured.begin(); it != measured.end(); ++it)
+            file << it->first << " " << std::fixed << std::setprecision(3) << it->second << "\n";
+    }
+}
+
+/* _steadyState: the runway scene with every optional stage of the frame turned on (shadows, Gouraud shading, Z-prepass,
+ * the post-processing filters, the profiler and 4 threads). After a few frames to warm it up, the frame loop must not
+ * allocate anything on the heap: the per-frame buffers have to be kept and reused.
+ */
+void Regression::_steadyState(std::vector<Result>& results, const SceneCase& sc, const SceneCamera& camera)
+{
+    if (!AllocationTracker::enabled())
+    {
+        results.push_back({ "steady state allocs", true, "skipped (built without TRACK_ALLOCATIONS)" });
+        return;
+    }
+
+    const float PI = 3.14159265358979323846f;
+    bool shadows = ENABLE_SHADOWS, gouraud = GOURAUD_SHADING, prepass = ENABLE_Z_PREPASS;
+    bool fog = ENABLE_FOG, tonemap = ENABLE_TONEMAP, fxaa = ENABLE_FXAA;
+    ENABLE_SHADOWS = GOURAUD_SHADING = ENABLE_Z_PREPASS = ENABLE_FOG = ENABLE_TONEMAP = ENABLE_FXAA = true;
+
+    JobSystem jobSystem;
+    jobSystem.setThreadCount(4);
+    Renderer renderer(&jobSystem);
+    renderer.display().setSize(GOLDEN_WIDTH, GOLDEN_HEIGHT);
+    renderer.display().setup();
+    renderer.setProjection(camera.fovY * PI / 180.f, GOLDEN_WIDTH / (float)GOLDEN_HEIGHT, camera.zNear, camera.zFar);
+    renderer.setLights(sc.lights);
+
+    std::vector<Mesh> meshes = sc.meshes;
+    Mat4 viewMatrix = Mat4::lookAt(sc.eye, sc.target, Vec3d(0.f, 1.f, 0.f));
+
+    // the first mesh keeps turning: the shadow map is rendered again on every frame
+    auto frame = [&](const int& f)
+    {
+        meshes[0].rotation.y = 0.01f * f;
+        renderer.processGeometry(meshes, sc.eye, viewMatrix);
+        renderer.render(RENDER_MODE::TEXTURED);
+        renderer.display().resolveClears();
+        renderer.profiler().frameDone();
+    };
+
+    for (int f = 0; f < ALLOCATION_FRAMES; ++f)
+        frame(f);
+    renderer.profiler().reset();
+
+    uint64_t allocations = AllocationTracker::allocations(), bytes = AllocationTracker::bytes();
+    for (int f = 0; f < ALLOCATION_FRAMES; ++f)
+        frame(ALLOCATION_FRAMES + f);
+    allocations = AllocationTracker::allocations() - allocations;
+    bytes = AllocationTracker::bytes() - bytes;
+
+    std::ostringstream details;
+    details << allocations << " heap allocations (" << bytes << " bytes) in " << ALLOCATION_FRAMES << " frames";
+    if (allocations)
+        details << ": " << renderer.profiler().report();
+
+    results.push_back({ "steady state allocs", allocations == 0, details.str() });
+
+    ENABLE_SHADOWS = shadows;
+    GOURAUD_SHADING = gouraud;
+    ENABLE_Z_PREPASS = prepass;
+    ENABLE_FOG = fog;
+    ENABLE_TONEMAP = tonemap;
+    ENABLE_FXAA = fxaa;
+}
+
+int Regression::_compare(const QImage& image, const QImage& golden, QImage& diff)
+{
+    diff = QImage(image.width(), image.height(), QImage::Format_ARGB32);
+    int different = 0;
+
+    for (int y = 0; y < image.height(); ++y)
+    {
+        const uint32_t* a = reinterpret_cast<const uint32_t*>(image.constScanLine(y));
+        const uint32_t* b = reinterpret_cast<const uint32_t*>(golden.constScanLine(y));
+        uint32_t* d = reinterpret_cast<uint32_t*>(diff.scanLine(y));
+
+        for (int x = 0; x < image.width(); ++x)
+        {
+            int delta = 0;
+            for (int shift = 0; shift < 24; shift += 8)
+                delta = std::max(delta, std::abs((int)((a[x] >> shift) & 0xFF) - (int)((b[x] >> shift) & 0xFF)));
+
+            // the different pixels in red over a darker copy of the golden image
+            if (delta > PIXEL_TOLERANCE)
+            {
+                d[x] = 0xFFFF0000;
+                different++;
+            }
+            else
+                d[x] = 0xFF000000 | ((b[x] >> 2) & 0x3F3F3F);
+        }
+    }
+
+    return different;
+}
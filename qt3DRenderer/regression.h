@@ -0,0 +1,61 @@
+#pragma once
+#include <string>
+#include <vector>
+
+#include <QImage>
+
+#include "renderer.h"
+#include "scene.h"
+
+struct SceneCase;
+
+
+/* Regression: headless checks that every optimization of the rasterizer can be validated against, without opening
+ * a window. A few canonical scenes (a textured and a flat shaded cube, the runway scene, faces crossing the near plane
+ * and the borders of the screen) are rendered to the Display and compared to the golden images checked in under
+ * assets/golden, and the average frame time of each scene must stay within a budget. A handful of direct checks of
+ * Mat4, Polygon::clip(), OBJLoader and the precision of the depth formats run first. When the program is built with
+ * TRACK_ALLOCATIONS (see AllocationTracker), the warmed up frames of every scene must not allocate on the heap.
+ *
+ * Usage: qt3DRenderer --check [--assets dir] [--perf-tolerance percent] [--update]
+ *
+ * --update renders the scenes and writes their golden images and the frame time budgets of this machine instead of
+ * checking them (the budgets depend on the CPU: regenerate them on the machine the checks run on).
+ * The exit code is the number of failed checks.
+ */
+class Regression
+{
+public:
+    // run: execute the checks and return the exit code of the application
+    static int run(const std::vector<std::string>& args, const std::string& assetsDir);
+
+private:
+    // Result: outcome of a single check, printed as one line of the report
+    struct Result
+    {
+        std::string name;
+        bool passed;
+        std::string details;
+    };
+
+    // _math: Mat4 products against the identity and a transform applied to a point
+    static void _math(std::vector<Result>& results);
+
+    // _clipping: Polygon::clip() of triangles inside, outside and across the near plane
+    static void _clipping(std::vector<Result>& results);
+
+    // _objLoader: vertices, faces, UVs and normals read from cube.obj
+    static void _objLoader(std::vector<Result>& results, const std::string& assetsDir);
+
+    // _depthPrecision: the farthest distance where each depth format still separates two nearly coplanar quads
+    static void _depthPrecision(std::vector<Result>& results);
+
+    // _scenes: renders the canonical scenes and compares them to the golden images and to the time budgets
+    static void _scenes(std::vector<Result>& results, const std::string& assetsDir, const bool& update, const float& perfTolerance);
+
+    // _steadyState: no heap allocations once the frame loop is warmed up, with every optional stage of the frame on
+    static void _steadyState(std::vector<Result>& results, const SceneCase& sc, const SceneCamera& camera);
+
+    // _compare: pixels whose channels differ by more than PIXEL_TOLERANCE; the diff image marks them in red
+    static int _compare(const QImage& image, const QImage& golden, QImage& diff);
+};
@@ -0,0 +1,1039 @@
+#include "renderer.h"
+#include "meshoptimizer.h"
+#include "vec4d.h"
+
+#include <QDebug>
+#include <cmath>
+#include <limits>
+
+#define WIREFRAME_COLOR 0xFFFFFFFF
+
+#define DAMAGE_MARGIN 8             // pixels added around the screen bounds of a triangle: wireframe dots, rounding of the scanlines
+#define GEOMETRY_CHUNK_SIZE 256     // faces processed by a single job of the geometry stage
+
+
+// global flags
+bool ENABLE_FACE_CULL       = true;
+bool OBJECT_SPACE_CULL      = true;
+bool FIX_TEXTURE_DISTORTION = true;
+bool ENABLE_Z_PREPASS       = false;
+bool ENABLE_LOD             = true;
+bool GOURAUD_SHADING        = false;
+DEPTH_FORMAT DEPTH_BUFFER_FORMAT = DEPTH_FORMAT::DEPTH_FLOAT;
+bool ENABLE_SHADOWS         = false;
+bool CACHE_SHADOW_MAP       = true;
+bool ENABLE_FOG             = false;
+bool ENABLE_TONEMAP         = false;
+bool ENABLE_FXAA            = false;
+
+
+Renderer::Renderer(JobSystem* jobSystem)
+{
+    _jobSystem = (jobSystem) ? jobSystem : &_ownJobSystem;
+    if (!jobSystem)
+        _ownJobSystem.setThreadCount(0);
+
+    _screenWidth = _screenHeight = 0;
+    _processedFaces = _culledFaces = _fullDetailFaces = 0;
+    _fetchedVertices = _cachedVertices = 0;
+    _fovY = 0.f;
+    _sharedShadowMap = nullptr;
+    _shadows = false;
+
+    // initialize light source: in LHCS, Z grows positive towards inside the monitor (i.e. away from the camera)
+    Light light(LIGHT_TYPE::DIRECTIONAL, Vec3d(0, 0, 1));
+    light.cameraSpace = true;
+    _lights.push_back(light);
+}
+
+void Renderer::setProjection(const float& fovY, const float& aspect, const float& zNear, const float& zFar)
+{
+    float fovX = std::atan(std::tan(fovY / 2.f) * aspect) * 2;
+    _projMatrix = Mat4::perspective(fovY, 1.f / aspect, zNear, zFar);
+    _fovY = fovY;
+
+    // the compact depth formats store the depth relative to the near plane
+    _gfx.setNearPlane(zNear);
+
+    // the fog covers the second half of the view distance
+    _postProcess.setFog(zFar / 2.f, zFar, 0xFF000000);
+
+    /* initialize frustum planes for Clipping operation */
+
+    _initFrustumPlanes(fovX, fovY, zNear, zFar);
+}
+
+void Renderer::setThreadCount(const int& threads)
+{
+    _jobSystem->setThreadCount(threads);
+}
+
+int Renderer::threadCount()
+{
+    return _jobSystem->threadCount();
+}
+
+JobSystem& Renderer::jobSystem()
+{
+    return *_jobSystem;
+}
+
+void Renderer::setLights(const std::vector<Light>& lights)
+{
+    _lights = lights;
+}
+
+std::vector<Light>& Renderer::lights()
+{
+    return _lights;
+}
+
+Display& Renderer::display()
+{
+    return _gfx;
+}
+
+Profiler& Renderer::profiler()
+{
+    return _profiler;
+}
+
+ShadowMap& Renderer::shadowMap()
+{
+    return _shadowMap;
+}
+
+const Light* Renderer::shadowLight()
+{
+    if (!ENABLE_SHADOWS)
+        return nullptr;
+
+    for (unsigned int l = 0; l < _lights.size(); ++l)
+        if (_lights[l].type == LIGHT_TYPE::DIRECTIONAL && _lights[l].castShadows)
+            return &_lights[l];
+
+    return nullptr;
+}
+
+void Renderer::setSharedShadowMap(ShadowMap* shadowMap)
+{
+    _sharedShadowMap = shadowMap;
+}
+
+PostProcess& Renderer::postProcess()
+{
+    return _postProcess;
+}
+
+const std::vector<Triangle>& Renderer::triangles()
+{
+    return _triangles;
+}
+
+const std::vector<QRect>& Renderer::meshBounds()
+{
+    return _meshBounds;
+}
+
+uint64_t Renderer::processedFaces()
+{
+    return _processedFaces;
+}
+
+uint64_t Renderer::fullDetailFaces()
+{
+    return _fullDetailFaces;
+}
+
+float Renderer::vertexCacheHitRate()
+{
+    return (_fetchedVertices) ? _cachedVertices / (float)_fetchedVertices : 0.f;
+}
+
+uint64_t Renderer::culledFaces()
+{
+    return _culledFaces;
+}
+
+void Renderer::resetStats()
+{
+    _processedFaces = _culledFaces = _fullDetailFaces = 0;
+    _fetchedVertices = _cachedVertices = 0;
+}
+
+// screenBounds: the rectangle of the screen covered by a projected triangle (+ DAMAGE_MARGIN)
+QRect Renderer::screenBounds(const Triangle& t)
+{
+    float minX = std::min(t.points[0].x, std::min(t.points[1].x, t.points[2].x));
+    float minY = std::min(t.points[0].y, std::min(t.points[1].y, t.points[2].y));
+    float maxX = std::max(t.points[0].x, std::max(t.points[1].x, t.points[2].x));
+    float maxY = std::max(t.points[0].y, std::max(t.points[1].y, t.points[2].y));
+
+    int x1 = (int)std::floor(minX) - DAMAGE_MARGIN;
+    int y1 = (int)std::floor(minY) - DAMAGE_MARGIN;
+    int x2 = (int)std::ceil(maxX) + DAMAGE_MARGIN;
+    int y2 = (int)std::ceil(maxY) + DAMAGE_MARGIN;
+
+    return QRect(x1, y1, x2 - x1 + 1, y2 - y1 + 1);
+}
+
+/* processGeometry: the faces of all the meshes are split in jobs of GEOMETRY_CHUNK_SIZE faces that are run by the
+ * job system (big meshes are spread among all the threads, small ones are packed together).
+ * Each job writes to its own buffer of triangles and the buffers are appended in the order of the jobs,
+ * so the triangles end up in the same order of a serial run.
+ */
+void Renderer::processGeometry(std::vector<Mesh>& meshes, const Vec3d& cameraPosition, const Mat4& viewMatrix)
+{
+    _meshPointers.resize(meshes.size());
+    for (unsigned int m = 0; m < meshes.size(); ++m)
+        _meshPointers[m] = &meshes[m];
+
+    processGeometry(_meshPointers, cameraPosition, viewMatrix);
+}
+
+void Renderer::processGeometry(const std::vector<Mesh*>& meshes, const Vec3d& cameraPosition, const Mat4& viewMatrix,
+                               const std::vector<WorldTransform>* transforms)
+{
+    _updateShadowMap(meshes, viewMatrix);
+
+    _profiler.begin("geometry");
+
+    setView(cameraPosition, viewMatrix);
+    _lighting.setLights(_lights, _viewMatrix);
+
+    // serial part: per mesh setup and the list of jobs
+    _meshSetups.resize(meshes.size());
+    unsigned int numJobs = 0;
+
+    for (unsigned int m = 0; m < meshes.size(); ++m)
+    {
+        _setupMesh(meshes[m], (transforms) ? &(*transforms)[m] : nullptr, _meshSetups[m]);
+        if (!_meshSetups[m].visible)
+            continue;
+
+        const Mesh& geometry = *_meshSetups[m].geometry;
+        _processedFaces += geometry.faces.size();
+        _fullDetailFaces += meshes[m]->geometry()->faces.size();
+
+        for (unsigned int first = 0; first < geometry.faces.size(); first += GEOMETRY_CHUNK_SIZE)
+        {
+            if (numJobs == _jobs.size())
+                _jobs.push_back(GeometryJob());
+
+            GeometryJob& job = _jobs[numJobs++];
+            job.mesh = m;
+            job.first = first;
+            job.last = std::min(first + GEOMETRY_CHUNK_SIZE, (unsigned int)geometry.faces.size());
+            job.triangles.clear();
+            job.lighting.clear();
+            job.samples.clear();
+            job.culledFaces = 0;
+            job.fetchedVertices = job.cachedVertices = 0;
+        }
+    }
+
+    // parallel part: the workers of the job system (this thread included) process the jobs, stealing from each other
+    _jobSystem->parallelFor(numJobs, 1, [this](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int j = begin; j < end; ++j)
+        {
+            GeometryJob& job = _jobs[j];
+            const MeshSetup& setup = _meshSetups[job.mesh];
+            _processGraphicsPipeline(*setup.geometry, setup, job);
+        }
+    });
+
+    // merge the triangles of the jobs in order and find the screen area covered by each mesh (used by damage tracking)
+    _triangles.clear();
+    _meshBounds.assign(meshes.size(), QRect());
+
+    for (unsigned int j = 0; j < numJobs; ++j)
+    {
+        const GeometryJob& job = _jobs[j];
+        _culledFaces += job.culledFaces;
+        _fetchedVertices += job.fetchedVertices;
+        _cachedVertices += job.cachedVertices;
+
+        for (unsigned int i = 0; i < job.triangles.size(); ++i)
+            _meshBounds[job.mesh] = _meshBounds[job.mesh].united(screenBounds(job.triangles[i]));
+
+        _triangles.insert(_triangles.end(), job.triangles.begin(), job.triangles.end());
+    }
+
+    _profiler.end("geometry");
+}
+
+/* _updateShadowMap: the depth of the meshes seen from the shadowLight(). The map is only rendered again when that
+ * light or a mesh moved (unless CACHE_SHADOW_MAP is off), and never when it's shared: its owner renders it
+ */
+void Renderer::_updateShadowMap(const std::vector<Mesh*>& meshes, const Mat4& viewMatrix)
+{
+    const Light* light = shadowLight();
+    _shadows = (light != nullptr);
+    if (!light || _sharedShadowMap)
+        return;
+
+    // a light that moves with the camera goes back to World Space through the transposed rotation of the view
+    Vec3d direction = light->direction;
+    if (light->cameraSpace)
+        direction = Vec3d(viewMatrix.m[0][0] * light->direction.x + viewMatrix.m[1][0] * light->direction.y + viewMatrix.m[2][0] * light->direction.z,
+                          viewMatrix.m[0][1] * light->direction.x + viewMatrix.m[1][1] * light->direction.y + viewMatrix.m[2][1] * light->direction.z,
+                          viewMatrix.m[0][2] * light->direction.x + viewMatrix.m[1][2] * light->direction.y + viewMatrix.m[2][2] * light->direction.z);
+
+    _profiler.begin("shadowmap");
+    _shadowMap.update(meshes, direction, CACHE_SHADOW_MAP);
+    _profiler.end("shadowmap");
+}
+
+/* _setupMesh: everything that is computed once per mesh and per frame, before its faces are split among the threads */
+void Renderer::_setupMesh(Mesh* mesh, const WorldTransform* transform, MeshSetup& setup)
+{
+    setup.worldMatrix = (transform) ? transform->worldMatrix : worldMatrix(mesh->scale, mesh->rotation, mesh->translation);
+    setup.concatenated = (transform != nullptr);
+    setup.visible = !transform || sphereVisible(transform->boundsCenter, transform->boundsRadius);
+    if (!setup.visible)
+        return;
+
+    if (setup.concatenated)
+        setup.worldViewMatrix = _viewMatrix * setup.worldMatrix;
+
+    /* Object-space backface culling: instead of transforming the 3 vertices of every face to Camera Space to find out
+     * if it's looking away from the camera, the camera is brought to the Model Space of the mesh once per frame:
+     *      inverse([T] * [R] * [S]) = [S]^-1 * [Rz]^-1 * [Ry]^-1 * [Rx]^-1 * [T]^-1
+     * and each face is tested against its precomputed plane. Culled faces are never transformed.
+     * A negative scale mirrors the mesh and flips the winding of its faces, so the test must be flipped as well.
+     */
+    const Mesh* shape = mesh->geometry();
+    int lod = _selectLod(shape, mesh->scale, setup);
+    setup.mesh = mesh;
+    setup.geometry = (lod == 0) ? shape : &shape->lods[lod - 1];
+
+    /* Gouraud shading: the vertex normals of the .obj (the LODs use the normals of the mesh) are taken to Camera Space
+     * by the inverse transpose of the World-View matrix. Without the translation that's [V] * [R] * [S]^-1, so that
+     * a non-uniform scale doesn't bend the normals towards the stretched axis.
+     */
+    setup.normals = (GOURAUD_SHADING && !shape->normals.empty()) ? &shape->normals : nullptr;
+    if (setup.normals)
+    {
+        Vec3d inverseScale((mesh->scale.x != 0.f) ? 1.f / mesh->scale.x : 0.f,
+                           (mesh->scale.y != 0.f) ? 1.f / mesh->scale.y : 0.f,
+                           (mesh->scale.z != 0.f) ? 1.f / mesh->scale.z : 0.f);
+        setup.normalMatrix = _viewMatrix * worldMatrix(inverseScale, mesh->rotation, Vec3d(0.f, 0.f, 0.f));
+    }
+
+    setup.objectSpaceCull = ENABLE_FACE_CULL && OBJECT_SPACE_CULL;
+    setup.scaleDet = mesh->scale.x * mesh->scale.y * mesh->scale.z;
+
+    // the planes of a mesh are computed the first time they are needed (the assets come with them already computed, the
+    // views that share a transform run in parallel and find them computed by MultiViewRenderer)
+    if (setup.objectSpaceCull && setup.geometry->faceNormals.size() != setup.geometry->faces.size() && !mesh->asset && !transform)
+        ((lod == 0) ? mesh : &mesh->lods[lod - 1])->computeFacePlanes();
+
+    if (setup.objectSpaceCull && setup.scaleDet != 0.f && setup.geometry->faceNormals.size() == setup.geometry->faces.size())
+    {
+        Mat4 invWorldMatrix;
+        if (transform)
+            invWorldMatrix = transform->invWorldMatrix;
+        else
+        {
+            invWorldMatrix = Mat4::translate(-mesh->translation.x, -mesh->translation.y, -mesh->translation.z);
+            invWorldMatrix = Mat4::rotateX(-mesh->rotation.x) * invWorldMatrix;
+            invWorldMatrix = Mat4::rotateY(-mesh->rotation.y) * invWorldMatrix;
+            invWorldMatrix = Mat4::rotateZ(-mesh->rotation.z) * invWorldMatrix;
+            invWorldMatrix = Mat4::scale(1.f / mesh->scale.x, 1.f / mesh->scale.y, 1.f / mesh->scale.z) * invWorldMatrix;
+        }
+
+        setup.cameraModelSpace = Vec4d::toVec3d(Vec3d::toVec4d(_cameraPosition) * invWorldMatrix);
+    }
+    else
+    {
+        // a mesh flattened by a zero scale has no valid inverse (and an asset may have no planes): fall back to the test
+        // in Camera Space
+        setup.objectSpaceCull = false;
+    }
+}
+
+void Renderer::setView(const Vec3d& cameraPosition, const Mat4& viewMatrix)
+{
+    _viewMatrix = viewMatrix;
+    _cameraPosition = cameraPosition;
+    _screenWidth = _gfx.width();
+    _screenHeight = _gfx.height();
+}
+
+bool Renderer::sphereVisible(const Vec3d& center, const float& radius)
+{
+    // the frustum planes are in Camera Space and their normals point inside
+    Vec3d centerCamera = Vec4d::toVec3d(Vec3d::toVec4d(center) * _viewMatrix);
+
+    for (int p = 0; p < 6; ++p)
+    {
+        Vec3d normal = _frustumPlanes[p].normal;
+        if (normal.dot(centerCamera - _frustumPlanes[p].point) < -radius)
+            return false;
+    }
+
+    return true;
+}
+
+float Renderer::pixelsPerUnit(const Vec3d& center, const float& radius)
+{
+    Vec3d toCenter = Vec3d(center) - _cameraPosition;
+    float distance = toCenter.mag() - radius;
+    if (distance <= 0.f || _fovY <= 0.f)
+        return -1.f;
+
+    return (_screenHeight / 2.f) / (std::tan(_fovY / 2.f) * distance);
+}
+
+Mat4 Renderer::worldMatrix(const Vec3d& scale, const Vec3d& rotation, const Vec3d& translation)
+{
+    // create a scale matrix that will be used to multiply the mesh vertices
+    Mat4 scaleMatrix = Mat4::scale(scale.x, scale.y, scale.z);
+
+    // create a translation matrix that will be used to multiply the mesh vertices
+    Mat4 translationMatrix = Mat4::translate(translation.x, translation.y, translation.z);
+
+    // create a translation matrix that will be used to multiply the mesh vertices
+    Mat4 rotationMatrixX = Mat4::rotateX(rotation.x);
+    Mat4 rotationMatrixY = Mat4::rotateY(rotation.y);
+    Mat4 rotationMatrixZ = Mat4::rotateZ(rotation.z);
+
+    /* To transform the vertices to World Space, the order of the linear transforms matter:
+     *  1. Scale
+     *  2. Rotate                   [T] * [R] * [S] * v
+     *  3. Translate
+     */
+
+    // Create the World Matrix combining Scale, Rotation and Translation matrices
+    Mat4 world = Mat4::eye();
+    world = scaleMatrix * world;
+    world = rotationMatrixZ * world;
+    world = rotationMatrixY * world;
+    world = rotationMatrixX * world;
+    world = translationMatrix * world;
+
+    return world;
+}
+
+/* worldTransform: the inverse is built from the inverse of each transform in the reverse order:
+ *      inverse([T] * [R] * [S]) = [S]^-1 * [Rz]^-1 * [Ry]^-1 * [Rx]^-1 * [T]^-1
+ */
+void Renderer::worldTransform(const Mesh* mesh, WorldTransform& transform)
+{
+    transform.worldMatrix = worldMatrix(mesh->scale, mesh->rotation, mesh->translation);
+
+    transform.invertible = mesh->scale.x != 0.f && mesh->scale.y != 0.f && mesh->scale.z != 0.f;
+    if (transform.invertible)
+    {
+        transform.invWorldMatrix = Mat4::translate(-mesh->translation.x, -mesh->translation.y, -mesh->translation.z);
+        transform.invWorldMatrix = Mat4::rotateX(-mesh->rotation.x) * transform.invWorldMatrix;
+        transform.invWorldMatrix = Mat4::rotateY(-mesh->rotation.y) * transform.invWorldMatrix;
+        transform.invWorldMatrix = Mat4::rotateZ(-mesh->rotation.z) * transform.invWorldMatrix;
+        transform.invWorldMatrix = Mat4::scale(1.f / mesh->scale.x, 1.f / mesh->scale.y, 1.f / mesh->scale.z) * transform.invWorldMatrix;
+    }
+
+    // the LODs are simplified versions of the mesh: its sphere bounds them too
+    const Mesh* geometry = mesh->geometry();
+    float maxScale = std::max(std::fabs(mesh->scale.x), std::max(std::fabs(mesh->scale.y), std::fabs(mesh->scale.z)));
+
+    transform.boundsCenter = Vec4d::toVec3d(Vec3d::toVec4d(geometry->boundsCenter) * transform.worldMatrix);
+    transform.boundsRadius = geometry->boundsRadius * maxScale;
+
+    // bounds never computed: the mesh can't be culled
+    if (geometry->boundsRadius == 0.f && !geometry->vertices.empty())
+        transform.boundsRadius = std::numeric_limits<float>::max();
+}
+
+/* _selectLod: the coarsest LOD of the mesh whose simplification error, projected on the screen at the distance of the
+ * nearest point of the bounding sphere, is still smaller than LOD_PIXEL_ERROR. A mesh that gets closer to the camera
+ * covers more pixels and goes back to the finer levels. The error is the RMS quadric distance of the simplifier (see
+ * Mesh::lodErrors): the threshold is a heuristic, not a guaranteed screen-space error.
+ */
+int Renderer::_selectLod(const Mesh* geometry, const Vec3d& scale, const MeshSetup& setup)
+{
+    if (!ENABLE_LOD || geometry->lods.empty() || _fovY <= 0.f)
+        return 0;
+
+    Vec3d center = Vec4d::toVec3d(Vec3d::toVec4d(geometry->boundsCenter) * setup.worldMatrix);
+    float maxScale = std::max(std::fabs(scale.x), std::max(std::fabs(scale.y), std::fabs(scale.z)));
+
+    // pixels covered by 1 unit of World Space at the nearest point of the mesh
+    float pixels = pixelsPerUnit(center, geometry->boundsRadius * maxScale);
+    if (pixels < 0.f)
+        return 0;
+
+    int lod = 0;
+    while (lod < (int)geometry->lods.size() && geometry->lodErrors[lod] * maxScale * pixels <= LOD_PIXEL_ERROR)
+        ++lod;
+
+    return lod;
+}
+
+/* _processGraphicsPipeline: passes a range of faces of a mesh through each state of the Graphics Pipeline:
+ *
+ * Current stages of the Graphics Pipeline:
+ *  + Model Space: a 3D Mesh (vertices) starts in the Model Space (in its own original local coordinate system: Blender, Maya, ...)
+ *
+ *  + World Space: vertices from the previous stage are multiplied by the World Matrix to be in the World Space (scale, translation, rotation)
+ *
+ *  + Camera Space: vertices from the previous stag are multiplied by the View Matrix to be in View/Camera Space
+ *    (the Eye becomes the new origin of the Camera and everything in the world is scaled/translated/rotated
+ *     so that we see things from the Camera Eye point of view)
+ *
+ * + Backface Culling: a Hidden Surface Removal technique is executed in Camera Space to discard the faces that are looking
+ *   away from the camera
+ *
+ * + Clipping: then Frustum Clipping is executed to get rid of the vertices that are not inside the 6 frustum planes
+ *
+ * + Projection: the surviving vertices are multiplied by the Perspective Projection Matrix
+ *
+ * + Image Space (NDC): finally, the projected vertices pass through Perspective Divide to be transformed into Screen Space
+ *   NDC: Normalized Device Coordinates:
+ *          +1
+ *      ---------
+ *   -1 |       | +1
+ *      |       |
+ *      ---------
+ *          -1
+ *
+ *   Note: as an alternative to clipping in Camera Space (Frustum Clipping), Homogeneous Clipping could be done in Image Space (NDC).
+ *
+ * + Screen Space: the verte is translated into the middle of the screen for rendering and things are ready to be rasterized
+ *   and have proper X,Y coordinates within the bounds of the monitor to be
+ */
+void Renderer::_processGraphicsPipeline(const Mesh& mesh, const MeshSetup& setup, GeometryJob& job)
+{
+    std::vector<Triangle>& triangles2render = job.triangles;
+    uint64_t& culledFaces = job.culledFaces;
+
+    /* Post-transform cache: the Camera Space position of the last vertices transformed, direct mapped by vertex index.
+     * Neighbor faces share most of their vertices, so when the faces are sorted by MeshOptimizer most of the vertices
+     * are transformed only once. The cache lives as long as the job, which never crosses meshes.
+     */
+    int cacheTags[VERTEX_CACHE_SIZE];
+    Vec4d cacheVertices[VERTEX_CACHE_SIZE];
+    std::fill(cacheTags, cacheTags + VERTEX_CACHE_SIZE, -1);
+
+    // the triangles left by clipping a face
+    Triangle triangles[MAX_POLYGON_TRIANGLES];
+
+    // loop through faces: for each face (triangle), use the vertex index on the face to get the corresponding vertices
+    for (unsigned int f = job.first; f < job.last; ++f)
+    {
+        // the face is looking away from the camera when the camera is behind its plane
+        if (setup.objectSpaceCull)
+        {
+            Vec3d normal = mesh.faceNormals[f];
+            float distance = normal.dot(setup.cameraModelSpace) - mesh.facePlaneOffsets[f];
+            if ((setup.scaleDet < 0.f) ? distance > 0.f : distance < 0.f)
+            {
+                culledFaces++;
+                continue;
+            }
+        }
+
+//        if (f != 4) // front face for cube.obj
+//            continue;
+
+        // for each triangle face, get the indexes of the 3 vertices that define it
+        Face face = mesh.faces[f];
+        int faceIndexes[3] = { face.a, face.b, face.c };
+
+//        printf("face #%d v1=%.1f %.1f %.1f \tv2=%.1f %.1f %.1f \tv3=%.1f %.1f %.1f\n", f,
+//                mesh.vertices[faceIndexes[0]].x, mesh.vertices[faceIndexes[0]].y, mesh.vertices[faceIndexes[0]].z,
+//                mesh.vertices[faceIndexes[1]].x, mesh.vertices[faceIndexes[1]].y, mesh.vertices[faceIndexes[1]].z,
+//                mesh.vertices[faceIndexes[2]].x, mesh.vertices[faceIndexes[2]].y, mesh.vertices[faceIndexes[2]].z);
+
+        // array to store the transformed vertices: A, B, C
+        Vec4d transformedVertices[3];
+
+        // loop through all the 3 vertices of the face and apply transformations
+        for (unsigned int v = 0; v < 3; ++v)
+        {
+            job.fetchedVertices++;
+
+            // transformed by a previous face
+            int slot = faceIndexes[v] & (VERTEX_CACHE_SIZE - 1);
+            if (cacheTags[slot] == faceIndexes[v])
+            {
+                transformedVertices[v] = cacheVertices[slot];
+                job.cachedVertices++;
+                continue;
+            }
+
+            Vec4d transformedVertex = Vec3d::toVec4d(mesh.vertices[faceIndexes[v]]); // converts Vec3d to Vec4d
+
+            if (setup.concatenated)
+            {
+                // straight from Model Space to View/Camera Space with the product of both matrices
+                transformedVertex = transformedVertex * setup.worldViewMatrix;
+            }
+            else
+            {
+                // transform the vertex to World Space (the World Matrix is built once per mesh by _setupMesh())
+                transformedVertex = transformedVertex * setup.worldMatrix;
+
+                // convert the scene (vertices) from World Space to View/Camera Space
+                transformedVertex = transformedVertex * _viewMatrix;
+            }
+
+            // save each transformed vertex
+            transformedVertices[v] = transformedVertex;
+            cacheTags[slot] = faceIndexes[v];
+            cacheVertices[slot] = transformedVertex;
+        }
+
+        /* Check for Backface culling: do not draw back-faces
+         *
+         *          A
+         *        /   \
+         *      /      \
+         *    B - - - - C
+         *
+         *  1. Find vectors B-A and C-A
+         *  2. Take their cross product and find the perpendicular normal
+         *  3. Find the camera ray vector by subtracting the camera position from point A
+         *  4. Take the dot product between the normal N and the camera ray
+         *  5. If this dot product is less than zero, then DO NOT display the face
+         */
+
+        // calculate the Normal vector of the Face
+        Vec3d faceNormal = Vec4d::normal(transformedVertices[0], transformedVertices[1], transformedVertices[2]);
+
+        // check if this face is looking away from the camera and then abort its rendering
+        if (ENABLE_FACE_CULL && !setup.objectSpaceCull)
+        {
+            // 3. Find the camera ray vector by subtracting the camera position from point A
+            Vec3d origin;
+            Vec3d cameraRay = origin - Vec4d::toVec3d(transformedVertices[0]);
+
+            // 4. Take the dot product between the normal N and the camera ray
+            float dotNormalCamera = faceNormal.dot(cameraRay); // alignment
+
+            // 5. If this dot product is less than zero, then DO NOT display the face
+            if (dotNormalCamera < 0)
+            {
+                culledFaces++;
+                continue;
+            }
+        }
+
+        // Gouraud shading: the normals of the 3 vertices in Camera Space (faces without normals are flat shaded)
+        bool smooth = setup.normals && face.a_n >= 0;
+        Vec3d vertexNormals[3];
+        if (smooth)
+        {
+            int normalIndexes[3] = { face.a_n, face.b_n, face.c_n };
+            for (unsigned int v = 0; v < 3; ++v)
+            {
+                const Vec3d& normal = (*setup.normals)[normalIndexes[v]];
+                vertexNormals[v] = Vec4d::toVec3d(Vec4d(normal.x, normal.y, normal.z, 0.f) * setup.normalMatrix);
+            }
+        }
+
+        /* Check for Frustum Clipping: clip the face when part of it is outside the viewing frustum
+         *
+         * Make sure the face is inside the viewing Frustum and clip its mesh if necessary
+         * to avoid crashes. Clipping a polygon might result in even more vertices.
+         */
+
+        Polygon poly(Vec4d::toVec3d(transformedVertices[0]),
+                     Vec4d::toVec3d(transformedVertices[1]),
+                     Vec4d::toVec3d(transformedVertices[2]),
+                     face.a_uv,
+                     face.b_uv,
+                     face.c_uv);
+
+//        printf("polygon v1=%.1f %.1f %.1f \tv2=%.1f %.1f %.1f \tv3=%.1f %.1f %.1f\n",
+//                transformedVertices[0].x, transformedVertices[0].y, transformedVertices[0].z,
+//                transformedVertices[1].x, transformedVertices[1].y, transformedVertices[1].z,
+//                transformedVertices[2].x, transformedVertices[2].y, transformedVertices[2].z);
+
+        poly.clip(_frustumPlanes);
+
+        // after clipping, break the Polygon down into Triangles
+        int triangleCount = poly.triangles(triangles);
+        //std::cout << "triangleCount=" << triangleCount << std::endl;
+
+        /* Lighting samples: flat shading lights the whole face once at its center, Gouraud shading lights each vertex
+         * of the triangles left by clipping. Their normals are blended from the normals of the face with the barycentric
+         * coordinates of the vertex on the original face (the vertices added by clipping are not on a corner).
+         */
+        unsigned int flatSample = 0;
+        Vec3d edgeAB, edgeAC;
+        float dotABAB = 0.f, dotABAC = 0.f, dotACAC = 0.f, invDenominator = 0.f;
+
+        if (triangleCount)
+        {
+            Vec3d pointA = Vec4d::toVec3d(transformedVertices[0]);
+            Vec3d pointB = Vec4d::toVec3d(transformedVertices[1]);
+            Vec3d pointC = Vec4d::toVec3d(transformedVertices[2]);
+
+            if (smooth)
+            {
+                edgeAB = pointB - pointA;
+                edgeAC = pointC - pointA;
+                dotABAB = edgeAB.dot(edgeAB);
+                dotABAC = edgeAB.dot(edgeAC);
+                dotACAC = edgeAC.dot(edgeAC);
+                float denominator = dotABAB * dotACAC - dotABAC * dotABAC;
+                invDenominator = (denominator != 0.f) ? 1.f / denominator : 0.f;
+            }
+            else
+            {
+                Vec3d center = (pointA + pointB + pointC) * (1.f / 3.f);
+                flatSample = job.lighting.add(faceNormal, center, face.color);
+            }
+        }
+
+        /* Projection: project each of the 3D vertex of a Triangle into their 2D screen representation using Perspective Projection */
+
+        // loop all triangles after clipping
+        for (int t = 0; t < triangleCount; ++t)
+        {
+            Triangle& triangle = triangles[t];
+
+            Vec4d projectedPoints[3];
+
+            if (smooth)
+            {
+                job.samples.push_back(job.lighting.size());
+
+                for (unsigned int v = 0; v < 3; ++v)
+                {
+                    Vec3d point = Vec4d::toVec3d(triangle.points[v]);
+                    Vec3d toPoint = point - Vec4d::toVec3d(transformedVertices[0]);
+                    float dotPointAB = toPoint.dot(edgeAB), dotPointAC = toPoint.dot(edgeAC);
+
+                    float wB = (dotACAC * dotPointAB - dotABAC * dotPointAC) * invDenominator;
+                    float wC = (dotABAB * dotPointAC - dotABAC * dotPointAB) * invDenominator;
+                    float wA = 1.f - wB - wC;
+
+                    Vec3d normal = vertexNormals[0] * wA + vertexNormals[1] * wB + vertexNormals[2] * wC;
+                    normal.norm();
+                    job.lighting.add(normal, point, face.color);
+                }
+            }
+            else
+            {
+                job.samples.push_back(flatSample);
+            }
+
+            for (unsigned int v = 0; v < 3; ++v)
+            {
+                /* Projection stage */
+
+                // 1st step: multiply the projection matrix by the original 3D vertex. Converts from View/Camera Space to Screen Space
+                projectedPoints[v] = triangle.points[v] * _projMatrix;
+
+                // 2nd step: perspective divide with original Z-value now stored in W (things that are furthest away look smaller)
+                // the coordinates after perspective divide are called NDC (normalized device coordinates)
+                if (projectedPoints[v].w != 0.0)
+                {
+                    projectedPoints[v].x /= projectedPoints[v].w;
+                    projectedPoints[v].y /= projectedPoints[v].w;
+                    projectedPoints[v].z /= projectedPoints[v].w;
+                }
+
+                /* Things are now in Screen Space */
+
+                // flip vertically: the Y values from the OBJ file grow in the bottom-up direction, the higher you go,
+                // the more positive they are. However, the screen is draw top-bottom since origin (0,0) is on the top-left.
+                projectedPoints[v].y *= -1;
+
+                // scale into the view
+                projectedPoints[v].x *= _screenWidth / 2.f;
+                projectedPoints[v].y *= _screenHeight / 2.f;
+
+                // translate them to the center of the screen
+                projectedPoints[v].x += _screenWidth / 2.f;
+                projectedPoints[v].y += _screenHeight / 2.f;
+            }
+
+
+            // assemble a projected 4D triangle for a 2D screen: Triangle(Vec4d, Vec4d, Vec4d, color, depth);
+            // the color is replaced by the lit color once the samples of the job are shaded
+            Triangle projectedTriangle = { projectedPoints[0], projectedPoints[1], projectedPoints[2],
+                                           triangle.texCoords[0], triangle.texCoords[1], triangle.texCoords[2],
+                                           setup.mesh->texture, setup.mesh->textureWidth, setup.mesh->textureHeight,
+                                           face.color };
+            projectedTriangle.smooth = smooth;
+
+            // save the projected triangle in the array of triangles that need to be rendered
+            triangles2render.push_back(projectedTriangle);
+        }
+
+    } // mesh.faces.size()
+
+    /* Shading: a single pass over the samples of the whole job, all the lights at once (see Lighting). A face is
+     * brighter or darker depending on how aligned its normal is with the direction towards each light.
+     */
+    _lighting.shade(job.lighting, job.litColors);
+
+    for (unsigned int t = 0; t < triangles2render.size(); ++t)
+    {
+        Triangle& triangle = triangles2render[t];
+        const uint32_t* colors = &job.litColors[job.samples[t]];
+
+        triangle.color = colors[0];
+        if (triangle.smooth)
+            std::copy(colors, colors + 3, triangle.vertexColors);
+    }
+}
+
+void Renderer::render(const RENDER_MODE& renderMode, const QRect* damage)
+{
+
+    _profiler.begin("clear");
+
+    // clear the buffer with a solid color (with LAZY_CLEAR the tiles are only marked and cleared on demand)
+    _gfx.clearColorBuffer(0xFF000000); // black=0xFF000000, white=0xFFFFFFFF
+
+    // clear the depth buffer in the format selected (key X)
+    if (_gfx.depthFormat() != DEPTH_BUFFER_FORMAT)
+        _gfx.setDepthFormat(DEPTH_BUFFER_FORMAT);
+    _gfx.clearDepthBuffer(1.0f);
+
+    // draw background grid
+    _gfx.drawGrid();
+
+    _profiler.end("clear");
+
+    // the visibility buffer must start empty since its triangle IDs refer to the triangles of this frame
+    if (renderMode == RENDER_MODE::TEXTURED_DEFERRED)
+        _gfx.clearVisibilityBuffer();
+
+    /* Z-prepass: rasterize the depth of every triangle first, then the color pass below uses an equality depth test
+     * so that only the closest triangle on each pixel is colored/textured. Wireframes don't use the depth buffer
+     * and the visibility buffer already shades each pixel only once.
+     */
+    bool zPrepass = ENABLE_Z_PREPASS && renderMode != RENDER_MODE::WIREFRAME && renderMode != RENDER_MODE::WIREFRAME_DOTS &&
+                    renderMode != RENDER_MODE::TEXTURED_DEFERRED;
+
+    if (zPrepass)
+    {
+        _profiler.begin("zprepass");
+
+        // flat triangles discard the pixels of their scanlines that fall outside of them, the prepass must do the same
+        bool insideTest = (renderMode == RENDER_MODE::TRIANGLES || renderMode == RENDER_MODE::TRIANGLES_WIREFRAME);
+
+        for (unsigned int i = 0; i < _triangles.size(); ++i)
+        {
+            if (damage && !damage->intersects(screenBounds(_triangles[i])))
+                continue;
+
+            _gfx.drawTriangleDepth(_triangles[i].points[0], _triangles[i].points[1], _triangles[i].points[2], insideTest);
+        }
+
+        _gfx.setDepthFunc(DEPTH_FUNC::DEPTH_EQUAL);
+        _profiler.end("zprepass");
+    }
+
+    _profiler.begin("raster");
+
+    /* loop projected triangles and render them
+     *
+     * The loop below simply iterates through every triangle drawing them on the screen without respecting their Z order:
+     *      for (unsigned int i = 0; i < _triangles.size(); ++i) {
+     *          Triangle triangle = _triangles[i];
+     *          _gfx.drawTriangle(triangle.points[0].x, triangle.points[0].y,
+     *                            triangle.points[1].x, triangle.points[1].y,
+     *                            triangle.points[2].x, triangle.points[2].y,
+     *                            triangle.color);
+     *      }
+     *
+     * A simple solution for the psychodelic problem that it creates is the Painter's Algorithm
+     * which painst the triangles that are furthest away first:
+     *  - Average the Z coord of all the 3 vertices of a Triangle and assume that is the depth of a face
+     */
+    for (unsigned int i = 0; i < _triangles.size(); ++i) // with face culling enabled, size=2 for a cube that has no rotation
+    {
+        Triangle triangle = _triangles[i];
+
+        // partial redraw: the triangles outside of the damaged area would be discarded by the scissor anyway
+        if (damage && !damage->intersects(screenBounds(triangle)))
+            continue;
+
+        // debug: since the triangles are sorted by their Z value, render just the first 2 for the front face
+        //if  (i != 0 && i != 1)
+        //    continue;
+
+        switch (renderMode)
+        {
+            case RENDER_MODE::WIREFRAME:
+                // connect the vertices (wireframe, unfilled)
+                _gfx.drawTriangle(triangle.points[0].x, triangle.points[0].y,
+                                  triangle.points[1].x, triangle.points[1].y,
+                                  triangle.points[2].x, triangle.points[2].y,
+                                  WIREFRAME_COLOR);
+                break;
+
+            case RENDER_MODE::WIREFRAME_DOTS:
+                // connect the vertices (wireframe, unfilled)
+                _gfx.drawTriangle(triangle.points[0].x, triangle.points[0].y,
+                                  triangle.points[1].x, triangle.points[1].y,
+                                  triangle.points[2].x, triangle.points[2].y,
+                                  WIREFRAME_COLOR);
+
+                // draw small dots points for each vertex (yellow)
+                _gfx.drawRect(triangle.points[0].x, triangle.points[0].y, 6, 6, 0xFF00FFFF);
+                _gfx.drawRect(triangle.points[1].x, triangle.points[1].y, 6, 6, 0xFF00FFFF);
+                _gfx.drawRect(triangle.points[2].x, triangle.points[2].y, 6, 6, 0xFF00FFFF);
+                break;
+
+            case RENDER_MODE::TRIANGLES:
+                // draw the vertices (filled)
+                if (triangle.smooth)
+                    _gfx.fillTriangle(triangle.points[0], triangle.points[1], triangle.points[2],
+                                      triangle.vertexColors[0], triangle.vertexColors[1], triangle.vertexColors[2]);
+                else
+                    _gfx.fillTriangle(triangle.points[0], triangle.points[1], triangle.points[2], triangle.color);
+                break;
+
+            case RENDER_MODE::TRIANGLES_WIREFRAME:
+                // draw the vertices (filled)
+                if (triangle.smooth)
+                    _gfx.fillTriangle(triangle.points[0], triangle.points[1], triangle.points[2],
+                                      triangle.vertexColors[0], triangle.vertexColors[1], triangle.vertexColors[2]);
+                else
+                    _gfx.fillTriangle(triangle.points[0], triangle.points[1], triangle.points[2], triangle.color);
+
+                // connect the vertices (wireframe, unfilled)
+                _gfx.drawTriangle(triangle.points[0].x, triangle.points[0].y,
+                                  triangle.points[1].x, triangle.points[1].y,
+                                  triangle.points[2].x, triangle.points[2].y,
+                                  WIREFRAME_COLOR);
+                break;
+
+            case RENDER_MODE::TEXTURED:
+                _gfx.drawTexturedTriangle(triangle.points[0], triangle.points[1], triangle.points[2],
+                                          triangle.texCoords[0], triangle.texCoords[1], triangle.texCoords[2],
+                                          triangle.texture.get(), triangle.textureWidth, triangle.textureHeight,
+                                          FIX_TEXTURE_DISTORTION);
+                break;
+
+            case RENDER_MODE::TEXTURED_WIREFRAME:
+                _gfx.drawTexturedTriangle(triangle.points[0], triangle.points[1], triangle.points[2],
+                                          triangle.texCoords[0], triangle.texCoords[1], triangle.texCoords[2],
+                                          triangle.texture.get(), triangle.textureWidth, triangle.textureHeight,
+                                          FIX_TEXTURE_DISTORTION);
+
+                // connect the vertices (wireframe, unfilled)
+                _gfx.drawTriangle(triangle.points[0].x, triangle.points[0].y,
+                                  triangle.points[1].x, triangle.points[1].y,
+                                  triangle.points[2].x, triangle.points[2].y,
+                                  WIREFRAME_COLOR);
+                break;
+
+            case RENDER_MODE::TEXTURED_DEFERRED:
+                // 1st pass: rasterize only depth + triangle ID (the texture is not touched here)
+                _gfx.drawVisibilityTriangle(triangle.points[0], triangle.points[1], triangle.points[2],
+                                            triangle.texCoords[0], triangle.texCoords[1], triangle.texCoords[2],
+                                            triangle.texture.get(), triangle.textureWidth, triangle.textureHeight);
+                break;
+
+            default:
+                qDebug() << "Renderer::render !!! Unknown render mode";
+                break;
+        }
+
+    }
+
+    // 2nd pass of the visibility buffer: texture each visible pixel exactly once
+    if (renderMode == RENDER_MODE::TEXTURED_DEFERRED)
+        _gfx.resolveVisibilityBuffer(*_jobSystem, FIX_TEXTURE_DISTORTION);
+
+    _gfx.setDepthFunc(DEPTH_FUNC::DEPTH_LESS);
+    _profiler.end("raster");
+
+    // shadows: a single lookup per visible pixel once everything is rasterized (wireframes write no depth)
+    if (_shadows && renderMode != RENDER_MODE::WIREFRAME && renderMode != RENDER_MODE::WIREFRAME_DOTS)
+    {
+        _profiler.begin("shadows");
+        QRect area = (damage) ? *damage : QRect(0, 0, _gfx.width(), _gfx.height());
+        ShadowMap& shadowMap = (_sharedShadowMap) ? *_sharedShadowMap : _shadowMap;
+        shadowMap.apply(_gfx, _viewMatrix, _projMatrix, area, *_jobSystem);
+        _profiler.end("shadows");
+    }
+
+    /* post-processing: each filter goes over the whole frame in place, the tiles still waiting for their lazy clear
+     * are cleared first so that the filters see the final background
+     */
+    if (ENABLE_FOG || ENABLE_TONEMAP || ENABLE_FXAA)
+        _gfx.resolveClears();
+
+    if (ENABLE_FOG && renderMode != RENDER_MODE::WIREFRAME && renderMode != RENDER_MODE::WIREFRAME_DOTS)
+    {
+        _profiler.begin("fog");
+        _postProcess.fog(_gfx, *_jobSystem);
+        _profiler.end("fog");
+    }
+
+    if (ENABLE_TONEMAP)
+    {
+        _profiler.begin("tonemap");
+        _postProcess.tonemap(_gfx, *_jobSystem);
+        _profiler.end("tonemap");
+    }
+
+    if (ENABLE_FXAA)
+    {
+        _profiler.begin("fxaa");
+        _postProcess.fxaa(_gfx, *_jobSystem);
+        _profiler.end("fxaa");
+    }
+}
+
+/* Frustum planes are defined by a point and a normal vector
+ */
+void Renderer::_initFrustumPlanes(const float& fovX, const float& fovY, const float& zNear, const float& zFar)
+{
+//    printf("init_frustum_planes: fovX=%.2f  fovY=%.2f  z_near=%.2f  z_zfar=%.2f\n", fovX, fovY, zNear, zFar);
+
+    float cosHalfFovX = std::cos(fovX/2.f);
+    float sinHalfFovX = std::sin(fovX/2.f);
+    float cosHalfFovY = std::cos(fovY/2.f);
+    float sinHalfFovY = std::sin(fovY/2.f);
+
+//    printf("init_frustum_planes: cosHalfFovX=%.2f  sinHalfFovX=%.2f\n", cosHalfFovX, sinHalfFovX);
+//    printf("init_frustum_planes: cosHalfFovY=%.2f  sinHalfFovY=%.2f\n", cosHalfFovY, sinHalfFovY);
+
+    Vec3d origin(0.f, 0.f, 0.f);
+
+    _frustumPlanes[FRUSTUM_PLANE::LEFT].point = origin;
+    _frustumPlanes[FRUSTUM_PLANE::LEFT].normal.x = cosHalfFovX;
+    _frustumPlanes[FRUSTUM_PLANE::LEFT].normal.y = 0;
+    _frustumPlanes[FRUSTUM_PLANE::LEFT].normal.z = sinHalfFovX;
+//    std::cout << "init_frustum_planes: LEFT point=" << _frustumPlanes[FRUSTUM_PLANE::LEFT].point << "  normal=" << _frustumPlanes[FRUSTUM_PLANE::LEFT].normal << std::endl;
+
+    _frustumPlanes[FRUSTUM_PLANE::RIGHT].point = origin;
+    _frustumPlanes[FRUSTUM_PLANE::RIGHT].normal.x = -cosHalfFovX;
+    _frustumPlanes[FRUSTUM_PLANE::RIGHT].normal.y = 0;
+    _frustumPlanes[FRUSTUM_PLANE::RIGHT].normal.z = sinHalfFovX;
+//    std::cout << "init_frustum_planes: RIGHT point=" << _frustumPlanes[FRUSTUM_PLANE::RIGHT].point << "  normal=" << _frustumPlanes[FRUSTUM_PLANE::RIGHT].normal << std::endl;
+
+    _frustumPlanes[FRUSTUM_PLANE::TOP].point = origin;
+    _frustumPlanes[FRUSTUM_PLANE::TOP].normal.x = 0;
+    _frustumPlanes[FRUSTUM_PLANE::TOP].normal.y = -cosHalfFovY;
+    _frustumPlanes[FRUSTUM_PLANE::TOP].normal.z = sinHalfFovY;
+//    std::cout << "init_frustum_planes: TOP point=" << _frustumPlanes[FRUSTUM_PLANE::TOP].point << "  normal=" << _frustumPlanes[FRUSTUM_PLANE::TOP].normal << std::endl;
+
+    _frustumPlanes[FRUSTUM_PLANE::BOTTOM].point = origin;
+    _frustumPlanes[FRUSTUM_PLANE::BOTTOM].normal.x = 0;
+    _frustumPlanes[FRUSTUM_PLANE::BOTTOM].normal.y = cosHalfFovY;
+    _frustumPlanes[FRUSTUM_PLANE::BOTTOM].normal.z = sinHalfFovY;
+//    std::cout << "init_frustum_planes: BOTTOM point=" << _frustumPlanes[FRUSTUM_PLANE::BOTTOM].point << "  normal=" << _frustumPlanes[FRUSTUM_PLANE::BOTTOM].normal << std::endl;
+
+    _frustumPlanes[FRUSTUM_PLANE::NEAR].point = Vec3d(0.f, 0.f, zNear);
+    _frustumPlanes[FRUSTUM_PLANE::NEAR].normal.x = 0;
+    _frustumPlanes[FRUSTUM_PLANE::NEAR].normal.y = 0;
+    _frustumPlanes[FRUSTUM_PLANE::NEAR].normal.z = 1;
+//    std::cout << "init_frustum_planes: NEAR point=" << _frustumPlanes[FRUSTUM_PLANE::NEAR].point << "  normal=" << _frustumPlanes[FRUSTUM_PLANE::NEAR].normal << std::endl;
+
+    _frustumPlanes[FRUSTUM_PLANE::FAR].point = Vec3d(0.f, 0.f, zFar);
+    _frustumPlanes[FRUSTUM_PLANE::FAR].normal.x = 0;
+    _frustumPlanes[FRUSTUM_PLANE::FAR].normal.y = 0;
+    _frustumPlanes[FRUSTUM_PLANE::FAR].normal.z = -1;
+//    std::cout << "init_frustum_planes: FAR point=" << _frustumPlanes[FRUSTUM_PLANE::FAR].point << "  normal=" << _frustumPlanes[FRUSTUM_PLANE::FAR].normal << std::endl;
+}
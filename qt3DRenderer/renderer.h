@@ -0,0 +1,229 @@
+#pragma once
+#include <vector>
+
+#include <QRect>
+
+#include "mat4.h"
+#include "vec3d.h"
+#include "display.h"
+#include "light.h"
+#include "lighting.h"
+#include "mesh.h"
+#include "triangle.h"
+#include "clipping.h"
+#include "profiler.h"
+#include "jobsystem.h"
+#include "shadowmap.h"
+#include "postprocess.h"
+
+#define LOD_PIXEL_ERROR 1.0f        // a LOD is used while its estimated error (Mesh::lodErrors) is under this many pixels
+
+extern bool ENABLE_FACE_CULL;
+extern bool OBJECT_SPACE_CULL;
+extern bool FIX_TEXTURE_DISTORTION;
+extern bool ENABLE_Z_PREPASS;
+extern bool ENABLE_LOD;
+extern bool GOURAUD_SHADING;
+extern DEPTH_FORMAT DEPTH_BUFFER_FORMAT;
+extern bool ENABLE_SHADOWS;
+extern bool CACHE_SHADOW_MAP;
+extern bool ENABLE_FOG;
+extern bool ENABLE_TONEMAP;
+extern bool ENABLE_FXAA;
+
+
+enum RENDER_MODE {
+    WIREFRAME,              // draw only wireframe lines
+    WIREFRAME_DOTS,         // draw wireframe lines with small colored dots on each triangle vertex
+    TRIANGLES,              // fills triangles with a solid color
+    TRIANGLES_WIREFRAME,    // fills triangles and adds wireframe lines
+    TEXTURED,               // draw with textures
+    TEXTURED_WIREFRAME,     // draw with textures and adds wireframe lines
+    TEXTURED_DEFERRED       // rasterize depth + triangle IDs first, then texture each visible pixel only once
+};
+
+
+/* WorldTransform: the part of the setup of a mesh that doesn't depend on the camera. MultiViewRenderer computes it once
+ * per frame and shares it among all its views.
+ */
+struct WorldTransform
+{
+    Mat4 worldMatrix;           // Model Space to World Space, [T] * [R] * [S]
+    Mat4 invWorldMatrix;        // World Space to Model Space (only valid when invertible)
+    bool invertible;            // false when a scale is zero
+    Vec3d boundsCenter;         // bounding sphere of the mesh in World Space
+    float boundsRadius;
+};
+
+
+/* Renderer: the Graphics Pipeline without the window. processGeometry() takes the meshes from Model Space to Screen Space
+ * and render() rasterizes the resulting triangles on the Display.
+ *
+ * The geometry stage runs on several threads: the faces of the meshes are split in chunks, each chunk writes its
+ * triangles to its own buffer and the buffers are merged in the order of the chunks. The result is the same of a
+ * serial run, no matter how many threads are used. The threads belong to a JobSystem that lives as long as the
+ * Renderer and is shared by all the stages.
+ */
+class Renderer
+{
+public:
+    // Renderer: jobSystem runs the parallel stages (null: the Renderer starts its own threads)
+    Renderer(JobSystem* jobSystem = nullptr);
+
+    // setProjection: perspective projection matrix and frustum planes (aspect = width / height)
+    void setProjection(const float& fovY, const float& aspect, const float& zNear, const float& zFar);
+
+    // setThreadCount: number of threads of the geometry stage (0 = QThread::idealThreadCount())
+    void setThreadCount(const int& threads);
+
+    //
+    int threadCount();
+
+    // jobSystem: the worker threads of the renderer, for the stages that run in parallel
+    JobSystem& jobSystem();
+
+    /* processGeometry: run the geometry stage for all the meshes, seen from cameraPosition through viewMatrix.
+     * transforms (one per mesh, see worldTransform()) are shared with other views: the meshes outside the frustum are
+     * skipped and the World and View matrices are concatenated, so each vertex is transformed once
+     */
+    void processGeometry(std::vector<Mesh>& meshes, const Vec3d& cameraPosition, const Mat4& viewMatrix);
+    void processGeometry(const std::vector<Mesh*>& meshes, const Vec3d& cameraPosition, const Mat4& viewMatrix,
+                         const std::vector<WorldTransform>* transforms = nullptr);
+
+    // setView: the camera used by sphereVisible()/pixelsPerUnit() before processGeometry() is called for the frame
+    void setView(const Vec3d& cameraPosition, const Mat4& viewMatrix);
+
+    // sphereVisible: false when a sphere in World Space is completely outside the viewing frustum
+    bool sphereVisible(const Vec3d& center, const float& radius);
+
+    // pixelsPerUnit: how many pixels a World Space unit covers at the point of a sphere nearest to the camera
+    // (a negative value when the camera is inside the sphere)
+    float pixelsPerUnit(const Vec3d& center, const float& radius);
+
+    // setLights: the lights of the scene (up to MAX_LIGHTS). The default is a single white light going away from the camera
+    void setLights(const std::vector<Light>& lights);
+
+    //
+    std::vector<Light>& lights();
+
+    // worldMatrix: the transform from Model Space to World Space, [T] * [R] * [S]
+    static Mat4 worldMatrix(const Vec3d& scale, const Vec3d& rotation, const Vec3d& translation);
+
+    // worldTransform: the World matrix of a mesh, its inverse and its bounding sphere in World Space
+    static void worldTransform(const Mesh* mesh, WorldTransform& transform);
+
+    // render: rasterize the triangles of the last processGeometry(). When a damage rectangle is given, only the triangles
+    // that overlap it are drawn (the scissor of the Display is expected to be set to the same rectangle)
+    void render(const RENDER_MODE& renderMode, const QRect* damage = nullptr);
+
+    //
+    Display& display();
+
+    //
+    Profiler& profiler();
+
+    // shadowMap: the shadows of the first directional light with castShadows (drawn while ENABLE_SHADOWS is set)
+    ShadowMap& shadowMap();
+
+    // shadowLight: the light whose shadows are drawn, the first directional light with castShadows (null when there's
+    // none or ENABLE_SHADOWS is off)
+    const Light* shadowLight();
+
+    // setSharedShadowMap: draw the shadows with a map already rendered for this frame by someone else (null: the
+    // Renderer renders its own). MultiViewRenderer renders a single map for all its views
+    void setSharedShadowMap(ShadowMap* shadowMap);
+
+    // postProcess: the filters applied to the whole frame at the end of render() (ENABLE_FOG, ENABLE_TONEMAP, ENABLE_FXAA)
+    PostProcess& postProcess();
+
+    // triangles: the projected triangles of the last processGeometry()
+    const std::vector<Triangle>& triangles();
+
+    // meshBounds: the screen area covered by each mesh on the last processGeometry() (null when nothing was visible)
+    const std::vector<QRect>& meshBounds();
+
+    // screenBounds: the rectangle of the screen covered by a projected triangle (+ a margin for the wireframe dots)
+    static QRect screenBounds(const Triangle& t);
+
+    // processedFaces/culledFaces: faces that went through the geometry stage (or were culled) since resetStats()
+    uint64_t processedFaces();
+    uint64_t culledFaces();
+
+    // fullDetailFaces: faces that would have gone through the geometry stage without LODs since resetStats()
+    uint64_t fullDetailFaces();
+
+    // vertexCacheHitRate: fraction of the vertices of the faces found already transformed in the post-transform cache
+    float vertexCacheHitRate();
+    void resetStats();
+
+private:
+    // MeshSetup: computed once per mesh and per frame, shared by all the chunks of its faces
+    struct MeshSetup
+    {
+        Mat4 worldMatrix;
+        Mat4 worldViewMatrix;       // [V] * [W] when the World Transform is shared (see processGeometry())
+        bool concatenated;
+        bool visible;               // false when the bounding sphere is outside the frustum (shared transforms only)
+        const Mesh* mesh;           // the mesh drawn: transforms and texture
+        const Mesh* geometry;       // its geometry (or the one of its asset) or one of its LODs
+        const std::vector<Vec3d>* normals;  // vertex normals of the mesh for Gouraud shading (null for flat shading)
+        Mat4 normalMatrix;          // Model Space normals to Camera Space: the inverse transpose of the World-View matrix
+        bool objectSpaceCull;
+        float scaleDet;
+        Vec3d cameraModelSpace;
+    };
+
+    // GeometryJob: a range of faces of a mesh and the triangles it produced
+    struct GeometryJob
+    {
+        unsigned int mesh;
+        unsigned int first;
+        unsigned int last;
+        std::vector<Triangle> triangles;
+        Lighting::Batch lighting;           // the samples of the faces, shaded once all the faces of the job are done
+        std::vector<unsigned int> samples;  // first sample of each triangle (flat: 1 sample, smooth: 3)
+        std::vector<uint32_t> litColors;
+        uint64_t culledFaces;
+        uint64_t fetchedVertices;
+        uint64_t cachedVertices;
+    };
+
+    void _initFrustumPlanes(const float& fovX, const float& fovY, const float& zNear, const float& zFar);
+    void _updateShadowMap(const std::vector<Mesh*>& meshes, const Mat4& viewMatrix);
+    void _setupMesh(Mesh* mesh, const WorldTransform* transform, MeshSetup& setup);
+    int _selectLod(const Mesh* geometry, const Vec3d& scale, const MeshSetup& setup);
+    void _processGraphicsPipeline(const Mesh& mesh, const MeshSetup& setup, GeometryJob& job);
+
+    Display _gfx;
+    Profiler _profiler;
+    ShadowMap _shadowMap;
+    ShadowMap* _sharedShadowMap;        // used instead of _shadowMap, not updated by this Renderer
+    bool _shadows;                      // the shadow map was updated for the frame of the last processGeometry()
+    PostProcess _postProcess;
+
+    std::vector<Triangle> _triangles;
+    std::vector<QRect> _meshBounds;
+
+    std::vector<Mesh*> _meshPointers;
+    std::vector<MeshSetup> _meshSetups;
+    std::vector<GeometryJob> _jobs;     // kept between frames so that the triangle buffers keep their capacity
+    JobSystem _ownJobSystem;            // single threaded when the JobSystem comes from outside
+    JobSystem* _jobSystem;
+
+    Mat4 _projMatrix;
+    float _fovY;
+    Mat4 _viewMatrix;
+    Vec3d _cameraPosition;
+    int _screenWidth;
+    int _screenHeight;
+
+    std::vector<Light> _lights;
+    Lighting _lighting;
+    Plane _frustumPlanes[6];
+
+    uint64_t _processedFaces;
+    uint64_t _culledFaces;
+    uint64_t _fullDetailFaces;
+    uint64_t _fetchedVertices;
+    uint64_t _cachedVertices;
+};
@@ -0,0 +1,105 @@
+#include "resolutionscaler.h"
+
+#include <algorithm>
+
+#define SMOOTHING 0.2       // weight of the newest measurement in the moving average
+
+
+ResolutionScaler::ResolutionScaler()
+{
+    _targetMs = 5.0;
+    _tolerance = 0.15;
+    _holdFrames = 15;
+    _step = 0.05f;
+
+    _minScale = 0.5f;
+    _maxScale = 1.0f;
+
+    reset();
+}
+
+void ResolutionScaler::setTargetFrameTime(const double& ms)
+{
+    _targetMs = ms;
+}
+
+void ResolutionScaler::setBounds(const float& minScale, const float& maxScale)
+{
+    _minScale = std::min(minScale, maxScale);
+    _maxScale = std::max(minScale, maxScale);
+    _scale = std::max(_minScale, std::min(_scale, _maxScale));
+}
+
+void ResolutionScaler::setHysteresis(const double& tolerance, const int& holdFrames, const float& step)
+{
+    _tolerance = tolerance;
+    _holdFrames = std::max(holdFrames, 1);
+    _step = step;
+}
+
+bool ResolutionScaler::update(const double& frameMs)
+{
+    _smoothedMs = (_smoothedMs < 0) ? frameMs : _smoothedMs + SMOOTHING * (frameMs - _smoothedMs);
+
+    if (_smoothedMs > _targetMs * (1.0 + _tolerance))
+    {
+        _overFrames++;
+        _underFrames = 0;
+    }
+    else if (_smoothedMs < _targetMs * (1.0 - _tolerance))
+    {
+        _underFrames++;
+        _overFrames = 0;
+    }
+    else
+    {
+        // inside the band: keep the current resolution
+        _overFrames = _underFrames = 0;
+    }
+
+    float newScale = _scale;
+    if (_overFrames >= _holdFrames)
+        newScale = std::max(_minScale, _scale - _step);
+    else if (_underFrames >= _holdFrames)
+        newScale = std::min(_maxScale, _scale + _step);
+
+    if (newScale == _scale)
+        return false;
+
+    // the time of the raster grows with the number of pixels: estimate it for the new resolution
+    // so that the moving average doesn't have to start over
+    float ratio = newScale / _scale;
+    _smoothedMs *= ratio * ratio;
+
+    _scale = newScale;
+    _overFrames = _underFrames = 0;
+    return true;
+}
+
+float ResolutionScaler::scale()
+{
+    return _scale;
+}
+
+void ResolutionScaler::reset()
+{
+    _scale = _maxScale;
+    _smoothedMs = -1;
+    _overFrames = 0;
+    _underFrames = 0;
+}
+
+double ResolutionScaler::targetFrameTime()
+{
+    return _targetMs;
+}
+
+double ResolutionScaler::tolerance()
+{
+    return _tolerance;
+}
+
+int ResolutionScaler::holdFrames()
+{
+    return _holdFrames;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+
+/* ResolutionScaler: adjusts the internal render resolution to hold a frame time budget.
+ *
+ * The time measured on each frame is smoothed and compared to the target: the scale factor drops one step when it
+ * stays above the target (+ tolerance) for a number of consecutive frames, and rises one step when it stays below
+ * the target (- tolerance) for the same number of frames. The band between both thresholds and the number of frames
+ * that must agree before a change are the hysteresis that keeps the quality from oscillating.
+ */
+class ResolutionScaler
+{
+public:
+    ResolutionScaler();
+
+    // setTargetFrameTime: the time budget (ms) that the controller tries to hold
+    void setTargetFrameTime(const double& ms);
+
+    // setBounds: the scale factor is kept within [minScale, maxScale], e.g. [0.5, 1.0] for 50-100% of the window size
+    void setBounds(const float& minScale, const float& maxScale);
+
+    // setHysteresis: tolerance is a fraction of the target (0.15 = +/-15%), holdFrames is how many consecutive frames
+    // must be out of the band before the scale changes and step is how much the scale changes at a time
+    void setHysteresis(const double& tolerance, const int& holdFrames, const float& step);
+
+    // update: feed the time (ms) measured on the last frame. Returns true when the scale factor changed
+    bool update(const double& frameMs);
+
+    // scale: the current scale factor of the render resolution
+    float scale();
+
+    // reset: go back to the maximum scale and forget the previous measurements
+    void reset();
+
+    double targetFrameTime();
+    double tolerance();
+    int holdFrames();
+
+private:
+    double _targetMs;
+    double _tolerance;
+    int _holdFrames;
+    float _step;
+
+    float _minScale;
+    float _maxScale;
+    float _scale;
+
+    double _smoothedMs;
+    int _overFrames;
+    int _underFrames;
+};
@@ -0,0 +1,260 @@
+#include "scene.h"
+
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonValue>
+
+#include <algorithm>
+#include <cmath>
+
+#define PI 3.14159265358979323846
+#define DEG2RAD(a) ((a) * (float)PI / 180.f)
+
+
+Scene::Scene()
+{
+    // the built-in scene: the camera orbits the point 7 units ahead of the origin
+    camera.position = Vec3d(0.f, 0.f, 0.f);
+    camera.target = Vec3d(0.f, 0.f, 7.f);
+    camera.orbit = true;
+    camera.orbitAngle = 270.f;
+    camera.orbitDistance = 7.f;
+    camera.orbitSpeed = 15.f;
+    camera.fovY = 60.f;
+    camera.zNear = 1.f;
+    camera.zFar = 100.f;
+
+    lodLevels = 3;
+}
+
+bool Scene::load(const std::string& filename)
+{
+    QFile file(QString::fromStdString(filename));
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qDebug() << "Scene::load !!! unable to open" << QString::fromStdString(filename);
+        return false;
+    }
+
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &error);
+    if (error.error != QJsonParseError::NoError || !doc.isObject())
+    {
+        qDebug() << "Scene::load !!!" << QString::fromStdString(filename) << "offset" << error.offset << ":" << error.errorString();
+        return false;
+    }
+
+    QJsonObject root = doc.object();
+    Scene scene;
+    scene.filename = filename;
+
+    // the paths of the assets are relative to the scene file
+    QDir dir(QFileInfo(QString::fromStdString(filename)).absolutePath());
+
+    /* camera */
+
+    QJsonObject cam = root.value("camera").toObject();
+    scene.camera.position = _vec3d(cam.value("position"), scene.camera.position);
+    scene.camera.target = _vec3d(cam.value("target"), scene.camera.target);
+    scene.camera.orbit = cam.value("orbit").toBool(scene.camera.orbit);
+    scene.camera.orbitAngle = cam.value("orbitAngle").toDouble(scene.camera.orbitAngle);
+    scene.camera.orbitDistance = cam.value("orbitDistance").toDouble(scene.camera.orbitDistance);
+    scene.camera.orbitSpeed = cam.value("orbitSpeed").toDouble(scene.camera.orbitSpeed);
+    scene.camera.fovY = cam.value("fovY").toDouble(scene.camera.fovY);
+    scene.camera.zNear = cam.value("zNear").toDouble(scene.camera.zNear);
+    scene.camera.zFar = cam.value("zFar").toDouble(scene.camera.zFar);
+
+    QJsonArray path = cam.value("path").toArray();
+    for (int k = 0; k < path.size(); ++k)
+    {
+        QJsonObject obj = path.at(k).toObject();
+
+        CameraKey key;
+        key.time = obj.value("time").toDouble(0.0);
+        key.position = _vec3d(obj.value("position"), scene.camera.position);
+        key.target = _vec3d(obj.value("target"), scene.camera.target);
+        scene.camera.path.push_back(key);
+    }
+
+    std::stable_sort(scene.camera.path.begin(), scene.camera.path.end(),
+                     [](const CameraKey& a, const CameraKey& b) { return a.time < b.time; });
+
+    scene.lodLevels = std::max(0, root.value("lodLevels").toInt(scene.lodLevels));
+
+    /* lights */
+
+    QJsonArray lights = root.value("lights").toArray();
+    for (int l = 0; l < lights.size(); ++l)
+    {
+        QJsonObject obj = lights.at(l).toObject();
+
+        Light light;
+        QString type = obj.value("type").toString("directional").toLower();
+        if (type == "point")
+        {
+            light.type = LIGHT_TYPE::POINT;
+            light.position = _vec3d(obj.value("position"), light.position);
+        }
+        else if (type == "directional")
+        {
+            light.type = LIGHT_TYPE::DIRECTIONAL;
+            light.direction = _vec3d(obj.value("direction"), light.direction);
+        }
+        else
+        {
+            qDebug() << "Scene::load !!! unknown type of light:" << type;
+            continue;
+        }
+
+        light.color = _color(obj.value("color"), light.color);
+        light.intensity = obj.value("intensity").toDouble(light.intensity);
+        light.range = obj.value("range").toDouble(light.range);
+        light.cameraSpace = obj.value("cameraSpace").toBool(light.cameraSpace);
+        light.castShadows = obj.value("shadows").toBool(light.castShadows);
+        scene.lights.push_back(light);
+    }
+
+    /* meshes */
+
+    QJsonArray meshes = root.value("meshes").toArray();
+    for (int m = 0; m < meshes.size(); ++m)
+    {
+        QJsonObject obj = meshes.at(m).toObject();
+
+        SceneMesh mesh;
+        mesh.obj = obj.value("obj").toString().toStdString();
+        if (mesh.obj.empty())
+        {
+            qDebug() << "Scene::load !!! mesh" << m << "has no .obj";
+            continue;
+        }
+
+        mesh.name = obj.value("name").toString(QFileInfo(QString::fromStdString(mesh.obj)).fileName()).toStdString();
+        mesh.obj = dir.filePath(QString::fromStdString(mesh.obj)).toStdString();
+
+        // without a texture the mesh keeps the placeholder texture
+        QString texture = obj.value("texture").toString();
+        mesh.texture = texture.isEmpty() ? std::string() : dir.filePath(texture).toStdString();
+
+        mesh.scale = _vec3d(obj.value("scale"), Vec3d(1.f, 1.f, 1.f));
+        Vec3d degrees = _vec3d(obj.value("rotation"), Vec3d(0.f, 0.f, 0.f));
+        mesh.rotation = Vec3d(DEG2RAD(degrees.x), DEG2RAD(degrees.y), DEG2RAD(degrees.z));
+        mesh.translation = _vec3d(obj.value("translation"), Vec3d(0.f, 0.f, 0.f));
+        mesh.loadDistance = std::max(0.f, (float)obj.value("loadDistance").toDouble(0.f));
+        mesh.enabled = obj.value("enabled").toBool(true);
+        scene.meshes.push_back(mesh);
+    }
+
+    qDebug() << "Scene::load:" << QString::fromStdString(filename) << "meshes=" << scene.meshes.size() << "lights=" << scene.lights.size();
+
+    *this = scene;
+    return true;
+}
+
+void Scene::loadMeshes(AssetManager& assets, std::vector<Mesh>& meshes) const
+{
+    std::vector<MeshAsset> meshAssets(this->meshes.size());
+    std::vector<TextureAsset> textureAssets(this->meshes.size());
+
+    for (unsigned int m = 0; m < this->meshes.size(); ++m)
+    {
+        if (!this->meshes[m].enabled)
+            continue;
+
+        meshAssets[m] = assets.loadMesh(this->meshes[m].obj, lodLevels);
+        if (!this->meshes[m].texture.empty())
+            textureAssets[m] = assets.loadTexture(this->meshes[m].texture);
+    }
+
+    assets.waitForAll();
+
+    std::shared_ptr<uint32_t[]> white(new uint32_t[1] { 0xFFFFFFFF });
+
+    for (unsigned int m = 0; m < this->meshes.size(); ++m)
+    {
+        if (!meshAssets[m] || !meshAssets[m]->ready())
+            continue;
+
+        Mesh mesh;
+        mesh.asset = meshAssets[m]->data();
+        mesh.scale = this->meshes[m].scale;
+        mesh.rotation = this->meshes[m].rotation;
+        mesh.translation = this->meshes[m].translation;
+
+        if (textureAssets[m] && textureAssets[m]->ready())
+            mesh.setTexture(textureAssets[m]->data()->pixels, textureAssets[m]->data()->width, textureAssets[m]->data()->height);
+        else
+            mesh.setTexture(white, 1, 1);
+
+        meshes.push_back(mesh);
+    }
+}
+
+void Scene::cameraAt(const float& time, Vec3d& position, Vec3d& target) const
+{
+    const std::vector<CameraKey>& path = camera.path;
+
+    if (!path.empty())
+    {
+        // linear interpolation between the keys around the time (the ends are held)
+        unsigned int k = 0;
+        while (k + 1 < path.size() && path[k + 1].time <= time)
+            k++;
+
+        if (k + 1 == path.size() || time <= path[k].time)
+        {
+            position = path[k].position;
+            target = path[k].target;
+            return;
+        }
+
+        float t = (time - path[k].time) / (path[k + 1].time - path[k].time);
+        Vec3d p0 = path[k].position, p1 = path[k + 1].position;
+        Vec3d t0 = path[k].target, t1 = path[k + 1].target;
+        position = p0 + (p1 - p0) * t;
+        target = t0 + (t1 - t0) * t;
+        return;
+    }
+
+    target = camera.target;
+    if (!camera.orbit)
+    {
+        position = camera.position;
+        return;
+    }
+
+    // the orbit of the Window: around the target, at the height of the initial position
+    float angle = DEG2RAD(camera.orbitAngle + camera.orbitSpeed * time);
+    position = Vec3d(target.x + camera.orbitDistance * std::cos(angle), camera.position.y,
+                     target.z + camera.orbitDistance * std::sin(angle));
+}
+
+// _vec3d: a [x, y, z] array
+Vec3d Scene::_vec3d(const QJsonValue& value, const Vec3d& def)
+{
+    QJsonArray array = value.toArray();
+    if (array.size() != 3)
+        return def;
+
+    return Vec3d(array.at(0).toDouble(), array.at(1).toDouble(), array.at(2).toDouble());
+}
+
+// _color: "#RRGGBB" or "#AARRGGBB" (the alpha of the lights is ignored anyway)
+uint32_t Scene::_color(const QJsonValue& value, const uint32_t& def)
+{
+    QString hex = value.toString();
+    if (hex.startsWith("#"))
+        hex = hex.mid(1);
+
+    bool ok = false;
+    uint32_t color = hex.toUInt(&ok, 16);
+    if (!ok)
+        return def;
+
+    return (hex.size() <= 6) ? (0xFF000000 | color) : color;
+}
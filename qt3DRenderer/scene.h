@@ -0,0 +1,90 @@
+#pragma once
+#include <string>
+#include <vector>
+
+#include "assetmanager.h"
+#include "light.h"
+#include "mesh.h"
+#include "vec3d.h"
+
+class QJsonValue;
+
+
+// SceneMesh: a mesh of the scene and the files it comes from (absolute paths, resolved against the scene file)
+struct SceneMesh
+{
+    std::string name;
+    std::string obj;
+    std::string texture;
+    Vec3d scale;
+    Vec3d rotation;                 // radians (degrees in the file)
+    Vec3d translation;
+    float loadDistance;             // the assets are requested once the camera gets this close (0 = right away)
+    bool enabled;                   // disabled meshes are kept in the file but never loaded
+};
+
+// CameraKey: a point of a scripted camera path
+struct CameraKey
+{
+    float time;                     // seconds
+    Vec3d position;
+    Vec3d target;
+};
+
+// SceneCamera: where the camera starts and the projection
+struct SceneCamera
+{
+    Vec3d position;
+    Vec3d target;                   // the point it looks at (and orbits around)
+    bool orbit;
+    float orbitAngle;               // degrees
+    float orbitDistance;
+    float orbitSpeed;               // degrees per second
+    std::vector<CameraKey> path;    // sorted by time. When there's a path the camera follows it instead of orbiting
+    float fovY;                     // degrees
+    float zNear;
+    float zFar;
+};
+
+/* Scene: a scene description file (JSON) with the meshes, lights and camera to render, so scenes can be changed
+ * without recompiling:
+ *
+ *  {
+ *      "camera": { "position": [0, 0, 0], "target": [0, 0, 7], "orbit": true, "orbitDistance": 7, "fovY": 60,
+ *                  "path": [ { "time": 0, "position": [0, 1, -2], "target": [0, 0, 7] }, { "time": 10, ... } ] },
+ *      "lodLevels": 3,
+ *      "lights": [ { "type": "point", "position": [0, 4, 7], "color": "#FFC080", "intensity": 0.8, "range": 6 },
+ *                  { "type": "directional", "direction": [0.5, -1, 0.8], "intensity": 0.3, "shadows": true } ],
+ *      "meshes": [ { "name": "f22", "obj": "f22.obj", "texture": "f22.png", "rotation": [0, -90, 0],
+ *                    "translation": [0, -1.3, 5], "loadDistance": 20 } ]
+ *  }
+ *
+ * Every field is optional: the defaults are the ones of the built-in scene. Relative paths are relative to the
+ * directory of the scene file. Only the description is read here: the assets are loaded later by the AssetManager,
+ * when the Window needs them.
+ */
+class Scene
+{
+public:
+    Scene();
+
+    // load: parses a scene file. On failure the scene is left as it was
+    bool load(const std::string& filename);
+
+    // loadMeshes: loads every enabled mesh right away and waits for them (headless modes, no placeholders).
+    // The meshes that failed are skipped and the textures that failed are replaced by a white texel
+    void loadMeshes(AssetManager& assets, std::vector<Mesh>& meshes) const;
+
+    // cameraAt: where the camera is at a time (seconds) since the scene started: along the path, orbiting or still
+    void cameraAt(const float& time, Vec3d& position, Vec3d& target) const;
+
+    std::string filename;
+    SceneCamera camera;
+    int lodLevels;                  // simplified versions generated for each mesh
+    std::vector<Light> lights;      // empty: the default light of the Renderer
+    std::vector<SceneMesh> meshes;
+
+private:
+    static Vec3d _vec3d(const QJsonValue& value, const Vec3d& def);
+    static uint32_t _color(const QJsonValue& value, const uint32_t& def);
+};
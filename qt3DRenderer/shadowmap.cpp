@@ -0,0 +1,259 @@
+#include "shadowmap.h"
+#include "renderer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#define SHADOW_ROWS_PER_JOB 16      // rows of the screen looked up by a single job
+#define SHADOW_SPAN 256             // pixels of a row whose depth is read back at once
+#define EPSILON 1e-4f
+
+
+// rigidInverse: the inverse of a rotation + translation (a view matrix): the rotation transposed and the translation undone
+static Mat4 rigidInverse(const Mat4& m)
+{
+    Mat4 inv = Mat4::eye();
+    for (int r = 0; r < 3; ++r)
+        for (int c = 0; c < 3; ++c)
+            inv.m[r][c] = m.m[c][r];
+
+    for (int r = 0; r < 3; ++r)
+        inv.m[r][3] = -(inv.m[r][0] * m.m[0][3] + inv.m[r][1] * m.m[1][3] + inv.m[r][2] * m.m[2][3]);
+
+    return inv;
+}
+
+static bool sameVec3d(const Vec3d& a, const Vec3d& b)
+{
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+
+ShadowMap::ShadowMap()
+{
+    _size = SHADOW_MAP_SIZE;
+    _valid = false;
+    _renders = 0;
+
+    _map.setLazyClear(false);
+}
+
+void ShadowMap::setSize(const int& size)
+{
+    if (size == _size)
+        return;
+
+    _size = size;
+    _valid = false;
+}
+
+bool ShadowMap::update(const std::vector<Mesh*>& meshes, const Vec3d& direction, const bool& cache)
+{
+    if (cache && !_changed(meshes, direction))
+        return false;
+
+    _render(meshes, direction);
+
+    // remember what the map depends on
+    _direction = direction;
+    _casters.resize(meshes.size());
+    for (unsigned int m = 0; m < meshes.size(); ++m)
+    {
+        const Mesh* mesh = meshes[m];
+        _casters[m] = { mesh->geometry()->generation, mesh->geometry()->vertices.size(), mesh->scale, mesh->rotation,
+                        mesh->translation };
+    }
+
+    _valid = true;
+    _renders++;
+    return true;
+}
+
+// _changed: the light or a mesh moved (or a mesh was added, removed or got its geometry) since the last render
+bool ShadowMap::_changed(const std::vector<Mesh*>& meshes, const Vec3d& direction)
+{
+    if (!_valid || !sameVec3d(direction, _direction) || meshes.size() != _casters.size())
+        return true;
+
+    for (unsigned int m = 0; m < meshes.size(); ++m)
+    {
+        const Mesh* mesh = meshes[m];
+        const Caster& caster = _casters[m];
+
+        if (mesh->geometry()->generation != caster.generation || mesh->geometry()->vertices.size() != caster.vertices ||
+            !sameVec3d(mesh->scale, caster.scale) || !sameVec3d(mesh->rotation, caster.rotation) ||
+            !sameVec3d(mesh->translation, caster.translation))
+            return true;
+    }
+
+    return false;
+}
+
+void ShadowMap::_render(const std::vector<Mesh*>& meshes, const Vec3d& direction)
+{
+    // the buffers are only allocated once shadows are used
+    if (_map.width() != _size || _map.height() != _size)
+    {
+        _map.setSize(_size, _size);
+        _map.setup();
+    }
+
+    _map.clearDepthBuffer(1.f);
+
+    // Light Space: looking along the rays, with any up vector that isn't parallel to them
+    Vec3d forward = direction;
+    forward.norm();
+    Vec3d up = (std::fabs(forward.y) < 0.99f) ? Vec3d(0.f, 1.f, 0.f) : Vec3d(0.f, 0.f, 1.f);
+    Mat4 lightView = Mat4::lookAt(Vec3d(0.f, 0.f, 0.f), forward, up);
+
+    /* 1st pass: the vertices of all the meshes in Light Space and the box around them */
+
+    const float inf = std::numeric_limits<float>::max();
+    Vec3d minimum(inf, inf, inf), maximum(-inf, -inf, -inf);
+    _lightVertices.clear();
+
+    for (unsigned int m = 0; m < meshes.size(); ++m)
+    {
+        const Mesh* mesh = meshes[m];
+        const Mesh* geometry = mesh->geometry();
+        Mat4 matrix = lightView * Renderer::worldMatrix(mesh->scale, mesh->rotation, mesh->translation);
+
+        for (unsigned int v = 0; v < geometry->vertices.size(); ++v)
+        {
+            Vec4d vertex = Vec3d::toVec4d(geometry->vertices[v]) * matrix;
+
+            minimum.x = std::min(minimum.x, vertex.x);
+            minimum.y = std::min(minimum.y, vertex.y);
+            minimum.z = std::min(minimum.z, vertex.z);
+            maximum.x = std::max(maximum.x, vertex.x);
+            maximum.y = std::max(maximum.y, vertex.y);
+            maximum.z = std::max(maximum.z, vertex.z);
+
+            _lightVertices.push_back(vertex);
+        }
+    }
+
+    if (_lightVertices.empty())
+        return;
+
+    /* orthographic projection of the box: x, y to the pixels of the map (y grows downwards like on the screen) and z
+     * to [0, 0.5], so that 1 / (1 - z) is a valid w for the depth-only kernel
+     */
+    float scaleX = (_size - 1) / std::max(maximum.x - minimum.x, EPSILON);
+    float scaleY = (_size - 1) / std::max(maximum.y - minimum.y, EPSILON);
+    float scaleZ = 0.5f / std::max(maximum.z - minimum.z, EPSILON);
+
+    Mat4 ortho = Mat4::eye();
+    ortho.m[0][0] = scaleX;     ortho.m[0][3] = -minimum.x * scaleX;
+    ortho.m[1][1] = -scaleY;    ortho.m[1][3] = maximum.y * scaleY;
+    ortho.m[2][2] = scaleZ;     ortho.m[2][3] = -minimum.z * scaleZ;
+    _lightMatrix = ortho * lightView;
+
+    /* 2nd pass: every face of every mesh through the depth-only kernel. Both sides of the faces cast shadows, so open
+     * meshes (a single plane, a paged terrain) work too
+     */
+    unsigned int first = 0;
+    for (unsigned int m = 0; m < meshes.size(); ++m)
+    {
+        const Mesh* geometry = meshes[m]->geometry();
+        unsigned int last = first + (unsigned int)geometry->vertices.size();
+
+        for (unsigned int v = first; v < last; ++v)
+        {
+            Vec4d& vertex = _lightVertices[v];
+            vertex = vertex * ortho;
+            vertex.w = 1.f / (1.f - vertex.z);
+        }
+
+        for (unsigned int f = 0; f < geometry->faces.size(); ++f)
+        {
+            const Face& face = geometry->faces[f];
+            _map.drawTriangleDepth(_lightVertices[first + face.a], _lightVertices[first + face.b], _lightVertices[first + face.c]);
+        }
+
+        first = last;
+    }
+}
+
+void ShadowMap::apply(Display& gfx, const Mat4& viewMatrix, const Mat4& projMatrix, const QRect& area, JobSystem& jobSystem)
+{
+    if (!_valid)
+        return;
+
+    QRect rect = area.intersected(QRect(0, 0, gfx.width(), gfx.height()));
+    if (rect.isEmpty())
+        return;
+
+    // Camera Space to the map
+    Mat4 lookup = _lightMatrix * rigidInverse(viewMatrix);
+
+    // from NDC back to Camera Space at w = 1: the inverse of the scales of the projection
+    float ndcToViewX = 1.f / projMatrix.m[0][0];
+    float ndcToViewY = 1.f / projMatrix.m[1][1];
+
+    jobSystem.parallelFor(rect.height(), SHADOW_ROWS_PER_JOB, [&](unsigned int begin, unsigned int end)
+    {
+        _applyRows(gfx, lookup, ndcToViewX, ndcToViewY, rect, rect.top() + begin, rect.top() + end);
+    });
+}
+
+void ShadowMap::_applyRows(Display& gfx, const Mat4& lookup, const float& ndcToViewX, const float& ndcToViewY,
+                           const QRect& area, const int& yStart, const int& yEnd)
+{
+    const float halfWidth = gfx.width() / 2.f;
+    const float halfHeight = gfx.height() / 2.f;
+    uint32_t* colorBuffer = gfx.colorBuffer();
+    const float* map = _map.depthBuffer();
+    const int mapStride = _map.stride();
+    const float (*l)[4] = lookup.m;
+
+    float reciprocalW[SHADOW_SPAN];
+
+    for (int y = yStart; y < yEnd; ++y)
+    {
+        // the Y of the screen grows downwards
+        float viewY = (1.f - y / halfHeight) * ndcToViewY;
+        uint32_t* colorRow = &colorBuffer[gfx.stride() * y];
+
+        for (int x1 = area.left(); x1 <= area.right(); x1 += SHADOW_SPAN)
+        {
+            int x2 = std::min(x1 + SHADOW_SPAN, area.right() + 1);
+            gfx.reciprocalW(y, x1, x2, reciprocalW);
+
+            for (int x = x1; x < x2; ++x)
+            {
+                // nothing was drawn on the pixel
+                if (reciprocalW[x - x1] <= 0.f)
+                    continue;
+
+                // the pixel in Camera Space is (viewX * w, viewY * w, w)
+                float w = 1.f / reciprocalW[x - x1];
+                float viewX = (x / halfWidth - 1.f) * ndcToViewX;
+
+                float mapX = (l[0][0] * viewX + l[0][1] * viewY + l[0][2]) * w + l[0][3];
+                float mapY = (l[1][0] * viewX + l[1][1] * viewY + l[1][2]) * w + l[1][3];
+                float mapZ = (l[2][0] * viewX + l[2][1] * viewY + l[2][2]) * w + l[2][3];
+
+                int sx = (int)(mapX + 0.5f);
+                int sy = (int)(mapY + 0.5f);
+                if (sx < 0 || sy < 0 || sx >= _size || sy >= _size)
+                    continue;
+
+                // something is closer to the light: half of the color
+                if (mapZ - SHADOW_BIAS > map[mapStride * sy + sx])
+                    colorRow[x] = (colorRow[x] & 0xFF000000) | ((colorRow[x] >> 1) & 0x007F7F7F);
+            }
+        }
+    }
+}
+
+uint64_t ShadowMap::renders()
+{
+    return _renders;
+}
+
+Display& ShadowMap::display()
+{
+    return _map;
+}
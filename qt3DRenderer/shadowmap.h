@@ -0,0 +1,80 @@
+#pragma once
+#include <vector>
+
+#include <QRect>
+
+#include "mat4.h"
+#include "vec3d.h"
+#include "vec4d.h"
+#include "display.h"
+#include "mesh.h"
+#include "jobsystem.h"
+
+#define SHADOW_MAP_SIZE 1024        // pixels of each side of the shadow map
+#define SHADOW_BIAS 0.002f          // depth (of the [0, 0.5] range of the map) added to a pixel before the test (shadow acne)
+
+
+/* ShadowMap: shadows of a directional light.
+ *
+ * update() renders the depth of the meshes seen from the light into a Display of its own, with an orthographic
+ * projection fitted around all the vertices. The triangles go through the depth-only kernel of the Z-prepass
+ * (Display::drawTriangleDepth()): that kernel interpolates 1/w, so each vertex gets w = 1 / (1 - z) and the depth it
+ * stores is the z of the light, interpolated linearly as an orthographic projection needs.
+ *
+ * apply() is the lookup: once the frame is rasterized, the 1/w of every visible pixel is read back from the depth
+ * buffer, the pixel is moved back to Camera Space, then to the map, and darkened when something is closer to the
+ * light. Each pixel is looked up once no matter how many triangles were drawn on it.
+ *
+ * When the map is cached, update() only renders it again after the light or one of the meshes moved.
+ */
+class ShadowMap
+{
+public:
+    ShadowMap();
+
+    // setSize: the resolution of the map (size x size)
+    void setSize(const int& size);
+
+    /* update: the depth of the meshes seen from a light going towards direction (World Space). A cached map is kept
+     * while the light, the transforms of the meshes and their geometry (Mesh::generation) stay the same. Returns true
+     * when the map was rendered
+     */
+    bool update(const std::vector<Mesh*>& meshes, const Vec3d& direction, const bool& cache);
+
+    /* apply: darken the pixels of area that are in the shadow. gfx holds a frame rendered through viewMatrix and
+     * projMatrix (see Renderer::setProjection()); the rows are split among the threads of jobSystem
+     */
+    void apply(Display& gfx, const Mat4& viewMatrix, const Mat4& projMatrix, const QRect& area, JobSystem& jobSystem);
+
+    // renders: how many times the map was rendered (the updates that weren't cached)
+    uint64_t renders();
+
+    //
+    Display& display();
+
+private:
+    // Caster: what the map of the last update depends on for each mesh
+    struct Caster
+    {
+        uint64_t generation;        // Mesh::generation of the geometry, not its address (paged geometry is reallocated)
+        size_t vertices;
+        Vec3d scale;
+        Vec3d rotation;
+        Vec3d translation;
+    };
+
+    bool _changed(const std::vector<Mesh*>& meshes, const Vec3d& direction);
+    void _render(const std::vector<Mesh*>& meshes, const Vec3d& direction);
+    void _applyRows(Display& gfx, const Mat4& lookup, const float& ndcToViewX, const float& ndcToViewY,
+                    const QRect& area, const int& yStart, const int& yEnd);
+
+    int _size;
+    Display _map;
+    Mat4 _lightMatrix;              // World Space to the map: x, y in pixels of the map and z from 0 (closest) to 0.5
+    bool _valid;                    // the map was rendered at least once
+    uint64_t _renders;
+
+    Vec3d _direction;
+    std::vector<Caster> _casters;
+    std::vector<Vec4d> _lightVertices;  // the vertices of all the meshes in Light Space (kept between renders)
+};
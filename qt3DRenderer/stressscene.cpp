@@ -0,0 +1,168 @@
+#include "stressscene.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+
+#define CHECKER_TEXTURE_SIZE 64
+
+
+// random01: a float in [0, 1) from the next 24 bits of the generator, the same on every standard library
+static float random01(std::mt19937& random)
+{
+    return (random() >> 8) * (1.f / 16777216.f);
+}
+
+// randomColor: an opaque color with every channel between 64 and 255 (never too dark to be seen)
+static uint32_t randomColor(std::mt19937& random)
+{
+    uint32_t r = 64 + (uint32_t)(random01(random) * 192.f);
+    uint32_t g = 64 + (uint32_t)(random01(random) * 192.f);
+    uint32_t b = 64 + (uint32_t)(random01(random) * 192.f);
+    return 0xFF000000 | (r << 16) | (g << 8) | b;
+}
+
+Mesh StressScene::uvSphere(const int& rings, const int& segments)
+{
+    const float PI = 3.14159265358979323846f;
+    Mesh mesh;
+
+    mesh.vertices.push_back(Vec3d(0.f, 1.f, 0.f));
+    for (int r = 1; r < rings; ++r)
+    {
+        float theta = PI * r / rings;
+        for (int s = 0; s < segments; ++s)
+        {
+            float phi = 2.f * PI * s / segments;
+            mesh.vertices.push_back(Vec3d(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi)));
+        }
+    }
+    mesh.vertices.push_back(Vec3d(0.f, -1.f, 0.f));
+
+    // the vertices are shared by all the faces around them (one at each pole), so the meridian where u wraps from 1
+    // back to 0 is a UV seam
+    auto index = [&](int r, int s)
+    {
+        if (r == 0)
+            return 0;
+        if (r == rings)
+            return (int)mesh.vertices.size() - 1;
+        return 1 + (r - 1) * segments + (s % segments);
+    };
+
+    for (int r = 0; r < rings; ++r)
+        for (int s = 0; s < segments; ++s)
+        {
+            int a = index(r, s);            // top-left
+            int b = index(r, s + 1);        // top-right
+            int c = index(r + 1, s);        // bottom-left
+            int d = index(r + 1, s + 1);    // bottom-right
+
+            Tex2 uvA(s / (float)segments, r / (float)rings), uvB((s + 1) / (float)segments, r / (float)rings);
+            Tex2 uvC(s / (float)segments, (r + 1) / (float)rings), uvD((s + 1) / (float)segments, (r + 1) / (float)rings);
+
+            // the triangles that would collapse into the poles are skipped
+            if (r != 0)
+                mesh.faces.push_back(Face(a, b, c, uvA, uvB, uvC, 0xFFFFFFFF));
+            if (r != rings - 1)
+                mesh.faces.push_back(Face(b, d, c, uvB, uvD, uvC, 0xFFFFFFFF));
+        }
+
+    return mesh;
+}
+
+/* sphere: with segments = 2 * rings the sphere has 4 * rings * (rings - 1) faces, so rings is the positive root of
+ * 4r^2 - 4r - triangles = 0 rounded to the nearest integer.
+ */
+Mesh StressScene::sphere(const int& triangles)
+{
+    int rings = std::max((int)std::lround((1.0 + std::sqrt(1.0 + std::max(triangles, 0))) / 2.0), 2);
+    return uvSphere(rings, rings * 2);
+}
+
+std::vector<Mesh> StressScene::instanceGrid(const uint32_t& seed, const Mesh& mesh, const int& columns, const int& rows,
+                                            const float& spacing, const float& distance)
+{
+    const float PI = 3.14159265358979323846f;
+    std::mt19937 random(seed);
+
+    // the geometry shared by all the instances is never modified by the renderer: its bounds and face planes (used to
+    // cull the instances and their backfaces) are computed here once
+    std::shared_ptr<Mesh> geometry = std::make_shared<Mesh>(mesh);
+    geometry->computeBounds();
+    geometry->computeFacePlanes();
+    for (unsigned int l = 0; l < geometry->lods.size(); ++l)
+        geometry->lods[l].computeFacePlanes();
+
+    std::shared_ptr<uint32_t[]> texture = checkerTexture(seed, CHECKER_TEXTURE_SIZE);
+
+    std::vector<Mesh> instances;
+    instances.reserve(columns * rows);
+
+    for (int r = 0; r < rows; ++r)
+        for (int c = 0; c < columns; ++c)
+        {
+            Mesh instance;
+            instance.asset = geometry;
+            instance.setTexture(texture, CHECKER_TEXTURE_SIZE, CHECKER_TEXTURE_SIZE);
+            instance.rotation = Vec3d(random01(random) * 2.f * PI, random01(random) * 2.f * PI, random01(random) * 2.f * PI);
+            instance.translation = Vec3d((c - (columns - 1) / 2.f) * spacing, (r - (rows - 1) / 2.f) * spacing, distance);
+            instances.push_back(instance);
+        }
+
+    return instances;
+}
+
+std::vector<Mesh> StressScene::quadStack(const uint32_t& seed, const int& layers, const float& nearZ, const float& farZ,
+                                         const float& halfWidth, const float& halfHeight, const bool& backToFront)
+{
+    std::mt19937 random(seed);
+    std::shared_ptr<uint32_t[]> texture = checkerTexture(seed, CHECKER_TEXTURE_SIZE);
+
+    // the colors go with the layers, not with the order: both orders give the same image
+    std::vector<uint32_t> colors(layers);
+    for (int layer = 0; layer < layers; ++layer)
+        colors[layer] = randomColor(random);
+
+    std::vector<Mesh> quads;
+    quads.reserve(layers);
+
+    for (int i = 0; i < layers; ++i)
+    {
+        // layer 0 is the nearest one
+        int layer = backToFront ? layers - 1 - i : i;
+        float z = (layers > 1) ? nearZ + (farZ - nearZ) * layer / (layers - 1) : nearZ;
+        float w = halfWidth * z, h = halfHeight * z;
+
+        Mesh quad;
+        quad.vertices.push_back(Vec3d(-w,  h, z));  // top-left
+        quad.vertices.push_back(Vec3d( w,  h, z));  // top-right
+        quad.vertices.push_back(Vec3d(-w, -h, z));  // bottom-left
+        quad.vertices.push_back(Vec3d( w, -h, z));  // bottom-right
+
+        // Clockwise when seen from the origin
+        uint32_t color = colors[layer];
+        quad.faces.push_back(Face(0, 1, 2, Tex2(0.f, 0.f), Tex2(1.f, 0.f), Tex2(0.f, 1.f), color));
+        quad.faces.push_back(Face(1, 3, 2, Tex2(1.f, 0.f), Tex2(1.f, 1.f), Tex2(0.f, 1.f), color));
+
+        quad.computeBounds();
+        quad.setTexture(texture, CHECKER_TEXTURE_SIZE, CHECKER_TEXTURE_SIZE);
+        quads.push_back(quad);
+    }
+
+    return quads;
+}
+
+std::shared_ptr<uint32_t[]> StressScene::checkerTexture(const uint32_t& seed, const int& size)
+{
+    std::mt19937 random(seed);
+    uint32_t colors[2] = { randomColor(random), randomColor(random) };
+
+    std::shared_ptr<uint32_t[]> texture(new uint32_t[size * size]);
+    for (int y = 0; y < size; ++y)
+        for (int x = 0; x < size; ++x)
+            texture[y * size + x] = colors[((x >> 3) ^ (y >> 3)) & 1];
+
+    return texture;
+}
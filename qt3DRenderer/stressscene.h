@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "mesh.h"
+
+
+/* StressScene: procedural scenes to measure how the renderer scales with the number of triangles, meshes and pixels,
+ * without depending on the few models of the assets directory.
+ *
+ * Every scene is built from a seed: the same seed gives the same meshes, transforms, colors and textures on every
+ * machine (the random numbers come from std::mt19937 and are turned into floats here, not by the distributions of the
+ * standard library, which differ between implementations).
+ *
+ *  - sphere(): a tessellated sphere with about N triangles, for geometry-bound workloads;
+ *  - instanceGrid(): a grid of meshes that share the same geometry through Mesh::asset, each with its own rotation;
+ *  - quadStack(): quads stacked in depth that all cover the same area of the screen, for fill and overdraw-bound
+ *    workloads (every layer is drawn over the previous one when the stack is sorted back to front).
+ */
+class StressScene
+{
+public:
+    // uvSphere: a UV sphere of radius 1 with (rings * segments * 2 - segments * 2) faces, Clockwise seen from outside
+    static Mesh uvSphere(const int& rings, const int& segments);
+
+    // sphere: a UV sphere of radius 1 with about the given number of triangles (twice as many segments as rings)
+    static Mesh sphere(const int& triangles);
+
+    // instanceGrid: columns x rows instances of mesh on the plane z = distance, centered on the Z axis and spacing units
+    // apart. The instances share one copy of the geometry, the seed gives them their rotation and a checker texture
+    static std::vector<Mesh> instanceGrid(const uint32_t& seed, const Mesh& mesh, const int& columns, const int& rows,
+                                          const float& spacing, const float& distance);
+
+    /* quadStack: layers quads facing the camera at the origin (looking down +Z), from z = nearZ to z = farZ. The quads
+     * grow with their distance so that all of them cover the area of [-halfWidth, halfWidth] x [-halfHeight, halfHeight]
+     * at z = 1: with halfHeight = tan(fovY / 2) and halfWidth = halfHeight * aspect they fill the whole screen.
+     * backToFront puts the farthest quad first (every layer passes the depth test), otherwise the nearest one is first
+     * (the depth test rejects the pixels of all the other layers). The seed gives the color of each layer.
+     */
+    static std::vector<Mesh> quadStack(const uint32_t& seed, const int& layers, const float& nearZ, const float& farZ,
+                                       const float& halfWidth, const float& halfHeight, const bool& backToFront = true);
+
+    // checkerTexture: a size x size checkerboard of 8x8 texel squares with 2 colors picked by the seed
+    static std::shared_ptr<uint32_t[]> checkerTexture(const uint32_t& seed, const int& size);
+};
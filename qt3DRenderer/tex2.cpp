@@ -1,79 +1,79 @@
-#include "tex2.h"
-
-
-int REDBRICK_WIDTH  = 64;
-int REDBRICK_HEIGHT = 64;
-
-// size in bytes is: 64*64*4 (i.e. 4 bytes per pixel)
-uint8_t REDBRICK_TEXTURE[] = {
-    0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff,
-    0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff,
-    0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff,
-    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x64, 0x64, 0x64, 0xff, 0x64, 0x64, 0x64, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff,
-    0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff,
-    0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff,
-    0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff,
-    0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff,
-    0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff,
-    0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x20, 0x20, 0x20, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff,
-    0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x20, 0x20, 0x20, 0xff, 0x40, 0x40, 0x40, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff,
-    0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x20, 0x20, 0x20, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x40, 0xff,
-    0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x34, 0x34, 0x34, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x34, 0x34, 0x34, 0xff, 0x34, 0x34, 0x34, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x34, 0x34, 0x34, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff,
-    0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff,
-    0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x54, 0x54, 0x54, 0xff, 0x64, 0x64, 0x64, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x54, 0x54, 0x54, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x64, 0x64, 0x64, 0xff, 0x64, 0x64, 0x64, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff,
-    0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff,
-    0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff,
-    0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff,
-    0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x64, 0x64, 0x64, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff,
-    0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x64, 0x64, 0x64, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff,
-    0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff,
-    0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff,
-    0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff,
-    0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x64, 0x64, 0x64, 0xff, 0x54, 0x54, 0x54, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff,
-    0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff,
-    0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x20, 0x20, 0x20, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x20, 0x20, 0x20, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x34, 0x34, 0x34, 0xff, 0x38, 0x38, 0x38, 0xff, 0x34, 0x34, 0x34, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x64, 0x64, 0x64, 0xff, 0x64, 0x64, 0x64, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x30, 0x30, 0x30, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x30, 0x30, 0x30, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff,
-    0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff,
-    0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff,
-    0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x34, 0x34, 0x34, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff,
-    0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff,
-    0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff,
-    0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff,
-    0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff,
-    0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff,
-    0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x20, 0x20, 0x20, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff,
-    0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x34, 0x34, 0x34, 0xff, 0x34, 0x34, 0x34, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
-    0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff,
-    0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff,
-};
-
-Tex2::Tex2(const float& u, const float& v)
-{
-    this->u = u;
-    this->v = v;
-}
+#include "tex2.h"
+
+
+int REDBRICK_WIDTH  = 64;
+int REDBRICK_HEIGHT = 64;
+
+// size in bytes is: 64*64*4 (i.e. 4 bytes per pixel)
+uint8_t REDBRICK_TEXTURE[] = {
+    0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff,
+    0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff,
+    0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff,
+    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x64, 0x64, 0x64, 0xff, 0x64, 0x64, 0x64, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff,
+    0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff,
+    0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff,
+    0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff,
+    0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff,
+    0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff,
+    0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x20, 0x20, 0x20, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff,
+    0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x20, 0x20, 0x20, 0xff, 0x40, 0x40, 0x40, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff,
+    0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x20, 0x20, 0x20, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x40, 0xff,
+    0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x34, 0x34, 0x34, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x34, 0x34, 0x34, 0xff, 0x34, 0x34, 0x34, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x34, 0x34, 0x34, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff,
+    0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff,
+    0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x54, 0x54, 0x54, 0xff, 0x64, 0x64, 0x64, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x54, 0x54, 0x54, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x64, 0x64, 0x64, 0xff, 0x64, 0x64, 0x64, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff,
+    0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff,
+    0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff,
+    0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff,
+    0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x64, 0x64, 0x64, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff,
+    0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x64, 0x64, 0x64, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff,
+    0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff,
+    0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff,
+    0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x40, 0xff,
+    0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x5c, 0x5c, 0x5c, 0xff, 0x64, 0x64, 0x64, 0xff, 0x54, 0x54, 0x54, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff,
+    0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff,
+    0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x20, 0x20, 0x20, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x38, 0x38, 0x38, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x20, 0x20, 0x20, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x34, 0x34, 0x34, 0xff, 0x38, 0x38, 0x38, 0xff, 0x34, 0x34, 0x34, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x64, 0x64, 0x64, 0xff, 0x64, 0x64, 0x64, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x4c, 0x4c, 0x4c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x30, 0x30, 0x30, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x30, 0x30, 0x30, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff,
+    0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xec, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff, 0x00, 0x00, 0xbc, 0xff,
+    0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff,
+    0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x34, 0x34, 0x34, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff,
+    0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff,
+    0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff,
+    0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff,
+    0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xd4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff,
+    0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x98, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x88, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xc8, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x58, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x64, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x70, 0xff,
+    0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x20, 0x20, 0x20, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x00, 0x00, 0xa4, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00, 0x4c, 0xff,
+    0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x34, 0x34, 0x34, 0xff, 0x34, 0x34, 0x34, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x20, 0x20, 0x20, 0xff, 0x2c, 0x2c, 0x2c, 0xff, 0x2c, 0x2c, 0x2c, 0xff,
+    0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x38, 0x38, 0x38, 0xff, 0x54, 0x54, 0x54, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x40, 0x40, 0x40, 0xff, 0x38, 0x38, 0x38, 0xff, 0x40, 0x40, 0x40, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff, 0x48, 0x48, 0x48, 0xff,
+    0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff, 0x54, 0x54, 0x54, 0xff,
+};
+
+Tex2::Tex2(const float& u, const float& v)
+{
+    this->u = u;
+    this->v = v;
+}
@@ -1,782 +1,854 @@
-/* This 3D renderer uses a Left-Handed Coordinate System (LHCS): the Z-value grows (positive) inside the monitor.
- *
- * Also, the winding order of a triangle is Clockwise:
- *
- *      CLOCKWISE: A/B/C           COUNTERCLOCKWISE: A/C/B
- *
- *              B                             B
- *            . o                          . o
- *         .´  '                        .´  '
- *   A o.´  / '                   A o.´    '
- *       `./ '                        `.  '
- *        /`o                           `o
- *       ñ  C                            C
- *
- * The Normal for a triangle in LHCS that points towards the camera would be:
- *      Vec3d(0.f, 0.f, -1.f)
- */
-#include "vec4d.h"
-#include "mat4.h"
-#include "window.h"
-#include "objloader.h"
-#include "tex2.h"
-
-#include <QDateTime>
-#include <QDebug>
-#include <QPainter>
-#include <QThread>
-
-#define PI 3.14159265358979323846
-
-#define WND_WIDTH 1280
-#define WND_HEIGHT 900
-
-#define FPS 200
-#define RENDER_WAIT_MS (1000 / FPS)
-
-#define ASSETS_DIR "C:\\Users\\karlp\\Documents\\workspace\\GraphicsProgramming\\qt3DRenderer\\assets"
-#define WIREFRAME_COLOR 0xFFFFFFFF
-
-
-// global flags
-bool ENABLE_FACE_CULL       = true;
-bool FIX_TEXTURE_DISTORTION = true;
-bool ORBIT_CAMERA           = true;
-
-
-// hex2argb: returns red 0xFF800000 as ARGB QColor(255, 128, 0, 0)
-QColor hex2argb(const uint32_t& c)
-{
-    QColor out = QColor((uint8_t) ((c >> 24) & 0xFF),    // alpha
-                        (uint8_t) ((c >> 16) & 0xFF),    // red
-                        (uint8_t) ((c >> 8)  & 0xFF),    // green
-                        (uint8_t) (c & 0xFF));           // blue
-
-//    qDebug() << "hex2rgba a=" << out.alpha();
-//    qDebug() << "hex2rgba r=" << out.red();
-//    qDebug() << "hex2rgba g=" << out.green();
-//    qDebug() << "hex2rgba b=" << out.blue();
-
-    return out;
-}
-
-Window::Window()
-:_width(WND_WIDTH), _height(WND_HEIGHT), _tick_ms(5)
-{
-    _deltaTime = 0.f;
-    _prevTime = QDateTime::currentMSecsSinceEpoch();
-
-    // resize window
-    resize(_width, _height);
-
-    // setup Display/Color Buffer
-    _gfx.setSize(_width, _height);
-    _gfx.setup();
-
-    /* load 3D model and its texture: initialize _mesh with the vertices and faces of a 3D model */
-
-    // load a hardcoded cube and a predefined texture
-//    Mesh meshCube1 = CubeMesh((const uint32_t*)REDBRICK_TEXTURE, REDBRICK_WIDTH, REDBRICK_HEIGHT);
-//    meshCube1.scale = Vec3d(1.f, 1.f, 1.f);
-//    meshCube1.translation = Vec3d(-3.f, 0.f, 5.f);
-//    _meshObjects.push_back(meshCube1);
-
-    // load a cube mesh from an .obj file using a custom texture
-//    QImage texImageCube = QImage(QString(ASSETS_DIR) + "\\cube.png").convertToFormat(QImage::Format_ARGB32);
-//    Mesh meshCube2 = OBJLoader(std::string(ASSETS_DIR) + "\\cube.obj").mesh();
-//    meshCube2.setTexture(reinterpret_cast<uint32_t*>(texImageCube.bits()), texImageCube.width(), texImageCube.height());
-//    meshCube2.scale = Vec3d(1.f, 1.f, 1.f);
-//    meshCube2.translation = Vec3d(+3.f, 0.f, 5.f);
-//    _meshObjects.push_back(meshCube2);
-
-    // load the Runway
-    QImage texImageRunway = QImage(QString(ASSETS_DIR) + "\\runway.png").convertToFormat(QImage::Format_ARGB32);
-    Mesh meshRunway = OBJLoader(std::string(ASSETS_DIR) + "\\runway.obj").mesh();
-    meshRunway.setTexture(reinterpret_cast<uint32_t*>(texImageRunway.bits()), texImageRunway.width(), texImageRunway.height());
-    meshRunway.scale = Vec3d(1.f, 1.f, 1.f);
-    meshRunway.translation = Vec3d(0.f, -1.5f, 23.f);
-    _meshObjects.push_back(meshRunway);
-
-    // load the F22
-    QImage texImageF22 = QImage(QString(ASSETS_DIR) + "\\f22.png").convertToFormat(QImage::Format_ARGB32);
-    Mesh meshF22 = OBJLoader(std::string(ASSETS_DIR) + "\\f22.obj").mesh();
-    meshF22.setTexture(reinterpret_cast<uint32_t*>(texImageF22.bits()), texImageF22.width(), texImageF22.height());
-    meshF22.scale = Vec3d(1.f, 1.f, 1.f);
-    meshF22.translation = Vec3d(0.f, -1.3f, 5.f);
-    meshF22.rotation = Vec3d(0.f, -PI/2.f, 0.f); // rotate 90º
-    _meshObjects.push_back(meshF22);
-
-    // load the EFA aircraft
-    QImage texImageEFA = QImage(QString(ASSETS_DIR) + "\\efa.png").convertToFormat(QImage::Format_ARGB32);
-    Mesh meshEFA = OBJLoader(std::string(ASSETS_DIR) + "\\efa.obj").mesh();
-    meshEFA.setTexture(reinterpret_cast<uint32_t*>(texImageEFA.bits()), texImageEFA.width(), texImageEFA.height());
-    meshEFA.scale = Vec3d(1.f, 1.f, 1.f);
-    meshEFA.translation = Vec3d(-2.f, -1.3f, 9.f);
-    meshEFA.rotation = Vec3d(0.f, -PI/2.f, 0.f); // rotate 90º
-    _meshObjects.push_back(meshEFA);
-
-    // load the F117
-    QImage texImageF117 = QImage(QString(ASSETS_DIR) + "\\f117.png").convertToFormat(QImage::Format_ARGB32);
-    Mesh meshF117 = OBJLoader(std::string(ASSETS_DIR) + "\\f117.obj").mesh();
-    meshF117.setTexture(reinterpret_cast<uint32_t*>(texImageF117.bits()), texImageF117.width(), texImageF117.height());
-    meshF117.scale = Vec3d(1.f, 1.f, 1.f);
-    meshF117.translation = Vec3d(+2.f, -1.3f, 9.f);
-    meshF117.rotation = Vec3d(0.f, -PI/2.f, 0.f); // rotate 90º
-    _meshObjects.push_back(meshF117);
-
-    // load the Crab
-//    QImage texImageCrab = QImage(QString(ASSETS_DIR) + "\\crab.png").convertToFormat(QImage::Format_ARGB32);
-//    Mesh meshCrab = OBJLoader(std::string(ASSETS_DIR) + "\\crab.obj").mesh();
-//    meshCrab.setTexture(reinterpret_cast<uint32_t*>(texImageCrab.bits()), texImageCrab.width(), texImageCrab.height());
-//    meshCrab.scale = Vec3d(1.f, 1.f, 1.f);
-//    meshCrab.translation = Vec3d(0.f, 2.f, 6.f);
-//    _meshObjects.push_back(meshCrab);
-
-    // load the Drone
-//    QImage texImageDrone = QImage(QString(ASSETS_DIR) + "\\drone.png").convertToFormat(QImage::Format_ARGB32);// load a Drone
-//    Mesh meshDrone = OBJLoader(std::string(ASSETS_DIR) + "\\drone.obj").mesh();
-//    meshDrone.setTexture(reinterpret_cast<uint32_t*>(texImageDrone.bits()), texImageDrone.width(), texImageDrone.height());
-//    meshDrone.scale = Vec3d(1.f, 1.f, 1.f);
-//    meshDrone.translation = Vec3d(0.f, 0.f, 6.f);
-//    _meshObjects.push_back(meshDrone);
-
-    // initialize light source: in LHCS, Z grows positive towards inside the monitor (i.e. away from the camera)
-    _lightSource.direction = Vec3d(0, 0, 1);
-
-    // initialize camera position
-    _camera.position = Vec3d(0, 0, 0);  // placed at the origin
-    _camera.direction = Vec3d(0, 0, 1); // looking at positive Z-axis
-
-    // define the initial orbit angle of the camera and its distance from the target
-    _cameraOrbitAngle = 270.f;
-    _cameraOrbitDistance = 7.f;
-
-    // initialize default rendering mode
-    _renderMode = RENDER_MODE::WIREFRAME; // TRIANGLES
-
-    /* initialize projection matrix */
-
-    float arX = _width / (float)_height;    // horizontal Aspect Ratio
-    float arY = _height / (float)_width;    // vertical Aspect Ratio
-    float fovY = (float)PI / 3.f;           // 60º is 180/3 which is equivalent to PI/3 in radians
-    float fovX = std::atan(std::tan(fovY / 2.f) * arX) * 2;
-    float zNear = 1.0f;
-    float zFar = 100.f;
-    _projMatrix = Mat4::perspective(fovY, arY, zNear, zFar);
-
-    /* initialize frustum planes for Clipping operation */
-
-    _initFrustumPlanes(fovX, fovY, zNear, zFar);
-
-    /* start timer to draw frames */
-
-    _timer = new QTimer();
-    _timer->start(_tick_ms);
-    QObject::connect(_timer, SIGNAL(timeout()), this, SLOT(_tick()));    
-
-    qDebug() << "Window::Window:           ORBIT_CAMERA=" << ORBIT_CAMERA;
-    qDebug() << "Window::Window:       ENABLE_FACE_CULL=" << ENABLE_FACE_CULL;
-    qDebug() << "Window::Window: FIX_TEXTURE_DISTORTION=" << FIX_TEXTURE_DISTORTION;
-}
-
-Window::~Window()
-{
-}
-
-void Window::_tick()
-{
-    // trigger paint event to redraw the window
-    update();
-}
-
-void Window::_renderColorBuffer(QPainter& p)
-{
-    //qDebug() << "Window::_renderColorBuffer";
-
-    _framebuffer = QImage((const uchar*)(_gfx.colorBuffer()), _gfx.width(), _gfx.height(), QImage::Format_ARGB32);
-//    if (!_framebuffer.save("framebuffer.jpg"))
-//        qDebug() << "_renderColorBuffer!!! image";
-
-    // scale 3D screen to the window size if necessary
-    if (_gfx.width() != _width || _gfx.height() != _height)
-    {
-        _framebuffer = _framebuffer.scaled(_width, _height, Qt::KeepAspectRatioByExpanding, Qt::SmoothTransformation);
-    }
-
-    p.drawImage(QPoint(0, 0), _framebuffer);
-}
-
-/* Frustum planes are defined by a point and a normal vector
- */
-void Window::_initFrustumPlanes(const float& fovX, const float& fovY, const float& zNear, const float& zFar)
-{
-//    printf("init_frustum_planes: fovX=%.2f  fovY=%.2f  z_near=%.2f  z_zfar=%.2f\n", fovX, fovY, zNear, zFar);
-
-    float cosHalfFovX = std::cos(fovX/2.f);
-    float sinHalfFovX = std::sin(fovX/2.f);
-    float cosHalfFovY = std::cos(fovY/2.f);
-    float sinHalfFovY = std::sin(fovY/2.f);
-
-//    printf("init_frustum_planes: cosHalfFovX=%.2f  sinHalfFovX=%.2f\n", cosHalfFovX, sinHalfFovX);
-//    printf("init_frustum_planes: cosHalfFovY=%.2f  sinHalfFovY=%.2f\n", cosHalfFovY, sinHalfFovY);
-
-    Vec3d origin(0.f, 0.f, 0.f);
-
-    _frustumPlanes[FRUSTUM_PLANE::LEFT].point = origin;
-    _frustumPlanes[FRUSTUM_PLANE::LEFT].normal.x = cosHalfFovX;
-    _frustumPlanes[FRUSTUM_PLANE::LEFT].normal.y = 0;
-    _frustumPlanes[FRUSTUM_PLANE::LEFT].normal.z = sinHalfFovX;
-//    std::cout << "init_frustum_planes: LEFT point=" << _frustumPlanes[FRUSTUM_PLANE::LEFT].point << "  normal=" << _frustumPlanes[FRUSTUM_PLANE::LEFT].normal << std::endl;
-
-    _frustumPlanes[FRUSTUM_PLANE::RIGHT].point = origin;
-    _frustumPlanes[FRUSTUM_PLANE::RIGHT].normal.x = -cosHalfFovX;
-    _frustumPlanes[FRUSTUM_PLANE::RIGHT].normal.y = 0;
-    _frustumPlanes[FRUSTUM_PLANE::RIGHT].normal.z = sinHalfFovX;
-//    std::cout << "init_frustum_planes: RIGHT point=" << _frustumPlanes[FRUSTUM_PLANE::RIGHT].point << "  normal=" << _frustumPlanes[FRUSTUM_PLANE::RIGHT].normal << std::endl;
-
-    _frustumPlanes[FRUSTUM_PLANE::TOP].point = origin;
-    _frustumPlanes[FRUSTUM_PLANE::TOP].normal.x = 0;
-    _frustumPlanes[FRUSTUM_PLANE::TOP].normal.y = -cosHalfFovY;
-    _frustumPlanes[FRUSTUM_PLANE::TOP].normal.z = sinHalfFovY;
-//    std::cout << "init_frustum_planes: TOP point=" << _frustumPlanes[FRUSTUM_PLANE::TOP].point << "  normal=" << _frustumPlanes[FRUSTUM_PLANE::TOP].normal << std::endl;
-
-    _frustumPlanes[FRUSTUM_PLANE::BOTTOM].point = origin;
-    _frustumPlanes[FRUSTUM_PLANE::BOTTOM].normal.x = 0;
-    _frustumPlanes[FRUSTUM_PLANE::BOTTOM].normal.y = cosHalfFovY;
-    _frustumPlanes[FRUSTUM_PLANE::BOTTOM].normal.z = sinHalfFovY;
-//    std::cout << "init_frustum_planes: BOTTOM point=" << _frustumPlanes[FRUSTUM_PLANE::BOTTOM].point << "  normal=" << _frustumPlanes[FRUSTUM_PLANE::BOTTOM].normal << std::endl;
-
-    _frustumPlanes[FRUSTUM_PLANE::NEAR].point = Vec3d(0.f, 0.f, zNear);
-    _frustumPlanes[FRUSTUM_PLANE::NEAR].normal.x = 0;
-    _frustumPlanes[FRUSTUM_PLANE::NEAR].normal.y = 0;
-    _frustumPlanes[FRUSTUM_PLANE::NEAR].normal.z = 1;
-//    std::cout << "init_frustum_planes: NEAR point=" << _frustumPlanes[FRUSTUM_PLANE::NEAR].point << "  normal=" << _frustumPlanes[FRUSTUM_PLANE::NEAR].normal << std::endl;
-
-    _frustumPlanes[FRUSTUM_PLANE::FAR].point = Vec3d(0.f, 0.f, zFar);
-    _frustumPlanes[FRUSTUM_PLANE::FAR].normal.x = 0;
-    _frustumPlanes[FRUSTUM_PLANE::FAR].normal.y = 0;
-    _frustumPlanes[FRUSTUM_PLANE::FAR].normal.z = -1;
-//    std::cout << "init_frustum_planes: FAR point=" << _frustumPlanes[FRUSTUM_PLANE::FAR].point << "  normal=" << _frustumPlanes[FRUSTUM_PLANE::FAR].normal << std::endl;
-}
-
-void Window::resizeEvent(QResizeEvent* event)
-{
-    Q_UNUSED(event)
-
-    qDebug() << "Window::resizeEvent: " << width() << "x" << height();
-
-    if (width() != _width || height() != _height)
-    {
-        _width = width();
-        _height = height();
-
-        // setup color buffer again
-        _gfx.setSize(_width, _height);
-
-        // trigger paintEvent
-        update();
-    }
-}
-
-void Window::paintEvent(QPaintEvent* e)
-{
-    //qDebug() << "Window::paintEvent";
-
-    if (!_gfx.colorBuffer())
-        qDebug() << "paintEvent: null color buffer";
-
-    QPainter painter(this);
-
-    /* update: linear transforms, perspective projection */
-
-    updt();
-
-    /* render  */
-
-    render(painter);
-
-    QWidget::paintEvent(e);
-}
-
-/* _processGraphicsPipeline: passes a mesh through each state of the Graphics Pipeline:
- *
- * Current stages of the Graphics Pipeline:
- *  + Model Space: a 3D Mesh (vertices) starts in the Model Space (in its own original local coordinate system: Blender, Maya, ...)
- *
- *  + World Space: vertices from the previous stage are multiplied by the World Matrix to be in the World Space (scale, translation, rotation)
- *
- *  + Camera Space: vertices from the previous stag are multiplied by the View Matrix to be in View/Camera Space
- *    (the Eye becomes the new origin of the Camera and everything in the world is scaled/translated/rotated
- *     so that we see things from the Camera Eye point of view)
- *
- * + Backface Culling: a Hidden Surface Removal technique is executed in Camera Space to discard the faces that are looking
- *   away from the camera
- *
- * + Clipping: then Frustum Clipping is executed to get rid of the vertices that are not inside the 6 frustum planes
- *
- * + Projection: the surviving vertices are multiplied by the Perspective Projection Matrix
- *
- * + Image Space (NDC): finally, the projected vertices pass through Perspective Divide to be transformed into Screen Space
- *   NDC: Normalized Device Coordinates:
- *          +1
- *      ---------
- *   -1 |       | +1
- *      |       |
- *      ---------
- *          -1
- *
- *   Note: as an alternative to clipping in Camera Space (Frustum Clipping), Homogeneous Clipping could be done in Image Space (NDC).
- *
- * + Screen Space: the verte is translated into the middle of the screen for rendering and things are ready to be rasterized
- *   and have proper X,Y coordinates within the bounds of the monitor to be
- */
-void Window::_processGraphicsPipeline(Mesh* mesh)
-{
-    // create a scale matrix that will be used to multiply the mesh vertices
-    Mat4 scaleMatrix = Mat4::scale(mesh->scale.x, mesh->scale.y, mesh->scale.z);
-
-    // create a translation matrix that will be used to multiply the mesh vertices
-    Mat4 translationMatrix = Mat4::translate(mesh->translation.x, mesh->translation.y, mesh->translation.z);
-
-    // create a translation matrix that will be used to multiply the mesh vertices
-    Mat4 rotationMatrixX = Mat4::rotateX(mesh->rotation.x);
-    Mat4 rotationMatrixY = Mat4::rotateY(mesh->rotation.y);
-    Mat4 rotationMatrixZ = Mat4::rotateZ(mesh->rotation.z);
-
-    // loop through faces: for each face (triangle), use the vertex index on the face to get the corresponding vertices
-    for (unsigned int f = 0; f < mesh->faces.size(); ++f)
-    {
-//        if (f != 4) // front face for cube.obj
-//            continue;
-
-        // for each triangle face, get the 3 vertices that define it
-        Face face = mesh->faces[f];
-        Vec3d v1 = mesh->vertices[face.a]; // face.a - 1 hols the index of the 1st vertice of the face
-        Vec3d v2 = mesh->vertices[face.b]; // face.b - 1 hols the index of the 2nd vertice of the face
-        Vec3d v3 = mesh->vertices[face.c]; // face.c - 1 hols the index of the 3rd vertice of the face
-        Vec3d faceVertices[3] = { v1, v2, v3 };
-
-//        printf("face #%d v1=%.1f %.1f %.1f \tv2=%.1f %.1f %.1f \tv3=%.1f %.1f %.1f\n", f,
-//                faceVertices[0].x, faceVertices[0].y, faceVertices[0].z,
-//                faceVertices[1].x, faceVertices[1].y, faceVertices[1].z,
-//                faceVertices[2].x, faceVertices[2].y, faceVertices[2].z);
-
-        // array to store the transformed vertices: A, B, C
-        Vec4d transformedVertices[3];
-
-        // loop through all the 3 vertices of the face and apply transformations
-        for (unsigned int v = 0; v < 3; ++v)
-        {
-            //std::cout << "faceVertices[v]=" << faceVertices[v] << std::endl;
-
-            Vec4d transformedVertex = Vec3d::toVec4d(faceVertices[v]); // converts Vec3d to Vec4d
-
-            /* To transform the vertices to World Space, the order of the linear transforms matter:
-             *  1. Scale
-             *  2. Rotate                   [T] * [R] * [S] * v
-             *  3. Translate
-             */
-
-            // Create the World Matrix combining Scale, Rotation and Translation matrices
-            Mat4 worldMatrix = Mat4::eye();
-            worldMatrix = scaleMatrix * worldMatrix;
-            worldMatrix = rotationMatrixZ * worldMatrix;
-            worldMatrix = rotationMatrixY * worldMatrix;
-            worldMatrix = rotationMatrixX * worldMatrix;
-            worldMatrix = translationMatrix * worldMatrix;
-
-            // finally, transform the vertex to World Space
-            transformedVertex = transformedVertex * worldMatrix;
-
-            // convert the scene (vertices) from World Space to View/Camera Space
-            transformedVertex = transformedVertex * _viewMatrix;
-
-            // save each transformed vertex
-            transformedVertices[v] = transformedVertex;
-        }
-
-        /* Check for Backface culling: do not draw back-faces
-         *
-         *          A
-         *        /   \
-         *      /      \
-         *    B - - - - C
-         *
-         *  1. Find vectors B-A and C-A
-         *  2. Take their cross product and find the perpendicular normal
-         *  3. Find the camera ray vector by subtracting the camera position from point A
-         *  4. Take the dot product between the normal N and the camera ray
-         *  5. If this dot product is less than zero, then DO NOT display the face
-         */
-
-        // calculate the Normal vector of the Face
-        Vec3d faceNormal = Vec4d::normal(transformedVertices[0], transformedVertices[1], transformedVertices[2]);
-
-        // check if this face is looking away from the camera and then abort its rendering
-        if (ENABLE_FACE_CULL)
-        {
-            // 3. Find the camera ray vector by subtracting the camera position from point A
-            Vec3d origin;
-            Vec3d cameraRay = origin - Vec4d::toVec3d(transformedVertices[0]);
-
-            // 4. Take the dot product between the normal N and the camera ray
-            float dotNormalCamera = faceNormal.dot(cameraRay); // alignment
-
-            // 5. If this dot product is less than zero, then DO NOT display the face
-            if (dotNormalCamera < 0)
-                continue;
-        }
-
-        /* Check for Frustum Clipping: clip the face when part of it is outside the viewing frustum
-         *
-         * Make sure the face is inside the viewing Frustum and clip its mesh if necessary
-         * to avoid crashes. Clipping a polygon might result in even more vertices.
-         */
-
-        Polygon poly(Vec4d::toVec3d(transformedVertices[0]),
-                     Vec4d::toVec3d(transformedVertices[1]),
-                     Vec4d::toVec3d(transformedVertices[2]),
-                     face.a_uv,
-                     face.b_uv,
-                     face.c_uv);
-
-//        printf("polygon v1=%.1f %.1f %.1f \tv2=%.1f %.1f %.1f \tv3=%.1f %.1f %.1f\n",
-//                transformedVertices[0].x, transformedVertices[0].y, transformedVertices[0].z,
-//                transformedVertices[1].x, transformedVertices[1].y, transformedVertices[1].z,
-//                transformedVertices[2].x, transformedVertices[2].y, transformedVertices[2].z);
-
-        poly.clip(_frustumPlanes);
-
-        // after clipping, break the Polygon down into Triangles
-        std::vector<Triangle> triangles = poly.triangles();
-        //std::cout << "triangles.size()=" << triangles.size() << std::endl;
-
-        /* Projection: project each of the 3D vertex of a Triangle into their 2D screen representation using Perspective Projection */
-
-        // loop all triangles after clipping
-        for (unsigned int t = 0; t < triangles.size(); ++t)
-        {
-            Triangle triangle = triangles[t];
-
-            Vec4d projectedPoints[3];
-
-            for (unsigned int v = 0; v < 3; ++v)
-            {
-                /* Projection stage */
-
-                // 1st step: multiply the projection matrix by the original 3D vertex. Converts from View/Camera Space to Screen Space
-                projectedPoints[v] = triangle.points[v] * _projMatrix;
-
-                // 2nd step: perspective divide with original Z-value now stored in W (things that are furthest away look smaller)
-                // the coordinates after perspective divide are called NDC (normalized device coordinates)
-                if (projectedPoints[v].w != 0.0)
-                {
-                    projectedPoints[v].x /= projectedPoints[v].w;
-                    projectedPoints[v].y /= projectedPoints[v].w;
-                    projectedPoints[v].z /= projectedPoints[v].w;
-                }
-
-                /* Things are now in Screen Space */
-
-                // flip vertically: the Y values from the OBJ file grow in the bottom-up direction, the higher you go,
-                // the more positive they are. However, the screen is draw top-bottom since origin (0,0) is on the top-left.
-                projectedPoints[v].y *= -1;
-
-                // scale into the view
-                projectedPoints[v].x *= _gfx.width() / 2.f;
-                projectedPoints[v].y *= _gfx.height() / 2.f;
-
-                // translate them to the center of the screen
-                projectedPoints[v].x += _gfx.width() / 2.f;
-                projectedPoints[v].y += _gfx.height() / 2.f;
-            }
-
-
-            /* Flat Shading: a per face process that calculates the final triangle color using the face.color or
-             * the texture (if there's one), and compute the direction of the light source.
-             * Brighter or Darker, depends on how align that Face Normal is with the inverse of the light ray.
-             */
-            float lightIntensityFactor = -faceNormal.dot(_lightSource.direction);
-            uint32_t triangleColor = Light::calcIntensity(face.color, lightIntensityFactor);
-
-            // assemble a projected 4D triangle for a 2D screen: Triangle(Vec4d, Vec4d, Vec4d, color, depth);
-            Triangle projectedTriangle = { projectedPoints[0], projectedPoints[1], projectedPoints[2],
-                                           triangle.texCoords[0], triangle.texCoords[1], triangle.texCoords[2],
-                                           mesh->texture, mesh->textureWidth, mesh->textureHeight,
-                                           triangleColor };
-
-            // save the projected triangle in the array of triangles that need to be rendered
-            _triangles2render.push_back(projectedTriangle);
-        }
-
-    } // mesh->faces.size()
-}
-
-/* updt: updates animations and object position on the screen
- */
-void Window::updt()
-{
-    // waste a few milliseconds until enough time has passed to update the new frame
-    qint64 curTime = QDateTime::currentMSecsSinceEpoch();
-    qint64 time2wait = RENDER_WAIT_MS - (curTime - _prevTime);
-
-    if (time2wait > 0 && time2wait < RENDER_WAIT_MS)
-        QThread::msleep(time2wait); // delay
-
-    // calculate delta time: how much time passed since the last frame?
-    curTime = QDateTime::currentMSecsSinceEpoch();
-    _deltaTime = (curTime - _prevTime) / 1000.f; // convert to seconds
-    //std::cout << "curTime - _prevTime=" << curTime - _prevTime << " (ms)" << std::endl;
-    //std::cout << "          deltaTime=" << deltaTime << " (s)" << std::endl;
-
-    // update prevTime for the next frame
-    _prevTime = curTime;
-
-    // clear the list of previous projected points
-    _triangles2render.clear();
-
-    /* create the view matrix to look at a target point */
-
-    static Vec3d target = _camera.lookAtTarget();
-    Vec3d upVector(0, 1, 0);
-
-    // update camera position to orbit around the scene
-    if (ORBIT_CAMERA)
-    {
-        // define where the camera should orbit around
-        target = Vec3d(0.f, 0.f, 7.f);
-
-        // increase 15 degrees per second
-        _cameraOrbitAngle += 15.f * _deltaTime;
-
-        _camera.position.x = target.x + _cameraOrbitDistance * std::cos(_cameraOrbitAngle * (PI / 180.f));
-        _camera.position.z = target.z + _cameraOrbitDistance * std::sin(_cameraOrbitAngle * (PI / 180.f));
-
-        if (_cameraOrbitAngle > 359.f)
-            _cameraOrbitAngle = 0.f;
-    }
-
-    _viewMatrix = Mat4::lookAt(_camera.position,     // eye
-                               target,               // where the camera is looking at (i.e. the direction of the camera)
-                               upVector);            // up vector
-
-    for (unsigned int m = 0; m < _meshObjects.size(); ++m)
-    {
-        Mesh* mesh = &_meshObjects[m];
-
-        // adjust Scale/Rotation/Translation for all the meshes
-        //mesh->rotation.x += 0.6f * _deltaTime;
-        //mesh->rotation.y += 0.3f * _deltaTime;
-        //mesh->rotation.z += 0.0f * _deltaTime;
-        //mesh->scale.x += 0.002f;
-        //mesh->scale.y += 0.001f;
-        //mesh->translation.x += 0.01 * _deltaTime;
-        //mesh->translation.z = 5.0;  // translate point away from the camera
-
-        // pass the mesh through the graphics pipeline stages
-        _processGraphicsPipeline(mesh);
-    }
-}
-
-void Window::render(QPainter& p)
-{
-    //qDebug() << "Window::render";
-
-    // clear the buffer with a solid color
-    _gfx.clearColorBuffer(0xFF000000); // black=0xFF000000, white=0xFFFFFFFF
-
-    // clear the depth buffer
-    _gfx.clearDepthBuffer(1.0f);
-
-    // draw background grid
-    _gfx.drawGrid();
-
-    /* loop projected triangles and render them
-     *
-     * The loop below simply iterates through every triangle drawing them on the screen without respecting their Z order:
-     *      for (unsigned int i = 0; i < _triangles2render.size(); ++i) {
-     *          Triangle triangle = _triangles2render[i];
-     *          _gfx.drawTriangle(triangle.points[0].x, triangle.points[0].y,
-     *                            triangle.points[1].x, triangle.points[1].y,
-     *                            triangle.points[2].x, triangle.points[2].y,
-     *                            triangle.color);
-     *      }
-     *
-     * A simple solution for the psychodelic problem that it creates is the Painter's Algorithm
-     * which painst the triangles that are furthest away first:
-     *  - Average the Z coord of all the 3 vertices of a Triangle and assume that is the depth of a face
-     */
-    for (unsigned int i = 0; i < _triangles2render.size(); ++i) // with face culling enabled, size=2 for a cube that has no rotation
-    {
-        Triangle triangle = _triangles2render[i];
-
-        // debug: since the triangles are sorted by their Z value, render just the first 2 for the front face
-        //if  (i != 0 && i != 1)
-        //    continue;
-
-        switch (_renderMode)
-        {
-            case RENDER_MODE::WIREFRAME:
-                // connect the vertices (wireframe, unfilled)
-                _gfx.drawTriangle(triangle.points[0].x, triangle.points[0].y,
-                                  triangle.points[1].x, triangle.points[1].y,
-                                  triangle.points[2].x, triangle.points[2].y,
-                                  WIREFRAME_COLOR);
-                break;
-
-            case RENDER_MODE::WIREFRAME_DOTS:
-                // connect the vertices (wireframe, unfilled)
-                _gfx.drawTriangle(triangle.points[0].x, triangle.points[0].y,
-                                  triangle.points[1].x, triangle.points[1].y,
-                                  triangle.points[2].x, triangle.points[2].y,
-                                  WIREFRAME_COLOR);
-
-                // draw small dots points for each vertex (yellow)
-                _gfx.drawRect(triangle.points[0].x, triangle.points[0].y, 6, 6, 0xFF00FFFF);
-                _gfx.drawRect(triangle.points[1].x, triangle.points[1].y, 6, 6, 0xFF00FFFF);
-                _gfx.drawRect(triangle.points[2].x, triangle.points[2].y, 6, 6, 0xFF00FFFF);
-                break;
-
-            case RENDER_MODE::TRIANGLES:
-                // draw the vertices (filled)
-                _gfx.fillTriangle(triangle.points[0], triangle.points[1], triangle.points[2], triangle.color);
-                break;
-
-            case RENDER_MODE::TRIANGLES_WIREFRAME:
-                // draw the vertices (filled)
-                _gfx.fillTriangle(triangle.points[0], triangle.points[1], triangle.points[2], triangle.color);
-
-                // connect the vertices (wireframe, unfilled)
-                _gfx.drawTriangle(triangle.points[0].x, triangle.points[0].y,
-                                  triangle.points[1].x, triangle.points[1].y,
-                                  triangle.points[2].x, triangle.points[2].y,
-                                  WIREFRAME_COLOR);
-                break;
-
-            case RENDER_MODE::TEXTURED:
-                _gfx.drawTexturedTriangle(triangle.points[0], triangle.points[1], triangle.points[2],
-                                          triangle.texCoords[0], triangle.texCoords[1], triangle.texCoords[2],
-                                          triangle.texture.get(), triangle.textureWidth, triangle.textureHeight,
-                                          FIX_TEXTURE_DISTORTION);
-                break;
-
-            case RENDER_MODE::TEXTURED_WIREFRAME:
-                _gfx.drawTexturedTriangle(triangle.points[0], triangle.points[1], triangle.points[2],
-                                          triangle.texCoords[0], triangle.texCoords[1], triangle.texCoords[2],
-                                          triangle.texture.get(), triangle.textureWidth, triangle.textureHeight,
-                                          FIX_TEXTURE_DISTORTION);
-
-                // connect the vertices (wireframe, unfilled)
-                _gfx.drawTriangle(triangle.points[0].x, triangle.points[0].y,
-                                  triangle.points[1].x, triangle.points[1].y,
-                                  triangle.points[2].x, triangle.points[2].y,
-                                  WIREFRAME_COLOR);
-                break;
-
-            default:
-                qDebug() << "Window::render !!! Unknown render mode";
-                break;
-        }
-
-    }
-
-    // copy Color Buffer to "texture" so that it can be draw on the screen
-    _renderColorBuffer(p);
-}
-
-void Window::keyPressEvent(QKeyEvent* event)
-{
-    switch (event->key())
-    {
-        case Qt::Key_Escape:
-            qDebug() << "keyPressEvent: ESC";
-            exit(0);
-            break;
-
-        /* rendering mode */
-
-        case Qt::Key_1:
-            qDebug() << "keyPressEvent: RENDER_MODE::WIREFRAME";
-            _renderMode = RENDER_MODE::WIREFRAME;
-            break;
-
-        case Qt::Key_2:
-            qDebug() << "keyPressEvent: RENDER_MODE::WIREFRAME_DOTS";
-            _renderMode = RENDER_MODE::WIREFRAME_DOTS;
-            break;
-
-        case Qt::Key_3:
-            qDebug() << "keyPressEvent: RENDER_MODE::TRIANGLES";
-            _renderMode = RENDER_MODE::TRIANGLES;
-            break;
-
-        case Qt::Key_4:
-            qDebug() << "keyPressEvent: RENDER_MODE::TRIANGLES_WIREFRAME";
-            _renderMode = RENDER_MODE::TRIANGLES_WIREFRAME;
-            break;
-
-        case Qt::Key_5:
-            ENABLE_FACE_CULL = !ENABLE_FACE_CULL;
-            qDebug() << "keyPressEvent: ENABLE_FACE_CULL=" << ENABLE_FACE_CULL;
-            break;
-
-        case Qt::Key_6:
-            qDebug() << "keyPressEvent: RENDER_MODE::TEXTURED";
-            _renderMode = RENDER_MODE::TEXTURED;
-            break;
-
-        case Qt::Key_7:
-            qDebug() << "keyPressEvent: RENDER_MODE::TEXTURED_WIREFRAME";
-            _renderMode = RENDER_MODE::TEXTURED_WIREFRAME;
-            break;
-
-        case Qt::Key_T:
-            FIX_TEXTURE_DISTORTION = !FIX_TEXTURE_DISTORTION;
-            qDebug() << "keyPressEvent: FIX_TEXTURE_DISTORTION=" << FIX_TEXTURE_DISTORTION;
-            break;
-
-        /* camera movement */
-
-        case Qt::Key_O:
-            ORBIT_CAMERA = !ORBIT_CAMERA;
-            qDebug() << "keyPressEvent: ORBIT_CAMERA=" << ORBIT_CAMERA;
-            break;
-
-        case Qt::Key_W:
-            qDebug() << "keyPressEvent: W";
-            _camera.rotatePitch(+1.0f * _deltaTime);
-            break;
-
-        case Qt::Key_S:
-            qDebug() << "keyPressEvent: S";
-            _camera.rotatePitch(-1.0f * _deltaTime);
-            break;
-
-        case Qt::Key_Up:
-            qDebug() << "keyPressEvent: Up";
-            _camera.forwardVelocity = _camera.direction * 5.f * _deltaTime;
-            _camera.position = _camera.position + _camera.forwardVelocity;
-            break;
-
-        case Qt::Key_Down:
-            qDebug() << "keyPressEvent: Down";
-            _camera.forwardVelocity = _camera.direction * 5.f * _deltaTime;
-            _camera.position = _camera.position - _camera.forwardVelocity;
-            break;
-
-        case Qt::Key_Right:
-            qDebug() << "keyPressEvent: RIGHT";
-            //_camera.yaw += 1.0f * _deltaTime;
-            _camera.rotateYaw(+1.0f * _deltaTime);
-            break;
-
-        case Qt::Key_Left:
-            qDebug() << "keyPressEvent: LEFT";
-            //_camera.yaw -= 1.0f * _deltaTime;
-            _camera.rotateYaw(-1.0f * _deltaTime);
-            break;
-
-        default:
-            break;
-    }
-}
+/* This 3D renderer uses a Left-Handed Coordinate System (LHCS): the Z-value grows (positive) inside the monitor.
+ *
+ * Also, the winding order of a triangle is Clockwise:
+ *
+ *      CLOCKWISE: A/B/C           COUNTERCLOCKWISE: A/C/B
+ *
+ *              B                             B
+ *            . o                          . o
+ *         .´  '                        .´  '
+ *   A o.´  / '                   A o.´    '
+ *       `./ '                        `.  '
+ *        /`o                           `o
+ *       ñ  C                            C
+ *
+ * The Normal for a triangle in LHCS that points towards the camera would be:
+ *      Vec3d(0.f, 0.f, -1.f)
+ */
+#include "vec4d.h"
+#include "mat4.h"
+#include "window.h"
+#include "tex2.h"
+#include "cpudispatch.h"
+
+#include <QDateTime>
+#include <QDebug>
+#include <QPainter>
+#include <QThread>
+
+#include <cstring>
+
+#define PI 3.14159265358979323846
+
+#define WND_WIDTH 1280
+#define WND_HEIGHT 900
+
+#define FPS 200
+#define RENDER_WAIT_MS (1000 / FPS)
+
+// dynamic resolution: the render resolution varies between 50% and 100% of the window to hold the raster within the frame time
+#define MIN_RENDER_SCALE 0.5f
+#define MAX_RENDER_SCALE 1.0f
+#define RENDER_SCALE_STEP 0.05f
+#define RENDER_SCALE_TOLERANCE 0.15     // +/-15% around the target before the scale changes
+#define RENDER_SCALE_HOLD_FRAMES 15     // frames that must be out of the tolerance band before the scale changes
+
+// extra views: size of the chase view and of the faces of the cube map on the screen
+#define CHASE_VIEW_WIDTH 320
+#define CHASE_VIEW_HEIGHT 200
+#define CUBE_MAP_SIZE 128
+
+
+// global flags
+bool ORBIT_CAMERA           = true;
+bool LAZY_CLEAR             = false;
+bool DYNAMIC_RESOLUTION     = false;
+bool DAMAGE_TRACKING        = true;
+bool EXTRA_VIEWS            = false;
+
+
+// sameVec3d: true when both vectors are exactly the same
+static bool sameVec3d(const Vec3d& a, const Vec3d& b)
+{
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+// hex2argb: returns red 0xFF800000 as ARGB QColor(255, 128, 0, 0)
+QColor hex2argb(const uint32_t& c)
+{
+    QColor out = QColor((uint8_t) ((c >> 24) & 0xFF),    // alpha
+                        (uint8_t) ((c >> 16) & 0xFF),    // red
+                        (uint8_t) ((c >> 8)  & 0xFF),    // green
+                        (uint8_t) (c & 0xFF));           // blue
+
+//    qDebug() << "hex2rgba a=" << out.alpha();
+//    qDebug() << "hex2rgba r=" << out.red();
+//    qDebug() << "hex2rgba g=" << out.green();
+//    qDebug() << "hex2rgba b=" << out.blue();
+
+    return out;
+}
+
+Window::Window()
+:_width(WND_WIDTH), _height(WND_HEIGHT), _tick_ms(5), _extraViews(&_renderer.jobSystem())
+{
+    _deltaTime = 0.f;
+    _prevTime = QDateTime::currentMSecsSinceEpoch();
+
+    _statsTime = _prevTime;
+
+    // the first frame is always drawn entirely
+    _sceneDirty = true;
+    _partialRedraw = false;
+
+    // resize window
+    resize(_width, _height);
+
+    // setup Display/Color Buffer
+    _renderer.display().setSize(_width, _height);
+    _renderer.display().setup();
+    _renderer.display().setLazyClear(LAZY_CLEAR);
+
+    // setup the controller of the render resolution
+    _resolutionScaler.setTargetFrameTime(RENDER_WAIT_MS);
+    _resolutionScaler.setBounds(MIN_RENDER_SCALE, MAX_RENDER_SCALE);
+    _resolutionScaler.setHysteresis(RENDER_SCALE_TOLERANCE, RENDER_SCALE_HOLD_FRAMES, RENDER_SCALE_STEP);
+
+    /* the meshes of the scene are loaded by the AssetManager on background threads (the vertex cache optimization and
+     * the LODs are generated there too), so the first frame doesn't wait for them: each mesh is drawn as a placeholder
+     * cube until its assets are ready. See openScene().
+     */
+    _startTime = QDateTime::currentMSecsSinceEpoch();
+    _firstFrameTime = -1;
+    _placeholderTexture = std::shared_ptr<uint32_t[]>(new uint32_t[4] { 0xFF606060, 0xFF909090, 0xFF909090, 0xFF606060 });
+
+    // the extra views share the transforms of the meshes and render in parallel (see MultiViewRenderer), on the threads
+    // of the main Renderer
+    _chaseView = _extraViews.addView(CHASE_VIEW_WIDTH, CHASE_VIEW_HEIGHT, (float)PI / 3.f, 1.f, 100.f);
+    _cubeMap = _extraViews.addCubeMap(CUBE_MAP_SIZE, 0.5f, 100.f);
+
+    // initialize default rendering mode
+    _renderMode = RENDER_MODE::WIREFRAME; // TRIANGLES
+
+    // camera and projection of the built-in scene (empty until a scene file is opened)
+    _setupCamera();
+
+    /* start timer to draw frames */
+
+    _timer = new QTimer();
+    _timer->start(_tick_ms);
+    QObject::connect(_timer, SIGNAL(timeout()), this, SLOT(_tick()));    
+
+    qDebug() << "Window::Window:           ORBIT_CAMERA=" << ORBIT_CAMERA;
+    qDebug() << "Window::Window:       ENABLE_FACE_CULL=" << ENABLE_FACE_CULL;
+    qDebug() << "Window::Window:      OBJECT_SPACE_CULL=" << OBJECT_SPACE_CULL;
+    qDebug() << "Window::Window: FIX_TEXTURE_DISTORTION=" << FIX_TEXTURE_DISTORTION;
+    qDebug() << "Window::Window:       ENABLE_Z_PREPASS=" << ENABLE_Z_PREPASS;
+    qDebug() << "Window::Window:             LAZY_CLEAR=" << LAZY_CLEAR;
+    qDebug() << "Window::Window:     DYNAMIC_RESOLUTION=" << DYNAMIC_RESOLUTION;
+    qDebug() << "Window::Window:        DAMAGE_TRACKING=" << DAMAGE_TRACKING;
+    qDebug() << "Window::Window:             ENABLE_LOD=" << ENABLE_LOD;
+    qDebug() << "Window::Window:        GOURAUD_SHADING=" << GOURAUD_SHADING;
+    qDebug() << "Window::Window:            EXTRA_VIEWS=" << EXTRA_VIEWS;
+    qDebug() << "Window::Window:    DEPTH_BUFFER_FORMAT=" << DEPTH_BUFFER_FORMAT;
+    qDebug() << "Window::Window:         ENABLE_SHADOWS=" << ENABLE_SHADOWS;
+    qDebug() << "Window::Window:       CACHE_SHADOW_MAP=" << CACHE_SHADOW_MAP;
+    qDebug() << "Window::Window:             ENABLE_FOG=" << ENABLE_FOG;
+    qDebug() << "Window::Window:         ENABLE_TONEMAP=" << ENABLE_TONEMAP;
+    qDebug() << "Window::Window:            ENABLE_FXAA=" << ENABLE_FXAA;
+    qDebug() << "Window::Window:                KERNELS=" << QString::fromStdString(CpuDispatch::kernels());
+}
+
+Window::~Window()
+{
+}
+
+/* openScene: replaces the meshes, lights and camera with the ones of a scene file. Only the enabled meshes are loaded
+ * and each of them only when it's first needed (see _updateAssets).
+ */
+bool Window::openScene(const std::string& filename)
+{
+    Scene scene;
+    if (!scene.load(filename))
+        return false;
+
+    _scene = scene;
+    _meshObjects.clear();
+    _meshAssets.clear();
+    _meshStates.clear();
+
+    for (unsigned int m = 0; m < _scene.meshes.size(); ++m)
+        if (_scene.meshes[m].enabled)
+            _addMesh(m);
+
+    if (!_scene.lights.empty())
+    {
+        _renderer.setLights(_scene.lights);
+        _extraViews.setLights(_scene.lights);
+    }
+
+    ORBIT_CAMERA = _scene.camera.orbit;
+    _setupCamera();
+
+    _sceneDirty = true;
+    return true;
+}
+
+bool Window::openPagedMesh(const std::string& filename)
+{
+    if (!_pagedMesh.open(filename))
+        return false;
+
+    // fit the whole mesh in a sphere of 3 units around the point the camera orbits
+    float scale = (_pagedMesh.boundsRadius > 0.f) ? 3.f / _pagedMesh.boundsRadius : 1.f;
+    _pagedMesh.scale = Vec3d(scale, scale, scale);
+    _pagedMesh.translation = _scene.camera.target - _pagedMesh.boundsCenter * scale;
+
+    // the page file has no texture: a single white texel keeps the textured modes working
+    _pagedMesh.texture = std::shared_ptr<uint32_t[]>(new uint32_t[1]);
+    _pagedMesh.texture[0] = 0xFFFFFFFF;
+    _pagedMesh.textureWidth = _pagedMesh.textureHeight = 1;
+
+    qDebug() << "Window::openPagedMesh:" << QString::fromStdString(filename) << "pages=" << _pagedMesh.pageCount()
+             << "faces=" << _pagedMesh.totalFaces();
+
+    _sceneDirty = true;
+    return true;
+}
+
+// _setupCamera: initial position of the camera and projection matrix of the scene
+void Window::_setupCamera()
+{
+    _camera.position = _scene.camera.position;
+    _camera.direction = _scene.camera.target - _scene.camera.position;
+    if (_camera.direction.mag() > 0.f)
+        _camera.direction.norm();
+    else
+        _camera.direction = Vec3d(0, 0, 1); // looking at positive Z-axis
+
+    // define the initial orbit angle of the camera and its distance from the target
+    _cameraOrbitAngle = _scene.camera.orbitAngle;
+    _cameraOrbitDistance = _scene.camera.orbitDistance;
+
+    /* initialize projection matrix */
+
+    float arX = _width / (float)_height;                    // horizontal Aspect Ratio
+    float fovY = _scene.camera.fovY * (float)PI / 180.f;    // 60º is 180/3 which is equivalent to PI/3 in radians
+    _renderer.setProjection(fovY, arX, _scene.camera.zNear, _scene.camera.zFar);
+    _extraViews.view(_chaseView).setProjection(fovY, CHASE_VIEW_WIDTH / (float)CHASE_VIEW_HEIGHT, _scene.camera.zNear, _scene.camera.zFar);
+}
+
+// _addMesh: a mesh of the scene is drawn as a placeholder until its assets are requested and loaded
+void Window::_addMesh(const unsigned int& sceneMesh)
+{
+    const SceneMesh& desc = _scene.meshes[sceneMesh];
+
+    CubeMesh placeholder;
+    placeholder.setTexture(_placeholderTexture, 2, 2);
+    placeholder.scale = desc.scale;
+    placeholder.rotation = desc.rotation;
+    placeholder.translation = desc.translation;
+    _meshObjects.push_back(placeholder);
+
+    MeshAssets assets;
+    assets.sceneMesh = sceneMesh;
+    assets.requested = false;
+    assets.done = false;
+    _meshAssets.push_back(assets);
+}
+
+/* _updateAssets: requests the assets of the meshes the camera got close enough to, and the meshes whose assets
+ * finished loading replace their placeholders. Returns true when the scene changed.
+ * A mesh that failed to load keeps its placeholder (and a texture that failed keeps the placeholder texture).
+ */
+bool Window::_updateAssets()
+{
+    bool changed = false;
+
+    for (unsigned int m = 0; m < _meshAssets.size(); ++m)
+    {
+        MeshAssets& assets = _meshAssets[m];
+        if (assets.done)
+            continue;
+
+        const SceneMesh& desc = _scene.meshes[assets.sceneMesh];
+
+        if (!assets.requested)
+        {
+            Vec3d toMesh = _camera.position - desc.translation;
+            if (desc.loadDistance > 0.f && toMesh.mag() > desc.loadDistance)
+                continue;
+
+            assets.mesh = _assets.loadMesh(desc.obj, _scene.lodLevels);
+            if (!desc.texture.empty())
+                assets.texture = _assets.loadTexture(desc.texture);
+            assets.requested = true;
+        }
+
+        if (assets.mesh->state() == ASSET_STATE::LOADING || (assets.texture && assets.texture->state() == ASSET_STATE::LOADING))
+            continue;
+
+        assets.done = true;
+        if (!assets.mesh->ready())
+            continue;
+
+        // the geometry is shared with the asset, only the transforms and the texture belong to the mesh
+        Mesh mesh;
+        mesh.asset = assets.mesh->data();
+        mesh.scale = _meshObjects[m].scale;
+        mesh.rotation = _meshObjects[m].rotation;
+        mesh.translation = _meshObjects[m].translation;
+
+        if (assets.texture && assets.texture->ready())
+            mesh.setTexture(assets.texture->data()->pixels, assets.texture->data()->width, assets.texture->data()->height);
+        else
+            mesh.setTexture(_placeholderTexture, 2, 2);
+
+        _meshObjects[m] = mesh;
+        changed = true;
+    }
+
+    if (changed && !_assets.pendingLoads())
+        qDebug() << "Window::_updateAssets: assets loaded after" << QDateTime::currentMSecsSinceEpoch() - _startTime << "ms"
+                 << "requests=" << _assets.requests() << "cache hits=" << _assets.cacheHits() << "shared textures=" << _assets.sharedTextures();
+
+    return changed;
+}
+
+void Window::_tick()
+{
+    // the meshes that finished loading replace their placeholders: the whole screen must be redrawn
+    if (_updateAssets())
+        _sceneDirty = true;
+
+    // nothing changed since the last frame: the image would be identical, so it's not drawn again
+    if (!_sceneChanged())
+    {
+        // the time spent idle must not be seen as the duration of the next frame
+        _prevTime = QDateTime::currentMSecsSinceEpoch();
+        return;
+    }
+
+    // trigger paint event to redraw the window
+    update();
+}
+
+/* _sceneChanged: damage tracking. A new frame is needed when the whole screen was invalidated (key press, resize,
+ * render scale), when the camera orbits or when one of the meshes moved since the last frame rendered.
+ */
+bool Window::_sceneChanged()
+{
+    // pages still loading: keep drawing frames until they show up at the right level
+    if (!DAMAGE_TRACKING || _sceneDirty || ORBIT_CAMERA || _meshStates.size() != _meshObjects.size() || _pagedMesh.pending())
+        return true;
+
+    for (unsigned int m = 0; m < _meshObjects.size(); ++m)
+        if (_meshChanged(m))
+            return true;
+
+    return false;
+}
+
+// _meshChanged: true when the transforms of a mesh are not the same of the last frame rendered
+bool Window::_meshChanged(const unsigned int& m)
+{
+    if (m >= _meshStates.size())
+        return true;
+
+    return !sameVec3d(_meshObjects[m].rotation, _meshStates[m].rotation) ||
+           !sameVec3d(_meshObjects[m].scale, _meshStates[m].scale) ||
+           !sameVec3d(_meshObjects[m].translation, _meshStates[m].translation);
+}
+
+// _saveSceneState: remember what was rendered on this frame to find out what changes on the next ones
+void Window::_saveSceneState()
+{
+    _meshStates.resize(_meshObjects.size());
+
+    for (unsigned int m = 0; m < _meshObjects.size(); ++m)
+    {
+        _meshStates[m].rotation = _meshObjects[m].rotation;
+        _meshStates[m].scale = _meshObjects[m].scale;
+        _meshStates[m].translation = _meshObjects[m].translation;
+        _meshStates[m].bounds = (m < _renderer.meshBounds().size()) ? _renderer.meshBounds()[m] : QRect();
+    }
+
+    _prevViewMatrix = _viewMatrix;
+    _sceneDirty = false;
+}
+
+// wrapColorBuffer: the image only wraps the color buffer of a Display, it's built again when the buffer is reallocated
+// or resized, not every frame
+static const QImage& wrapColorBuffer(QImage& image, Display& gfx)
+{
+    if (image.constBits() != (const uchar*)(gfx.colorBuffer()) || image.width() != gfx.width() || image.height() != gfx.height())
+        image = QImage((const uchar*)(gfx.colorBuffer()), gfx.width(), gfx.height(), gfx.stride() * sizeof(uint32_t), QImage::Format_ARGB32);
+
+    return image;
+}
+
+void Window::_renderColorBuffer(QPainter& p)
+{
+    //qDebug() << "Window::_renderColorBuffer";
+
+    Display& gfx = _renderer.display();
+    wrapColorBuffer(_framebuffer, gfx);
+//    if (!_framebuffer.save("framebuffer.jpg"))
+//        qDebug() << "_renderColorBuffer!!! image";
+
+    // scale 3D screen to the window size if necessary (e.g. dynamic resolution is rendering at a lower resolution)
+    if (gfx.width() != _width || gfx.height() != _height)
+    {
+        p.setRenderHint(QPainter::SmoothPixmapTransform);
+        p.drawImage(QRect(0, 0, _width, _height), _framebuffer);
+    }
+    else
+    {
+        p.drawImage(QPoint(0, 0), _framebuffer);
+    }
+
+    if (!EXTRA_VIEWS)
+        return;
+
+    // the chase view on the top right corner and the 6 faces of the cube map (+X -X +Y -Y +Z -Z) on the bottom
+    _extraViewImages.resize(_extraViews.viewCount());
+
+    Display& chase = _extraViews.view(_chaseView).display();
+    p.drawImage(QPoint(_width - chase.width(), 0), wrapColorBuffer(_extraViewImages[_chaseView], chase));
+
+    for (int face = 0; face < 6; ++face)
+    {
+        Display& cube = _extraViews.view(_cubeMap + face).display();
+        p.drawImage(QPoint(face * cube.width(), _height - cube.height()), wrapColorBuffer(_extraViewImages[_cubeMap + face], cube));
+    }
+}
+
+/* _renderExtraViews: the chase camera follows the main camera from behind and above, looking at the same target. The
+ * cube map is centered on the target of the scene (what a reflective object placed there would reflect).
+ */
+void Window::_renderExtraViews()
+{
+    Vec3d target = _scene.camera.target;
+    Vec3d back = _camera.position - target;
+    if (back.mag() > 0.f)
+        back.norm();
+
+    Vec3d chasePosition = _camera.position + back * 3.f + Vec3d(0.f, 1.5f, 0.f);
+    _extraViews.setCamera(_chaseView, chasePosition, Mat4::lookAt(chasePosition, target, Vec3d(0.f, 1.f, 0.f)));
+    _extraViews.setCubeMapCamera(_cubeMap, _scene.camera.target);
+
+    _extraViews.render(_geometryMeshes, _renderMode);
+}
+
+/* _applyRenderScale: resize the Display to the scale factor of the render resolution.
+ * The aspect ratio of the window is preserved, so the projection matrix remains the same.
+ */
+void Window::_applyRenderScale()
+{
+    float scale = (DYNAMIC_RESOLUTION) ? _resolutionScaler.scale() : 1.f;
+
+    int w = std::max(1, (int)(_width * scale + 0.5f));
+    int h = std::max(1, (int)(_height * scale + 0.5f));
+
+    _renderer.display().setSize(w, h);
+
+    // the previous frame doesn't match the new resolution
+    _sceneDirty = true;
+}
+
+void Window::resizeEvent(QResizeEvent* event)
+{
+    Q_UNUSED(event)
+
+    qDebug() << "Window::resizeEvent: " << width() << "x" << height();
+
+    if (width() != _width || height() != _height)
+    {
+        _width = width();
+        _height = height();
+
+        // setup color buffer again
+        _applyRenderScale();
+
+        // trigger paintEvent
+        update();
+    }
+}
+
+void Window::paintEvent(QPaintEvent* e)
+{
+    //qDebug() << "Window::paintEvent";
+
+    if (!_renderer.display().colorBuffer())
+        qDebug() << "paintEvent: null color buffer";
+
+    QPainter painter(this);
+
+    // nothing changed since the last frame (e.g. the window was just exposed): present the same image again
+    if (!_sceneChanged())
+    {
+        _renderColorBuffer(painter);
+        QWidget::paintEvent(e);
+        return;
+    }
+
+    /* update: linear transforms, perspective projection */
+
+    updt();
+
+    /* damage tracking: when the camera didn't move and nothing else invalidated the screen, only the area covered by
+     * the old and the new positions of the meshes that moved has to be redrawn (not with shadows: they may fall anywhere,
+     * nor with the post-processing filters: they go over the whole frame)
+     */
+    _partialRedraw = DAMAGE_TRACKING && !ENABLE_SHADOWS && !ENABLE_FOG && !ENABLE_TONEMAP && !ENABLE_FXAA && !_sceneDirty && _meshStates.size() == _meshObjects.size() &&
+                     std::memcmp(_prevViewMatrix.m, _viewMatrix.m, sizeof(_viewMatrix.m)) == 0;
+
+    if (_partialRedraw)
+    {
+        _damageRect = QRect();
+        for (unsigned int m = 0; m < _meshObjects.size(); ++m)
+            if (_meshChanged(m))
+                _damageRect = _damageRect.united(_meshStates[m].bounds).united(_renderer.meshBounds()[m]);
+
+        _renderer.display().setScissor(_damageRect.x(), _damageRect.y(), _damageRect.width(), _damageRect.height());
+    }
+
+    /* render  */
+
+    render(painter);
+
+    _renderer.display().resetScissor();
+    _partialRedraw = false;
+    _saveSceneState();
+
+    _renderer.profiler().frameDone();
+
+    // adjust the render resolution of the next frame to the time spent rasterizing this one
+    if (DYNAMIC_RESOLUTION && _resolutionScaler.update(_renderer.profiler().last("zprepass") + _renderer.profiler().last("raster")))
+        _applyRenderScale();
+
+    if (_firstFrameTime < 0)
+    {
+        _firstFrameTime = QDateTime::currentMSecsSinceEpoch() - _startTime;
+        qDebug() << "Window::paintEvent: first frame after" << _firstFrameTime << "ms," << _assets.pendingLoads() << "assets still loading";
+    }
+
+    _reportStats();
+
+    QWidget::paintEvent(e);
+}
+
+/* updt: updates animations and object position on the screen
+ */
+void Window::updt()
+{
+    // waste a few milliseconds until enough time has passed to update the new frame
+    qint64 curTime = QDateTime::currentMSecsSinceEpoch();
+    qint64 time2wait = RENDER_WAIT_MS - (curTime - _prevTime);
+
+    if (time2wait > 0 && time2wait < RENDER_WAIT_MS)
+        QThread::msleep(time2wait); // delay
+
+    // calculate delta time: how much time passed since the last frame?
+    curTime = QDateTime::currentMSecsSinceEpoch();
+    _deltaTime = (curTime - _prevTime) / 1000.f; // convert to seconds
+    //std::cout << "curTime - _prevTime=" << curTime - _prevTime << " (ms)" << std::endl;
+    //std::cout << "          deltaTime=" << deltaTime << " (s)" << std::endl;
+
+    // update prevTime for the next frame
+    _prevTime = curTime;
+
+    /* create the view matrix to look at a target point */
+
+    static Vec3d target = _camera.lookAtTarget();
+    Vec3d upVector(0, 1, 0);
+
+    // update camera position to orbit around the scene
+    if (ORBIT_CAMERA)
+    {
+        // define where the camera should orbit around
+        target = _scene.camera.target;
+
+        // increase 15 degrees per second (the speed of the scene)
+        _cameraOrbitAngle += _scene.camera.orbitSpeed * _deltaTime;
+
+        _camera.position.x = target.x + _cameraOrbitDistance * std::cos(_cameraOrbitAngle * (PI / 180.f));
+        _camera.position.z = target.z + _cameraOrbitDistance * std::sin(_cameraOrbitAngle * (PI / 180.f));
+
+        if (_cameraOrbitAngle > 359.f)
+            _cameraOrbitAngle = 0.f;
+    }
+
+    _viewMatrix = Mat4::lookAt(_camera.position,     // eye
+                               target,               // where the camera is looking at (i.e. the direction of the camera)
+                               upVector);            // up vector
+
+    // adjust Scale/Rotation/Translation for all the meshes
+    //for (unsigned int m = 0; m < _meshObjects.size(); ++m)
+    //{
+    //    Mesh* mesh = &_meshObjects[m];
+    //    mesh->rotation.x += 0.6f * _deltaTime;
+    //    mesh->rotation.y += 0.3f * _deltaTime;
+    //    mesh->rotation.z += 0.0f * _deltaTime;
+    //    mesh->scale.x += 0.002f;
+    //    mesh->scale.y += 0.001f;
+    //    mesh->translation.x += 0.01 * _deltaTime;
+    //    mesh->translation.z = 5.0;  // translate point away from the camera
+    //}
+
+    // the pages of a streamed mesh are picked for this view before the geometry stage
+    _geometryMeshes.clear();
+    for (unsigned int m = 0; m < _meshObjects.size(); ++m)
+        _geometryMeshes.push_back(&_meshObjects[m]);
+
+    if (_pagedMesh.isOpen())
+    {
+        _renderer.setView(_camera.position, _viewMatrix);
+        _pagedMesh.update(_renderer);
+        _geometryMeshes.insert(_geometryMeshes.end(), _pagedMesh.meshes().begin(), _pagedMesh.meshes().end());
+
+        // the pages don't have a MeshState: a different set of pages redraws the whole screen
+        if (_pagedMesh.changed())
+            _sceneDirty = true;
+    }
+
+    // pass the meshes through the graphics pipeline stages
+    _renderer.processGeometry(_geometryMeshes, _camera.position, _viewMatrix);
+}
+
+void Window::render(QPainter& p)
+{
+    //qDebug() << "Window::render";
+
+    _renderer.render(_renderMode, (_partialRedraw) ? &_damageRect : nullptr);
+
+    if (EXTRA_VIEWS)
+        _renderExtraViews();
+
+    // copy Color Buffer to "texture" so that it can be draw on the screen
+    _renderer.profiler().begin("present");
+
+    // fill the tiles that no triangle has touched
+    _renderer.display().resolveClears();
+
+    _renderColorBuffer(p);
+    _renderer.profiler().end("present");
+}
+
+/* _reportStats: prints once per second the average time of each stage of a frame and how many pixels were
+ * rasterized (depth tested), shaded (texel fetches) and written per frame.
+ * Overdraw is the number of pixels written per frame divided by the number of pixels covered by triangles:
+ * the Z-prepass brings it down to ~1.0 for the price of rasterizing every triangle twice.
+ */
+void Window::_reportStats()
+{
+    qint64 curTime = QDateTime::currentMSecsSinceEpoch();
+    if (curTime - _statsTime < 1000 || !_renderer.profiler().frames())
+        return;
+
+    Display& gfx = _renderer.display();
+    int frames = _renderer.profiler().frames();
+    uint64_t covered = gfx.coveredPixels();
+    float overdraw = (covered) ? (gfx.writtenPixels() / (float)frames) / covered : 0.f;
+
+    qDebug() << "Window::_reportStats:" << QString::fromStdString(_renderer.profiler().report())
+             << " rasterized pixels/frame=" << gfx.rasterizedPixels() / frames
+             << " shaded pixels/frame=" << gfx.shadedPixels() / frames
+             << " overdraw=" << overdraw
+             << " submitted faces/frame=" << _renderer.processedFaces() / frames << "/" << _renderer.fullDetailFaces() / frames
+             << " lod=" << ENABLE_LOD
+             << " culled faces/frame=" << _renderer.culledFaces() / frames << "/" << _renderer.processedFaces() / frames
+             << " vertex cache hits=" << _renderer.vertexCacheHitRate()
+             << " pages=" << _pagedMesh.visiblePages() << "/" << _pagedMesh.pageCount()
+             << " resident=" << _pagedMesh.residentBytes() / (1024 * 1024) << "MB(" << _pagedMesh.residentChunks() << " chunks)"
+             << " page loads=" << _pagedMesh.loads() << " evictions=" << _pagedMesh.evictions()
+             << " lights=" << _renderer.lights().size() << " gouraud=" << GOURAUD_SHADING
+             << " zprepass=" << ENABLE_Z_PREPASS
+             << " depth=" << DEPTH_BUFFER_FORMAT
+             << " shadows=" << ENABLE_SHADOWS << "(" << _renderer.shadowMap().renders() << " map renders)"
+             << " post=" << (ENABLE_FOG ? "fog " : "") << (ENABLE_TONEMAP ? "tonemap " : "") << (ENABLE_FXAA ? "fxaa" : "")
+             << " deferred=" << (_renderMode == RENDER_MODE::TEXTURED_DEFERRED)
+             << " render scale=" << _resolutionScaler.scale() << "(" << gfx.width() << "x" << gfx.height() << ")";
+
+    if (EXTRA_VIEWS && _extraViews.profiler().frames())
+        qDebug() << "Window::_reportStats: extra views" << QString::fromStdString(_extraViews.profiler().report())
+                 << " chase view" << QString::fromStdString(_extraViews.view(_chaseView).profiler().report());
+
+    _extraViews.profiler().reset();
+    for (int v = 0; v < _extraViews.viewCount(); ++v)
+        _extraViews.view(v).profiler().reset();
+
+    gfx.resetStats();
+    _renderer.profiler().reset();
+    _renderer.resetStats();
+    _statsTime = curTime;
+}
+
+void Window::keyPressEvent(QKeyEvent* event)
+{
+    // any key may change the image: render mode, flags, camera, ...
+    _sceneDirty = true;
+
+    switch (event->key())
+    {
+        case Qt::Key_Escape:
+            qDebug() << "keyPressEvent: ESC";
+            exit(0);
+            break;
+
+        /* rendering mode */
+
+        case Qt::Key_1:
+            qDebug() << "keyPressEvent: RENDER_MODE::WIREFRAME";
+            _renderMode = RENDER_MODE::WIREFRAME;
+            break;
+
+        case Qt::Key_2:
+            qDebug() << "keyPressEvent: RENDER_MODE::WIREFRAME_DOTS";
+            _renderMode = RENDER_MODE::WIREFRAME_DOTS;
+            break;
+
+        case Qt::Key_3:
+            qDebug() << "keyPressEvent: RENDER_MODE::TRIANGLES";
+            _renderMode = RENDER_MODE::TRIANGLES;
+            break;
+
+        case Qt::Key_4:
+            qDebug() << "keyPressEvent: RENDER_MODE::TRIANGLES_WIREFRAME";
+            _renderMode = RENDER_MODE::TRIANGLES_WIREFRAME;
+            break;
+
+        case Qt::Key_5:
+            ENABLE_FACE_CULL = !ENABLE_FACE_CULL;
+            qDebug() << "keyPressEvent: ENABLE_FACE_CULL=" << ENABLE_FACE_CULL;
+            break;
+
+        case Qt::Key_6:
+            qDebug() << "keyPressEvent: RENDER_MODE::TEXTURED";
+            _renderMode = RENDER_MODE::TEXTURED;
+            break;
+
+        case Qt::Key_7:
+            qDebug() << "keyPressEvent: RENDER_MODE::TEXTURED_WIREFRAME";
+            _renderMode = RENDER_MODE::TEXTURED_WIREFRAME;
+            break;
+
+        case Qt::Key_8:
+            qDebug() << "keyPressEvent: RENDER_MODE::TEXTURED_DEFERRED";
+            _renderMode = RENDER_MODE::TEXTURED_DEFERRED;
+            break;
+
+        case Qt::Key_B:
+            OBJECT_SPACE_CULL = !OBJECT_SPACE_CULL;
+            qDebug() << "keyPressEvent: OBJECT_SPACE_CULL=" << OBJECT_SPACE_CULL;
+            break;
+
+        case Qt::Key_Z:
+            ENABLE_Z_PREPASS = !ENABLE_Z_PREPASS;
+            qDebug() << "keyPressEvent: ENABLE_Z_PREPASS=" << ENABLE_Z_PREPASS;
+            break;
+
+        case Qt::Key_C:
+            LAZY_CLEAR = !LAZY_CLEAR;
+            _renderer.display().setLazyClear(LAZY_CLEAR);
+            qDebug() << "keyPressEvent: LAZY_CLEAR=" << LAZY_CLEAR;
+            break;
+
+        case Qt::Key_R:
+            DYNAMIC_RESOLUTION = !DYNAMIC_RESOLUTION;
+            _resolutionScaler.reset();
+            _applyRenderScale();
+            qDebug() << "keyPressEvent: DYNAMIC_RESOLUTION=" << DYNAMIC_RESOLUTION;
+            break;
+
+        case Qt::Key_D:
+            DAMAGE_TRACKING = !DAMAGE_TRACKING;
+            qDebug() << "keyPressEvent: DAMAGE_TRACKING=" << DAMAGE_TRACKING;
+            break;
+
+        case Qt::Key_L:
+            ENABLE_LOD = !ENABLE_LOD;
+            qDebug() << "keyPressEvent: ENABLE_LOD=" << ENABLE_LOD;
+            break;
+
+        case Qt::Key_G:
+            GOURAUD_SHADING = !GOURAUD_SHADING;
+            qDebug() << "keyPressEvent: GOURAUD_SHADING=" << GOURAUD_SHADING;
+            break;
+
+        case Qt::Key_X:
+            // float -> 16-bit -> reversed-Z float
+            DEPTH_BUFFER_FORMAT = (DEPTH_FORMAT)((DEPTH_BUFFER_FORMAT + 1) % 3);
+            qDebug() << "keyPressEvent: DEPTH_BUFFER_FORMAT=" << DEPTH_BUFFER_FORMAT;
+            break;
+
+        case Qt::Key_H:
+            ENABLE_SHADOWS = !ENABLE_SHADOWS;
+            qDebug() << "keyPressEvent: ENABLE_SHADOWS=" << ENABLE_SHADOWS;
+            break;
+
+        case Qt::Key_K:
+            CACHE_SHADOW_MAP = !CACHE_SHADOW_MAP;
+            qDebug() << "keyPressEvent: CACHE_SHADOW_MAP=" << CACHE_SHADOW_MAP;
+            break;
+
+        case Qt::Key_F:
+            ENABLE_FOG = !ENABLE_FOG;
+            qDebug() << "keyPressEvent: ENABLE_FOG=" << ENABLE_FOG;
+            break;
+
+        case Qt::Key_M:
+            ENABLE_TONEMAP = !ENABLE_TONEMAP;
+            qDebug() << "keyPressEvent: ENABLE_TONEMAP=" << ENABLE_TONEMAP;
+            break;
+
+        case Qt::Key_A:
+            ENABLE_FXAA = !ENABLE_FXAA;
+            qDebug() << "keyPressEvent: ENABLE_FXAA=" << ENABLE_FXAA;
+            break;
+
+        case Qt::Key_V:
+            EXTRA_VIEWS = !EXTRA_VIEWS;
+            qDebug() << "keyPressEvent: EXTRA_VIEWS=" << EXTRA_VIEWS;
+            break;
+
+        case Qt::Key_T:
+            FIX_TEXTURE_DISTORTION = !FIX_TEXTURE_DISTORTION;
+            qDebug() << "keyPressEvent: FIX_TEXTURE_DISTORTION=" << FIX_TEXTURE_DISTORTION;
+            break;
+
+        /* camera movement */
+
+        case Qt::Key_O:
+            ORBIT_CAMERA = !ORBIT_CAMERA;
+            qDebug() << "keyPressEvent: ORBIT_CAMERA=" << ORBIT_CAMERA;
+            break;
+
+        case Qt::Key_W:
+            qDebug() << "keyPressEvent: W";
+            _camera.rotatePitch(+1.0f * _deltaTime);
+            break;
+
+        case Qt::Key_S:
+            qDebug() << "keyPressEvent: S";
+            _camera.rotatePitch(-1.0f * _deltaTime);
+            break;
+
+        case Qt::Key_Up:
+            qDebug() << "keyPressEvent: Up";
+            _camera.forwardVelocity = _camera.direction * 5.f * _deltaTime;
+            _camera.position = _camera.position + _camera.forwardVelocity;
+            break;
+
+        case Qt::Key_Down:
+            qDebug() << "keyPressEvent: Down";
+            _camera.forwardVelocity = _camera.direction * 5.f * _deltaTime;
+            _camera.position = _camera.position - _camera.forwardVelocity;
+            break;
+
+        case Qt::Key_Right:
+            qDebug() << "keyPressEvent: RIGHT";
+            //_camera.yaw += 1.0f * _deltaTime;
+            _camera.rotateYaw(+1.0f * _deltaTime);
+            break;
+
+        case Qt::Key_Left:
+            qDebug() << "keyPressEvent: LEFT";
+            //_camera.yaw -= 1.0f * _deltaTime;
+            _camera.rotateYaw(-1.0f * _deltaTime);
+            break;
+
+        default:
+            break;
+    }
+}
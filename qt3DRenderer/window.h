@@ -1,78 +1,128 @@
-#pragma once
-#include <vector>
-
-#include <QWidget>
-#include <QImage>
-#include <QResizeEvent>
-#include <QKeyEvent>
-#include <QTimer>
-
-#include "mat4.h"
-#include "vec3d.h"
-#include "display.h"
-#include "light.h"
-#include "mesh.h"
-#include "cubemesh.h"
-#include "triangle.h"
-#include "camera.h"
-#include "clipping.h"
-
-
-enum RENDER_MODE {
-    WIREFRAME,              // draw only wireframe lines
-    WIREFRAME_DOTS,         // draw wireframe lines with small colored dots on each triangle vertex
-    TRIANGLES,              // fills triangles with a solid color
-    TRIANGLES_WIREFRAME,    // fills triangles and adds wireframe lines
-    TEXTURED,               // draw with textures
-    TEXTURED_WIREFRAME      // draw with textures and adds wireframe lines
-};
-
-
-class Window : public QWidget
-{
-    Q_OBJECT
-
-public:
-    Window();
-    ~Window();
-
-
-    void updt();
-    void render(QPainter& p);
-
-    void resizeEvent(QResizeEvent* event);
-    void paintEvent(QPaintEvent* e);
-    void keyPressEvent(QKeyEvent* event);
-
-private slots:
-    void _tick();
-
-private:
-    void _renderColorBuffer(QPainter& p);
-    void _initFrustumPlanes(const float& fovX, const float& fovY, const float& zNear, const float& zFar);
-    void _processGraphicsPipeline(Mesh* mesh);
-
-    int _width, _height;
-    QImage _framebuffer;
-    Display _gfx;
-
-    std::vector<Triangle> _triangles2render;
-    std::vector<Mesh> _meshObjects;
-
-    Camera _camera;
-    float _cameraOrbitAngle;
-    float _cameraOrbitDistance;
-
-    Mat4 _viewMatrix;
-    float _deltaTime;
-
-    QTimer* _timer;
-    qint64 _tick_ms;
-    qint64 _prevTime;
-    RENDER_MODE _renderMode;
-
-    Mat4 _projMatrix;
-    Light _lightSource;            
-
-    Plane _frustumPlanes[6];
-};
+#pragma once
+#include <vector>
+
+#include <QWidget>
+#include <QImage>
+#include <QRect>
+#include <QResizeEvent>
+#include <QKeyEvent>
+#include <QTimer>
+
+#include "mat4.h"
+#include "vec3d.h"
+#include "display.h"
+#include "light.h"
+#include "assetmanager.h"
+#include "mesh.h"
+#include "multiviewrenderer.h"
+#include "pagedmesh.h"
+#include "cubemesh.h"
+#include "triangle.h"
+#include "camera.h"
+#include "clipping.h"
+#include "profiler.h"
+#include "renderer.h"
+#include "resolutionscaler.h"
+#include "scene.h"
+
+
+// MeshAssets: the assets a mesh of the scene is waiting for (its placeholder is drawn until they are loaded)
+struct MeshAssets
+{
+    unsigned int sceneMesh;     // index in Scene::meshes
+    bool requested;             // the camera got within its loadDistance
+    MeshAsset mesh;
+    TextureAsset texture;       // null when the scene gives no texture
+    bool done;
+};
+
+// MeshState: the transforms of a mesh on the last frame rendered and the screen area its triangles covered
+struct MeshState
+{
+    Vec3d rotation;
+    Vec3d scale;
+    Vec3d translation;
+    QRect bounds;           // bounding box of its triangles on the screen (null when no triangle was visible)
+};
+
+
+class Window : public QWidget
+{
+    Q_OBJECT
+
+public:
+    Window();
+    ~Window();
+
+
+    void updt();
+    void render(QPainter& p);
+
+    void resizeEvent(QResizeEvent* event);
+    void paintEvent(QPaintEvent* e);
+    void keyPressEvent(QKeyEvent* event);
+
+    // openScene: loads a scene file (qt3DRenderer --scene file.json)
+    bool openScene(const std::string& filename);
+
+    // openPagedMesh: streams a page file written by PagedMesh::build() (qt3DRenderer --pages file)
+    bool openPagedMesh(const std::string& filename);
+
+private slots:
+    void _tick();
+
+private:
+    void _renderColorBuffer(QPainter& p);
+    void _renderExtraViews();
+    void _reportStats();
+    void _applyRenderScale();
+    void _setupCamera();
+    void _addMesh(const unsigned int& sceneMesh);
+    bool _updateAssets();
+    bool _sceneChanged();
+    bool _meshChanged(const unsigned int& m);
+    void _saveSceneState();
+
+    int _width, _height;
+    QImage _framebuffer;
+    Renderer _renderer;
+
+    Scene _scene;
+    std::vector<Mesh> _meshObjects;
+    AssetManager _assets;
+    std::vector<MeshAssets> _meshAssets;        // one for each mesh of _meshObjects
+    std::shared_ptr<uint32_t[]> _placeholderTexture;
+    qint64 _startTime;
+    qint64 _firstFrameTime;
+    PagedMesh _pagedMesh;
+    std::vector<Mesh*> _geometryMeshes;     // _meshObjects followed by the resident pages of _pagedMesh
+
+    Camera _camera;
+    float _cameraOrbitAngle;
+    float _cameraOrbitDistance;
+
+    Mat4 _viewMatrix;
+    float _deltaTime;
+
+    QTimer* _timer;
+    qint64 _tick_ms;
+    qint64 _prevTime;
+    RENDER_MODE _renderMode;
+
+    qint64 _statsTime;
+
+    ResolutionScaler _resolutionScaler;
+
+    // extra views (key V): a chase camera and a cube map around the target of the scene, drawn over the main view
+    MultiViewRenderer _extraViews;
+    std::vector<QImage> _extraViewImages;   // wrap the color buffers of the extra views
+    int _chaseView;
+    int _cubeMap;
+
+    // damage tracking: frames are only rendered when something changed since the last one
+    bool _sceneDirty;                   // the whole screen must be redrawn (input, resize, render mode, ...)
+    Mat4 _prevViewMatrix;
+    std::vector<MeshState> _meshStates;
+    bool _partialRedraw;
+    QRect _damageRect;
+};